@@ -0,0 +1,28 @@
+using BenchmarkDotNet.Attributes;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Keymap labels as they appear in the bundled keymaps, one of each resolver branch: plain
+// keys, mouse buttons, layer actions, typing toggle, modifier chords and named shortcuts.
+[MemoryDiagnoser]
+public class ActionLabelBenchmarks
+{
+    private static readonly string[] Labels =
+    [
+        "A", "Space", "Backspace", "Shift", "Left Click", "MO(1)", "TG(2)", "TT",
+        "Ctrl+C", "Ctrl+Shift+Tab", "Chordal Shift", "EMOJI", "VOICE", "F12", "Unknown Label", " "
+    ];
+
+    [Benchmark(OperationsPerInvoke = 16)]
+    public int ResolveActionLabel()
+    {
+        int checksum = 0;
+        foreach (string label in Labels)
+        {
+            checksum += (int)EngineActionResolver.ResolveActionLabel(label).Kind;
+        }
+
+        return checksum;
+    }
+}
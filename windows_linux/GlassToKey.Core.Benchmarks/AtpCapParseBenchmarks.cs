@@ -0,0 +1,44 @@
+using BenchmarkDotNet.Attributes;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Parses frame payloads taken from the USB capture, cycled to a fixed batch size so the
+// per-operation numbers stay comparable if the fixture changes length.
+[MemoryDiagnoser]
+public class AtpCapParseBenchmarks
+{
+    private const int Payloads = 1024;
+
+    private readonly byte[][] _payloads = new byte[Payloads][];
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        List<byte[]> source = BenchmarkFixtures.ReadFramePayloads("usb-trackpad");
+        if (source.Count == 0)
+        {
+            throw new InvalidDataException("The usb-trackpad fixture has no frame records.");
+        }
+
+        for (int index = 0; index < Payloads; index++)
+        {
+            _payloads[index] = source[index % source.Count];
+        }
+    }
+
+    [Benchmark(OperationsPerInvoke = Payloads)]
+    public int TryParseFrame()
+    {
+        int contacts = 0;
+        for (int index = 0; index < Payloads; index++)
+        {
+            if (AtpCapV3Payload.TryParseFrame(_payloads[index], out AtpCapV3Frame frame))
+            {
+                contacts += frame.ContactCount;
+            }
+        }
+
+        return contacts;
+    }
+}
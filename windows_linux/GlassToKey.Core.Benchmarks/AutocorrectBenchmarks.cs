@@ -0,0 +1,115 @@
+using BenchmarkDotNet.Attributes;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Word completions through the shipped SymSpell lexicon, with a mix of correct words and
+// common typos. TryCompleteWord warms the session LRU in setup, so it measures the steady
+// state a typing session reaches after its first few hundred words. TryCompleteColdWord
+// cycles through single-letter variants of the same words, several times more than the
+// session's 2048-entry LRU holds, so every word misses the cache and pays a full lookup.
+[MemoryDiagnoser]
+public class AutocorrectBenchmarks
+{
+    private const int WordsPerInvoke = 16;
+
+    private static readonly string[] Words =
+    [
+        "the", "teh", "would", "woudl", "because", "becuase", "keyboard", "keybaord",
+        "trackpad", "trakcpad", "receive", "recieve", "definitely", "definately", "separate", "seperate"
+    ];
+
+    private AutocorrectSession _warmSession = null!;
+    private AutocorrectSession _coldSession = null!;
+    private string[] _coldWords = null!;
+    private int _coldCursor;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _warmSession = CreateSession();
+        _coldSession = CreateSession();
+        _coldWords = BuildColdWords();
+        TypeWords(_warmSession, Words);
+        // Loads the lexicon; none of these words are in the cold pool.
+        TypeWords(_coldSession, Words);
+    }
+
+    [GlobalCleanup]
+    public void Cleanup()
+    {
+        _warmSession.Dispose();
+        _coldSession.Dispose();
+    }
+
+    [Benchmark(OperationsPerInvoke = WordsPerInvoke)]
+    public int TryCompleteWord()
+    {
+        return TypeWords(_warmSession, Words);
+    }
+
+    [Benchmark(OperationsPerInvoke = WordsPerInvoke)]
+    public int TryCompleteColdWord()
+    {
+        int start = _coldCursor;
+        _coldCursor = (start + WordsPerInvoke) % _coldWords.Length;
+        return TypeWords(_coldSession, _coldWords.AsSpan(start, WordsPerInvoke));
+    }
+
+    private static AutocorrectSession CreateSession()
+    {
+        AutocorrectSession session = new();
+        session.Configure(new AutocorrectOptions(
+            MaxEditDistance: 2,
+            DryRunEnabled: false,
+            BlacklistCsv: string.Empty,
+            OverridesCsv: string.Empty));
+        session.SetEnabled(true);
+        return session;
+    }
+
+    // Every single-letter substitution and insertion of the benchmark words, less the words
+    // themselves, deduplicated and trimmed to whole invocations.
+    private static string[] BuildColdWords()
+    {
+        HashSet<string> variants = new(StringComparer.Ordinal);
+        foreach (string word in Words)
+        {
+            for (int position = 0; position <= word.Length; position++)
+            {
+                for (char letter = 'a'; letter <= 'z'; letter++)
+                {
+                    variants.Add(word.Insert(position, letter.ToString()));
+                    if (position < word.Length && word[position] != letter)
+                    {
+                        variants.Add(string.Concat(word.AsSpan(0, position), letter.ToString(), word.AsSpan(position + 1)));
+                    }
+                }
+            }
+        }
+
+        variants.ExceptWith(Words);
+        string[] words = variants.ToArray();
+        new Random(17).Shuffle(words);
+        return words[..(words.Length - words.Length % WordsPerInvoke)];
+    }
+
+    private static int TypeWords(AutocorrectSession session, ReadOnlySpan<string> words)
+    {
+        int corrections = 0;
+        foreach (string word in words)
+        {
+            foreach (char letter in word)
+            {
+                session.TrackLetter(letter);
+            }
+
+            if (session.TryCompleteWord(out _))
+            {
+                corrections++;
+            }
+        }
+
+        return corrections;
+    }
+}
@@ -0,0 +1,129 @@
+using System.Globalization;
+using System.Text.Json;
+using BenchmarkDotNet.Reports;
+
+namespace GlassToKey.Core.Benchmarks;
+
+internal sealed record BenchmarkBaselineEntry(
+    string Name,
+    double MeanNs,
+    double MedianNs,
+    double StdDevNs,
+    double OperationsPerSecond,
+    long? AllocatedBytesPerOperation);
+
+internal sealed record BenchmarkBaseline(
+    DateTime GeneratedUtc,
+    string Runtime,
+    IReadOnlyList<BenchmarkBaselineEntry> Benchmarks);
+
+// One flat, name-sorted JSON file per run so two commits' baselines diff line by line;
+// BenchmarkDotNet's own full JSON report is still written under BenchmarkDotNet.Artifacts.
+internal static class BenchmarkBaselineFile
+{
+    private static readonly JsonSerializerOptions SerializerOptions = new()
+    {
+        WriteIndented = true,
+        PropertyNamingPolicy = JsonNamingPolicy.CamelCase
+    };
+
+    public static BenchmarkBaseline FromSummaries(IEnumerable<Summary> summaries)
+    {
+        List<BenchmarkBaselineEntry> entries = [];
+        foreach (Summary summary in summaries)
+        {
+            foreach (BenchmarkReport report in summary.Reports)
+            {
+                if (report.ResultStatistics is not { } statistics)
+                {
+                    continue;
+                }
+
+                entries.Add(new BenchmarkBaselineEntry(
+                    FormatName(report),
+                    Math.Round(statistics.Mean, 3),
+                    Math.Round(statistics.Median, 3),
+                    Math.Round(statistics.StandardDeviation, 3),
+                    statistics.Mean > 0 ? Math.Round(1_000_000_000.0 / statistics.Mean, 1) : 0,
+                    report.GcStats.GetBytesAllocatedPerOperation(report.BenchmarkCase)));
+            }
+        }
+
+        entries.Sort((left, right) => string.CompareOrdinal(left.Name, right.Name));
+        return new BenchmarkBaseline(DateTime.UtcNow, Environment.Version.ToString(), entries);
+    }
+
+    public static void Save(string path, BenchmarkBaseline baseline)
+    {
+        string? directory = Path.GetDirectoryName(Path.GetFullPath(path));
+        if (!string.IsNullOrWhiteSpace(directory))
+        {
+            Directory.CreateDirectory(directory);
+        }
+
+        File.WriteAllText(path, JsonSerializer.Serialize(baseline, SerializerOptions));
+    }
+
+    public static BenchmarkBaseline Load(string path)
+    {
+        return JsonSerializer.Deserialize<BenchmarkBaseline>(File.ReadAllText(path), SerializerOptions)
+            ?? throw new InvalidDataException($"Benchmark baseline '{path}' is empty.");
+    }
+
+    // Returns the number of regressions: a mean slower by more than thresholdPercent, or any
+    // growth in bytes allocated per operation.
+    public static int Compare(BenchmarkBaseline before, BenchmarkBaseline after, double thresholdPercent, TextWriter output)
+    {
+        Dictionary<string, BenchmarkBaselineEntry> previous = before.Benchmarks.ToDictionary(entry => entry.Name, StringComparer.Ordinal);
+        int regressions = 0;
+        output.WriteLine($"{"benchmark",-60} {"before ns",12} {"after ns",12} {"delta",8} {"alloc B",14}");
+        foreach (BenchmarkBaselineEntry entry in after.Benchmarks)
+        {
+            if (!previous.Remove(entry.Name, out BenchmarkBaselineEntry? old))
+            {
+                output.WriteLine($"{entry.Name,-60} {"-",12} {entry.MeanNs,12:F1} {"new",8} {FormatBytes(entry.AllocatedBytesPerOperation),14}");
+                continue;
+            }
+
+            double deltaPercent = old.MeanNs > 0 ? (entry.MeanNs - old.MeanNs) * 100.0 / old.MeanNs : 0;
+            bool slower = deltaPercent > thresholdPercent;
+            bool allocates = (entry.AllocatedBytesPerOperation ?? 0) > (old.AllocatedBytesPerOperation ?? 0);
+            if (slower || allocates)
+            {
+                regressions++;
+            }
+
+            string allocation = old.AllocatedBytesPerOperation == entry.AllocatedBytesPerOperation
+                ? FormatBytes(entry.AllocatedBytesPerOperation)
+                : $"{FormatBytes(old.AllocatedBytesPerOperation)}->{FormatBytes(entry.AllocatedBytesPerOperation)}";
+            output.WriteLine(string.Create(
+                CultureInfo.InvariantCulture,
+                $"{entry.Name,-60} {old.MeanNs,12:F1} {entry.MeanNs,12:F1} {deltaPercent,7:+0.0;-0.0}% {allocation,14}{(slower || allocates ? "  REGRESSION" : string.Empty)}"));
+        }
+
+        foreach (string removed in previous.Keys.Order(StringComparer.Ordinal))
+        {
+            output.WriteLine($"{removed,-60} removed");
+        }
+
+        return regressions;
+    }
+
+    private static string FormatName(BenchmarkReport report)
+    {
+        string name = $"{report.BenchmarkCase.Descriptor.Type.Name}.{report.BenchmarkCase.Descriptor.WorkloadMethod.Name}";
+        if (report.BenchmarkCase.Parameters.Count == 0)
+        {
+            return name;
+        }
+
+        IEnumerable<string> parameters = report.BenchmarkCase.Parameters.Items.Select(parameter =>
+            string.Create(CultureInfo.InvariantCulture, $"{parameter.Name}={parameter.Value}"));
+        return $"{name}({string.Join(", ", parameters)})";
+    }
+
+    private static string FormatBytes(long? bytes)
+    {
+        return bytes.HasValue ? bytes.Value.ToString(CultureInfo.InvariantCulture) : "-";
+    }
+}
@@ -0,0 +1,134 @@
+using System.Diagnostics;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+internal readonly record struct ReplayFrame(TrackpadSide Side, InputFrame Frame, long TimestampTicks);
+
+// Loads the bundled Linux captures once per benchmark process. BenchmarkDotNet runs each
+// benchmark from its own generated build folder, so the fixtures are looked up next to the
+// binary first and then by walking up to the source tree.
+internal static class BenchmarkFixtures
+{
+    public const ushort MaxX = 7612;
+    public const ushort MaxY = 5065;
+
+    public static string ResolveCapture(string name)
+    {
+        string fileName = name + ".atpcap";
+        string local = Path.Combine(AppContext.BaseDirectory, "fixtures", fileName);
+        if (File.Exists(local))
+        {
+            return local;
+        }
+
+        for (DirectoryInfo? directory = new(AppContext.BaseDirectory); directory != null; directory = directory.Parent)
+        {
+            string candidate = Path.Combine(directory.FullName, "GlassToKey.Linux", "fixtures", "linux", fileName);
+            if (File.Exists(candidate))
+            {
+                return candidate;
+            }
+        }
+
+        throw new FileNotFoundException($"Capture fixture '{fileName}' was not found.", fileName);
+    }
+
+    public static List<byte[]> ReadFramePayloads(string name)
+    {
+        List<byte[]> payloads = [];
+        using InputCaptureReader reader = new(ResolveCapture(name));
+        while (reader.TryReadNext(out CaptureRecord record))
+        {
+            if (record.DeviceIndex != -1 && record.Payload.Length > 0)
+            {
+                payloads.Add(record.Payload.ToArray());
+            }
+        }
+
+        return payloads;
+    }
+
+    // Mirrors the Linux synchronous replay: capture sides come from the side hint, else
+    // alternate per device in arrival order, and timestamps are rebased to the first frame.
+    public static ReplayFrame[] ReadReplayFrames(string name)
+    {
+        List<ReplayFrame> frames = [];
+        Dictionary<(int, uint), TrackpadSide> sides = new();
+        int unhintedDevices = 0;
+        AtpCapV3Compatibility compatibility = AtpCapV3Compatibility.None;
+        long baseQpcTicks = 0;
+        bool hasBaseQpc = false;
+        using InputCaptureReader reader = new(ResolveCapture(name));
+        if (reader.HeaderVersion != InputCaptureFile.Version3)
+        {
+            throw new InvalidDataException($"Capture fixture '{name}' is not a version 3 capture.");
+        }
+
+        while (reader.TryReadNext(out CaptureRecord record))
+        {
+            ReadOnlySpan<byte> payload = record.Payload.Span;
+            if (payload.Length == 0)
+            {
+                continue;
+            }
+
+            if (record.DeviceIndex == -1)
+            {
+                if (AtpCapV3Payload.TryParseMeta(payload, out AtpCapV3Meta meta))
+                {
+                    compatibility = AtpCapV3Payload.ResolveCompatibility(meta);
+                }
+
+                continue;
+            }
+
+            if (!AtpCapV3Payload.TryParseFrame(payload, out AtpCapV3Frame frame))
+            {
+                continue;
+            }
+
+            if (!hasBaseQpc)
+            {
+                baseQpcTicks = record.ArrivalQpcTicks;
+                hasBaseQpc = true;
+            }
+
+            (int, uint) deviceKey = (record.DeviceIndex, record.DeviceHash);
+            if (!sides.TryGetValue(deviceKey, out TrackpadSide side))
+            {
+                side = AtpCapV3Payload.NormalizeSideHint(record.SideHint, compatibility) switch
+                {
+                    CaptureSideHint.Left => TrackpadSide.Left,
+                    CaptureSideHint.Right => TrackpadSide.Right,
+                    _ => (unhintedDevices++ & 1) == 0 ? TrackpadSide.Left : TrackpadSide.Right
+                };
+                sides[deviceKey] = side;
+            }
+
+            long relativeQpc = record.ArrivalQpcTicks - baseQpcTicks;
+            frames.Add(new ReplayFrame(
+                side,
+                AtpCapV3Payload.ToInputFrame(frame, record.ArrivalQpcTicks, MaxX, MaxY, compatibility.FlipY),
+                (long)Math.Round(relativeQpc * (double)Stopwatch.Frequency / reader.HeaderQpcFrequency)));
+        }
+
+        return frames.ToArray();
+    }
+
+    public static BindingIndex BuildBindingIndex(TrackpadLayoutPreset preset, TrackpadSide side)
+    {
+        KeymapStore keymap = KeymapStore.LoadBundledDefault();
+        keymap.SetActiveLayout(preset.Name);
+        KeyLayout layout = LayoutBuilder.BuildLayout(
+            preset,
+            RuntimeConfigurationFactory.TrackpadWidthMm,
+            RuntimeConfigurationFactory.TrackpadHeightMm,
+            RuntimeConfigurationFactory.KeyWidthMm,
+            RuntimeConfigurationFactory.KeyHeightMm,
+            ColumnLayoutDefaults.DefaultSettings(preset.Columns),
+            keymap,
+            mirrored: side == TrackpadSide.Left);
+        return BindingIndex.Build(layout, side, 0, keymap);
+    }
+}
@@ -0,0 +1,46 @@
+using BenchmarkDotNet.Attributes;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Hit tests uniformly spread over the surface, which covers key interiors, gaps and the
+// unbound margins in proportion to their area.
+[MemoryDiagnoser]
+public class BindingIndexBenchmarks
+{
+    private const int Points = 4096;
+
+    private readonly double[] _xs = new double[Points];
+    private readonly double[] _ys = new double[Points];
+    private BindingIndex _index = null!;
+
+    [ParamsSource(nameof(Presets))]
+    public string Preset { get; set; } = string.Empty;
+
+    public static IEnumerable<string> Presets => TrackpadLayoutPreset.All.Select(preset => preset.Name);
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.ResolveByNameOrDefault(Preset);
+        _index = BenchmarkFixtures.BuildBindingIndex(preset, TrackpadSide.Right);
+        Random random = new(17);
+        for (int point = 0; point < Points; point++)
+        {
+            _xs[point] = random.NextDouble();
+            _ys[point] = random.NextDouble();
+        }
+    }
+
+    [Benchmark(OperationsPerInvoke = Points)]
+    public int HitTest()
+    {
+        int checksum = 0;
+        for (int point = 0; point < Points; point++)
+        {
+            checksum += _index.HitTest(_xs[point], _ys[point]).BindingIndex;
+        }
+
+        return checksum;
+    }
+}
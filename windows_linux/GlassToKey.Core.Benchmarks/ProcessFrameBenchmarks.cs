@@ -0,0 +1,51 @@
+using BenchmarkDotNet.Attributes;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Replays a whole bundled capture through TouchProcessorCore on the calling thread, draining
+// dispatch events and pointer effects after every frame the way the engine actor does. One
+// operation is one full replay; divide by Frames (printed in setup) for per-frame cost.
+[MemoryDiagnoser]
+public class ProcessFrameBenchmarks
+{
+    private readonly DispatchEvent[] _dispatchBuffer = new DispatchEvent[256];
+    private readonly TouchProcessorCore.PointerDragEffect[] _effectBuffer = new TouchProcessorCore.PointerDragEffect[64];
+    private ReplayFrame[] _frames = [];
+    private TouchProcessorCore _core = null!;
+
+    [Params("usb-trackpad", "bluetooth-trackpad")]
+    public string Capture { get; set; } = string.Empty;
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _frames = BenchmarkFixtures.ReadReplayFrames(Capture);
+        _core = TouchProcessorFactory.CreateConfigured(KeymapStore.LoadBundledDefault(), new UserSettings());
+        Console.WriteLine($"// {Capture}: frames={_frames.Length}");
+    }
+
+    [Benchmark]
+    public int ReplayCapture()
+    {
+        int dispatched = 0;
+        for (int index = 0; index < _frames.Length; index++)
+        {
+            ReplayFrame replayFrame = _frames[index];
+            InputFrame frame = replayFrame.Frame;
+            _core.ProcessFrame(replayFrame.Side, in frame, BenchmarkFixtures.MaxX, BenchmarkFixtures.MaxY, replayFrame.TimestampTicks);
+            int drained;
+            while ((drained = _core.DrainDispatchEvents(_dispatchBuffer)) > 0)
+            {
+                dispatched += drained;
+            }
+
+            while (_core.DrainPointerDragEffects(_effectBuffer) == _effectBuffer.Length)
+            {
+            }
+        }
+
+        _core.ResetState();
+        return dispatched;
+    }
+}
@@ -0,0 +1,85 @@
+using System.Globalization;
+using BenchmarkDotNet.Configs;
+using BenchmarkDotNet.Exporters.Json;
+using BenchmarkDotNet.Reports;
+using BenchmarkDotNet.Running;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Usage:
+//   dotnet run -c Release -- [--baseline-out <path>] [BenchmarkDotNet args, e.g. --filter *HitTest*]
+//   dotnet run -c Release -- compare <before.json> <after.json> [--threshold <percent>]
+internal static class Program
+{
+    private const string DefaultBaselinePath = "BenchmarkDotNet.Artifacts/glasstokey-core-baseline.json";
+    private const double DefaultThresholdPercent = 10.0;
+
+    public static int Main(string[] args)
+    {
+        if (args.Length > 0 && string.Equals(args[0], "compare", StringComparison.OrdinalIgnoreCase))
+        {
+            return Compare(args);
+        }
+
+        string baselinePath = DefaultBaselinePath;
+        List<string> benchmarkArgs = [];
+        for (int index = 0; index < args.Length; index++)
+        {
+            if (string.Equals(args[index], "--baseline-out", StringComparison.Ordinal) && index + 1 < args.Length)
+            {
+                baselinePath = args[++index];
+                continue;
+            }
+
+            benchmarkArgs.Add(args[index]);
+        }
+
+        IConfig config = DefaultConfig.Instance.AddExporter(JsonExporter.Full);
+        Summary[] summaries = BenchmarkSwitcher.FromAssembly(typeof(Program).Assembly).Run(benchmarkArgs.ToArray(), config).ToArray();
+        if (summaries.Length == 0 || summaries.All(summary => summary.Reports.IsEmpty))
+        {
+            return 1;
+        }
+
+        BenchmarkBaselineFile.Save(baselinePath, BenchmarkBaselineFile.FromSummaries(summaries));
+        Console.WriteLine($"Benchmark baseline written to '{Path.GetFullPath(baselinePath)}'.");
+        return summaries.Any(summary => summary.HasCriticalValidationErrors) ? 1 : 0;
+    }
+
+    private static int Compare(string[] args)
+    {
+        if (args.Length < 3)
+        {
+            Console.Error.WriteLine("Usage: compare <before.json> <after.json> [--threshold <percent>]");
+            return 2;
+        }
+
+        double threshold = DefaultThresholdPercent;
+        if (args.Length >= 5 &&
+            string.Equals(args[3], "--threshold", StringComparison.Ordinal) &&
+            double.TryParse(args[4], NumberStyles.Float, CultureInfo.InvariantCulture, out double parsedThreshold))
+        {
+            threshold = parsedThreshold;
+        }
+
+        int regressions;
+        try
+        {
+            regressions = BenchmarkBaselineFile.Compare(
+                BenchmarkBaselineFile.Load(args[1]),
+                BenchmarkBaselineFile.Load(args[2]),
+                threshold,
+                Console.Out);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or InvalidDataException or System.Text.Json.JsonException)
+        {
+            Console.Error.WriteLine($"Benchmark baseline: {ex.Message}");
+            return 2;
+        }
+
+        Console.WriteLine(regressions == 0
+            ? "No regressions."
+            : $"{regressions} regression(s) beyond {threshold.ToString(CultureInfo.InvariantCulture)}% or with new allocations.");
+        return regressions == 0 ? 0 : 1;
+    }
+}
@@ -0,0 +1,54 @@
+using BenchmarkDotNet.Attributes;
+using GlassToKey;
+
+namespace GlassToKey.Core.Benchmarks;
+
+// Touch arrival, per-frame update and lift churn through the engine's open-addressing table,
+// the pattern ProcessFrame drives for every contact on every frame.
+[MemoryDiagnoser]
+public class TouchTableBenchmarks
+{
+    private const int Frames = 256;
+
+    private TouchTable<long> _table;
+
+    [Params(2, 5, 10)]
+    public int Contacts { get; set; }
+
+    [GlobalSetup]
+    public void Setup()
+    {
+        _table = new TouchTable<long>(minimumCapacity: 16);
+    }
+
+    [Benchmark(OperationsPerInvoke = Frames)]
+    public long ContactChurn()
+    {
+        long checksum = 0;
+        uint firstContactId = 1;
+        for (int frame = 0; frame < Frames; frame++)
+        {
+            // Every eighth frame lifts the oldest finger and a new one lands in its place.
+            if ((frame & 7) == 7 && _table.Remove(MakeKey(firstContactId), out long lifted))
+            {
+                checksum += lifted;
+                firstContactId++;
+            }
+
+            for (uint contactId = firstContactId; contactId < firstContactId + (uint)Contacts; contactId++)
+            {
+                ref long value = ref _table.GetOrAddValueRef(MakeKey(contactId), out bool exists);
+                value = exists ? value + 1 : frame;
+            }
+        }
+
+        checksum += _table.Count;
+        _table.RemoveAll();
+        return checksum;
+    }
+
+    private static ulong MakeKey(uint contactId)
+    {
+        return (1ul << 32) | contactId;
+    }
+}
@@ -0,0 +1,168 @@
+using System;
+using System.Diagnostics.Tracing;
+
+namespace GlassToKey;
+
+// EventPipe/ETW provider for the engine and dispatch pipeline. Every event carries only
+// integers so writing one never formats or allocates, and each call site checks IsEnabled
+// first, so with no session attached the cost is a field read. Collect from a live process:
+//   dotnet-trace collect -p <pid> --providers GlassToKey-Engine
+// Enum-valued payloads carry the numeric value of TrackpadSide, IntentMode,
+// DispatchEventKind and DispatchSuppressReason.
+[EventSource(Name = "GlassToKey-Engine")]
+internal sealed class EngineEventSource : EventSource
+{
+    public static readonly EngineEventSource Log = new();
+
+    public static class Keywords
+    {
+        public const EventKeywords Frame = (EventKeywords)0x1;
+        public const EventKeywords Touch = (EventKeywords)0x2;
+        public const EventKeywords Intent = (EventKeywords)0x4;
+        public const EventKeywords Dispatch = (EventKeywords)0x8;
+        public const EventKeywords Queue = (EventKeywords)0x10;
+    }
+
+    public const int FrameProcessedEventId = 1;
+    public const int TouchBeginEventId = 2;
+    public const int TouchEndEventId = 3;
+    public const int IntentTransitionEventId = 4;
+    public const int DispatchEnqueuedEventId = 5;
+    public const int DispatchSuppressedEventId = 6;
+    public const int QueueDropEventId = 7;
+
+    private EngineEventSource()
+    {
+    }
+
+    [NonEvent]
+    public bool IsEnabled(EventKeywords keywords)
+    {
+        return IsEnabled(EventLevel.Informational, keywords);
+    }
+
+    // FrameProcessed fires at the trackpad report rate, so it is only on at Verbose.
+    public bool IsFrameEnabled => IsEnabled(EventLevel.Verbose, Keywords.Frame);
+
+    // QueueDrop is a Warning, so a session collecting only warnings must still see it.
+    public bool IsQueueDropEnabled => IsEnabled(EventLevel.Warning, Keywords.Queue);
+
+    [Event(FrameProcessedEventId, Level = EventLevel.Verbose, Keywords = Keywords.Frame)]
+    public void FrameProcessed(int side, int contactCount, long durationNanoseconds)
+    {
+        WriteInts(FrameProcessedEventId, side, contactCount, durationNanoseconds);
+    }
+
+    [Event(TouchBeginEventId, Level = EventLevel.Informational, Keywords = Keywords.Touch)]
+    public void TouchBegin(int side, int contactId, int bindingIndex)
+    {
+        WriteInts(TouchBeginEventId, side, contactId, bindingIndex);
+    }
+
+    // Cancelled touches (chord source, gesture takeover, reset) dispatch no release action.
+    [Event(TouchEndEventId, Level = EventLevel.Informational, Keywords = Keywords.Touch)]
+    public void TouchEnd(int side, int contactId, bool cancelled, long durationNanoseconds)
+    {
+        WriteInts(TouchEndEventId, side, contactId, cancelled ? 1 : 0, durationNanoseconds);
+    }
+
+    [Event(IntentTransitionEventId, Level = EventLevel.Informational, Keywords = Keywords.Intent)]
+    public void IntentTransition(int from, int to)
+    {
+        WriteInts(IntentTransitionEventId, from, to);
+    }
+
+    [Event(DispatchEnqueuedEventId, Level = EventLevel.Informational, Keywords = Keywords.Dispatch)]
+    public void DispatchEnqueued(int side, int kind, int virtualKey, int mouseButton)
+    {
+        WriteInts(DispatchEnqueuedEventId, side, kind, virtualKey, mouseButton);
+    }
+
+    [Event(DispatchSuppressedEventId, Level = EventLevel.Informational, Keywords = Keywords.Dispatch)]
+    public void DispatchSuppressed(int side, int kind, int virtualKey, int reason)
+    {
+        WriteInts(DispatchSuppressedEventId, side, kind, virtualKey, reason);
+    }
+
+    // Queue 0 is the engine frame ring, 1 the dispatch queue.
+    [Event(QueueDropEventId, Level = EventLevel.Warning, Keywords = Keywords.Queue)]
+    public void QueueDrop(int queue)
+    {
+        WriteInts(QueueDropEventId, queue);
+    }
+
+    // WriteEvent(params object[]) would box every argument; the payload is always a short
+    // run of 32-bit ints, optionally followed by one 64-bit value, described on the stack.
+    [NonEvent]
+    private unsafe void WriteInts(int eventId, int arg1)
+    {
+        EventData* data = stackalloc EventData[1];
+        SetInt(ref data[0], &arg1);
+        WriteEventCore(eventId, 1, data);
+    }
+
+    [NonEvent]
+    private unsafe void WriteInts(int eventId, int arg1, int arg2)
+    {
+        EventData* data = stackalloc EventData[2];
+        SetInt(ref data[0], &arg1);
+        SetInt(ref data[1], &arg2);
+        WriteEventCore(eventId, 2, data);
+    }
+
+    [NonEvent]
+    private unsafe void WriteInts(int eventId, int arg1, int arg2, int arg3)
+    {
+        EventData* data = stackalloc EventData[3];
+        SetInt(ref data[0], &arg1);
+        SetInt(ref data[1], &arg2);
+        SetInt(ref data[2], &arg3);
+        WriteEventCore(eventId, 3, data);
+    }
+
+    [NonEvent]
+    private unsafe void WriteInts(int eventId, int arg1, int arg2, int arg3, int arg4)
+    {
+        EventData* data = stackalloc EventData[4];
+        SetInt(ref data[0], &arg1);
+        SetInt(ref data[1], &arg2);
+        SetInt(ref data[2], &arg3);
+        SetInt(ref data[3], &arg4);
+        WriteEventCore(eventId, 4, data);
+    }
+
+    [NonEvent]
+    private unsafe void WriteInts(int eventId, int arg1, int arg2, long arg3)
+    {
+        EventData* data = stackalloc EventData[3];
+        SetInt(ref data[0], &arg1);
+        SetInt(ref data[1], &arg2);
+        SetLong(ref data[2], &arg3);
+        WriteEventCore(eventId, 3, data);
+    }
+
+    [NonEvent]
+    private unsafe void WriteInts(int eventId, int arg1, int arg2, int arg3, long arg4)
+    {
+        EventData* data = stackalloc EventData[4];
+        SetInt(ref data[0], &arg1);
+        SetInt(ref data[1], &arg2);
+        SetInt(ref data[2], &arg3);
+        SetLong(ref data[3], &arg4);
+        WriteEventCore(eventId, 4, data);
+    }
+
+    [NonEvent]
+    private static unsafe void SetInt(ref EventData data, int* value)
+    {
+        data.DataPointer = (IntPtr)value;
+        data.Size = sizeof(int);
+    }
+
+    [NonEvent]
+    private static unsafe void SetLong(ref EventData data, long* value)
+    {
+        data.DataPointer = (IntPtr)value;
+        data.Size = sizeof(long);
+    }
+}
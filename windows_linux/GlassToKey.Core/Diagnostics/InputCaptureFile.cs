@@ -1,5 +1,7 @@
+using System.Buffers;
 using System.Buffers.Binary;
 using System.IO;
+using System.IO.MemoryMappedFiles;
 using System.Text;
 
 namespace GlassToKey;
@@ -98,66 +100,241 @@ public enum CaptureSideHint : byte
     Right = 2
 }
 
+// Captures are memory-mapped and records are parsed in place: CaptureRecord.Payload points
+// straight into the mapping and stays valid until the reader is disposed. Files too large for
+// a single ReadOnlyMemory (2 GiB) fall back to buffered stream reads, where a payload is only
+// valid until the next TryReadNext.
 public sealed class InputCaptureReader : IDisposable
 {
-    private readonly FileStream _stream;
+    private const int MaxPayloadLength = 64 * 1024;
+
+    private readonly MemoryMappedFile? _mappedFile;
+    private readonly MappedViewMemory? _mappedView;
+    private readonly ReadOnlyMemory<byte> _mapped;
+    private readonly FileStream? _stream;
+    private readonly long _length;
     private byte[] _payloadBuffer = Array.Empty<byte>();
+    private long _position = InputCaptureFile.HeaderSize;
+    private int _nextRecordIndex;
+    private long[]? _recordOffsets;
     private bool _disposed;
 
     public InputCaptureReader(string path)
     {
-        _stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read, 64 * 1024, FileOptions.SequentialScan);
-        if (!InputCaptureFile.TryReadHeader(_stream, out int version, out long qpcFrequency))
+        FileStream stream = new(path, FileMode.Open, FileAccess.Read, FileShare.Read, 64 * 1024, FileOptions.SequentialScan);
+        try
         {
-            throw new InvalidDataException("Capture header is invalid.");
-        }
+            if (!InputCaptureFile.TryReadHeader(stream, out int version, out long qpcFrequency))
+            {
+                throw new InvalidDataException("Capture header is invalid.");
+            }
 
-        if (!InputCaptureFile.IsSupportedReadVersion(version))
+            if (!InputCaptureFile.IsSupportedReadVersion(version))
+            {
+                throw new InvalidDataException($"Capture version {version} is unsupported.");
+            }
+
+            HeaderVersion = version;
+            HeaderQpcFrequency = qpcFrequency;
+            _length = stream.Length;
+            if (_length > int.MaxValue)
+            {
+                _stream = stream;
+                return;
+            }
+
+            _mappedFile = MemoryMappedFile.CreateFromFile(stream, mapName: null, capacity: 0, MemoryMappedFileAccess.Read, HandleInheritability.None, leaveOpen: false);
+            _mappedView = new MappedViewMemory(_mappedFile.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read), (int)_length);
+            _mapped = _mappedView.Memory;
+        }
+        catch
         {
-            throw new InvalidDataException($"Capture version {version} is unsupported.");
+            _mappedView?.Release();
+            _mappedFile?.Dispose();
+            stream.Dispose();
+            throw;
         }
-
-        HeaderVersion = version;
-        HeaderQpcFrequency = qpcFrequency;
     }
 
     public int HeaderVersion { get; }
 
     public long HeaderQpcFrequency { get; }
 
+    public bool IsMemoryMapped => _mappedView != null;
+
+    // Number of complete records; builds the offset index on first use.
+    public int RecordCount => EnsureRecordIndex().Length;
+
+    // Index of the record the next TryReadNext returns.
+    public int NextRecordIndex => _nextRecordIndex;
+
     public bool TryReadNext(out CaptureRecord record)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        bool read = _stream == null
+            ? TryReadMapped(out record)
+            : TryReadStream(out record);
+        if (read)
+        {
+            _nextRecordIndex++;
+        }
+
+        return read;
+    }
+
+    // O(1) once the index exists: the index is one pass over record headers only.
+    public bool TrySeekToRecord(int recordIndex)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        long[] offsets = EnsureRecordIndex();
+        if ((uint)recordIndex > (uint)offsets.Length)
+        {
+            return false;
+        }
+
+        _position = recordIndex == offsets.Length ? _length : offsets[recordIndex];
+        _nextRecordIndex = recordIndex;
+        if (_stream != null)
+        {
+            _stream.Position = _position;
+        }
+
+        return true;
+    }
+
+    public bool TryReadRecord(int recordIndex, out CaptureRecord record)
+    {
+        if (!TrySeekToRecord(recordIndex))
+        {
+            record = default;
+            return false;
+        }
+
+        return TryReadNext(out record);
+    }
+
+    private bool TryReadMapped(out CaptureRecord record)
     {
         record = default;
-        Span<byte> header = stackalloc byte[InputCaptureFile.RecordHeaderSize];
-        int firstByte = _stream.ReadByte();
-        if (firstByte < 0)
+        ReadOnlySpan<byte> data = _mapped.Span;
+        if (_position >= data.Length)
         {
             return false;
         }
 
-        header[0] = (byte)firstByte;
-        if (!TryReadExact(_stream, header.Slice(1)))
+        if (data.Length - _position < InputCaptureFile.RecordHeaderSize)
         {
             throw new InvalidDataException("Capture record header is truncated.");
         }
 
-        int payloadLength = BinaryPrimitives.ReadInt32LittleEndian(header.Slice(0, 4));
-        if (payloadLength < 0 || payloadLength > 64 * 1024)
+        int offset = (int)_position;
+        ReadOnlySpan<byte> header = data.Slice(offset, InputCaptureFile.RecordHeaderSize);
+        int payloadLength = ReadPayloadLength(header);
+        int payloadOffset = offset + InputCaptureFile.RecordHeaderSize;
+        if (data.Length - payloadOffset < payloadLength)
         {
-            throw new InvalidDataException($"Invalid payload length {payloadLength}.");
+            throw new InvalidDataException("Capture record payload is truncated.");
         }
 
+        record = CreateRecord(header, _mapped.Slice(payloadOffset, payloadLength));
+        _position = payloadOffset + payloadLength;
+        return true;
+    }
+
+    private bool TryReadStream(out CaptureRecord record)
+    {
+        record = default;
+        FileStream stream = _stream!;
+        Span<byte> header = stackalloc byte[InputCaptureFile.RecordHeaderSize];
+        int firstByte = stream.ReadByte();
+        if (firstByte < 0)
+        {
+            return false;
+        }
+
+        header[0] = (byte)firstByte;
+        if (!TryReadExact(stream, header.Slice(1)))
+        {
+            throw new InvalidDataException("Capture record header is truncated.");
+        }
+
+        int payloadLength = ReadPayloadLength(header);
         if (_payloadBuffer.Length < payloadLength)
         {
             _payloadBuffer = new byte[payloadLength];
         }
 
-        if (!TryReadExact(_stream, _payloadBuffer.AsSpan(0, payloadLength)))
+        if (!TryReadExact(stream, _payloadBuffer.AsSpan(0, payloadLength)))
         {
             throw new InvalidDataException("Capture record payload is truncated.");
         }
 
-        record = new CaptureRecord(
+        record = CreateRecord(header, new ReadOnlyMemory<byte>(_payloadBuffer, 0, payloadLength));
+        _position = stream.Position;
+        return true;
+    }
+
+    // A truncated tail (a capture still being written, or cut short) is left out of the
+    // index; sequential reads still report it as InvalidDataException.
+    private long[] EnsureRecordIndex()
+    {
+        if (_recordOffsets != null)
+        {
+            return _recordOffsets;
+        }
+
+        List<long> offsets = new();
+        long offset = InputCaptureFile.HeaderSize;
+        Span<byte> header = stackalloc byte[InputCaptureFile.RecordHeaderSize];
+        while (_length - offset >= InputCaptureFile.RecordHeaderSize)
+        {
+            if (_stream == null)
+            {
+                _mapped.Span.Slice((int)offset, InputCaptureFile.RecordHeaderSize).CopyTo(header);
+            }
+            else
+            {
+                _stream.Position = offset;
+                if (!TryReadExact(_stream, header))
+                {
+                    break;
+                }
+            }
+
+            int payloadLength = BinaryPrimitives.ReadInt32LittleEndian(header.Slice(0, 4));
+            long next = offset + InputCaptureFile.RecordHeaderSize + payloadLength;
+            if (payloadLength < 0 || payloadLength > MaxPayloadLength || next > _length)
+            {
+                break;
+            }
+
+            offsets.Add(offset);
+            offset = next;
+        }
+
+        if (_stream != null)
+        {
+            _stream.Position = _position;
+        }
+
+        _recordOffsets = offsets.ToArray();
+        return _recordOffsets;
+    }
+
+    private static int ReadPayloadLength(ReadOnlySpan<byte> header)
+    {
+        int payloadLength = BinaryPrimitives.ReadInt32LittleEndian(header.Slice(0, 4));
+        if (payloadLength < 0 || payloadLength > MaxPayloadLength)
+        {
+            throw new InvalidDataException($"Invalid payload length {payloadLength}.");
+        }
+
+        return payloadLength;
+    }
+
+    private static CaptureRecord CreateRecord(ReadOnlySpan<byte> header, ReadOnlyMemory<byte> payload)
+    {
+        return new CaptureRecord(
             ArrivalQpcTicks: BinaryPrimitives.ReadInt64LittleEndian(header.Slice(4, 8)),
             DeviceIndex: BinaryPrimitives.ReadInt32LittleEndian(header.Slice(12, 4)),
             DeviceHash: BinaryPrimitives.ReadUInt32LittleEndian(header.Slice(16, 4)),
@@ -167,8 +344,7 @@ public sealed class InputCaptureReader : IDisposable
             Usage: BinaryPrimitives.ReadUInt16LittleEndian(header.Slice(30, 2)),
             SideHint: ParseSideHint(header[32]),
             DecoderProfile: ParseDecoderProfile(header[33]),
-            Payload: new ReadOnlyMemory<byte>(_payloadBuffer, 0, payloadLength));
-        return true;
+            Payload: payload);
     }
 
     private static CaptureSideHint ParseSideHint(byte value)
@@ -196,7 +372,9 @@ public sealed class InputCaptureReader : IDisposable
         }
 
         _disposed = true;
-        _stream.Dispose();
+        _mappedView?.Release();
+        _mappedFile?.Dispose();
+        _stream?.Dispose();
     }
 
     private static bool TryReadExact(Stream stream, Span<byte> destination)
@@ -215,4 +393,55 @@ public sealed class InputCaptureReader : IDisposable
 
         return true;
     }
+
+    // Exposes the mapped view as Memory<byte> so payload slices need no copy and no pinning.
+    private sealed unsafe class MappedViewMemory : MemoryManager<byte>
+    {
+        private readonly MemoryMappedViewAccessor _accessor;
+        private readonly byte* _pointer;
+        private readonly int _length;
+        private bool _released;
+
+        public MappedViewMemory(MemoryMappedViewAccessor accessor, int length)
+        {
+            byte* pointer = null;
+            accessor.SafeMemoryMappedViewHandle.AcquirePointer(ref pointer);
+            _accessor = accessor;
+            _pointer = pointer + accessor.PointerOffset;
+            _length = length;
+        }
+
+        public override Span<byte> GetSpan()
+        {
+            ObjectDisposedException.ThrowIf(_released, this);
+            return new Span<byte>(_pointer, _length);
+        }
+
+        public override MemoryHandle Pin(int elementIndex = 0)
+        {
+            ObjectDisposedException.ThrowIf(_released, this);
+            return new MemoryHandle(_pointer + elementIndex);
+        }
+
+        public override void Unpin()
+        {
+        }
+
+        public void Release()
+        {
+            ((IDisposable)this).Dispose();
+        }
+
+        protected override void Dispose(bool disposing)
+        {
+            if (_released)
+            {
+                return;
+            }
+
+            _released = true;
+            _accessor.SafeMemoryMappedViewHandle.ReleasePointer();
+            _accessor.Dispose();
+        }
+    }
 }
@@ -0,0 +1,151 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+namespace GlassToKey;
+
+// Log-linear (HDR-style) latency histogram in nanoseconds: values below 32 ns get exact
+// buckets, every power of two above that is split into 16 sub-buckets, so any reported
+// percentile is within 1/16 of the true value. Record is lock-free and allocation-free and
+// may be called from any number of threads; Snapshot reads the counters without stopping
+// writers, so a snapshot taken under load can be off by the samples in flight.
+public sealed class LatencyHistogram
+{
+    private const int ExactBucketCount = 32;
+    private const int SubBucketBits = 4;
+    private const int SubBucketCount = 1 << SubBucketBits;
+    private const int FirstLogMagnitude = 5;
+    // 2^40 ns is about 18 minutes; anything longer lands in the last bucket.
+    private const int MaxLogMagnitude = 40;
+    private const int BucketCount = ExactBucketCount + ((MaxLogMagnitude - FirstLogMagnitude + 1) * SubBucketCount);
+    private static readonly double s_nanosecondsPerTick = 1_000_000_000.0 / Stopwatch.Frequency;
+
+    private readonly long[] _counts = new long[BucketCount];
+    private long _count;
+    private long _maxNanoseconds;
+
+    public long Count => Volatile.Read(ref _count);
+
+    public void RecordTicks(long elapsedTicks)
+    {
+        RecordNanoseconds(elapsedTicks <= 0 ? 0 : (long)(elapsedTicks * s_nanosecondsPerTick));
+    }
+
+    public void RecordNanoseconds(long nanoseconds)
+    {
+        if (nanoseconds < 0)
+        {
+            nanoseconds = 0;
+        }
+
+        Interlocked.Increment(ref _counts[ResolveBucket(nanoseconds)]);
+        Interlocked.Increment(ref _count);
+        long max = Volatile.Read(ref _maxNanoseconds);
+        while (nanoseconds > max)
+        {
+            long observed = Interlocked.CompareExchange(ref _maxNanoseconds, nanoseconds, max);
+            if (observed == max)
+            {
+                break;
+            }
+
+            max = observed;
+        }
+    }
+
+    public void Reset()
+    {
+        for (int index = 0; index < _counts.Length; index++)
+        {
+            Volatile.Write(ref _counts[index], 0);
+        }
+
+        Volatile.Write(ref _count, 0);
+        Volatile.Write(ref _maxNanoseconds, 0);
+    }
+
+    // Percentiles are reported as the upper edge of their bucket, capped at the observed max.
+    public LatencyHistogramSnapshot Snapshot()
+    {
+        long total = 0;
+        Span<long> counts = stackalloc long[BucketCount];
+        for (int index = 0; index < BucketCount; index++)
+        {
+            counts[index] = Volatile.Read(ref _counts[index]);
+            total += counts[index];
+        }
+
+        long max = Volatile.Read(ref _maxNanoseconds);
+        if (total == 0)
+        {
+            return default;
+        }
+
+        return new LatencyHistogramSnapshot(
+            Count: total,
+            P50Nanoseconds: ValueAtQuantile(counts, total, 0.50, max),
+            P99Nanoseconds: ValueAtQuantile(counts, total, 0.99, max),
+            P999Nanoseconds: ValueAtQuantile(counts, total, 0.999, max),
+            MaxNanoseconds: max);
+    }
+
+    internal static int ResolveBucket(long nanoseconds)
+    {
+        if (nanoseconds < ExactBucketCount)
+        {
+            return (int)nanoseconds;
+        }
+
+        int magnitude = 63 - System.Numerics.BitOperations.LeadingZeroCount((ulong)nanoseconds);
+        if (magnitude > MaxLogMagnitude)
+        {
+            return BucketCount - 1;
+        }
+
+        int subBucket = (int)(nanoseconds >> (magnitude - SubBucketBits)) & (SubBucketCount - 1);
+        return ExactBucketCount + ((magnitude - FirstLogMagnitude) * SubBucketCount) + subBucket;
+    }
+
+    internal static long BucketUpperBound(int bucket)
+    {
+        if (bucket < ExactBucketCount)
+        {
+            return bucket;
+        }
+
+        int offset = bucket - ExactBucketCount;
+        int magnitude = FirstLogMagnitude + (offset / SubBucketCount);
+        long subBucket = offset % SubBucketCount;
+        long width = 1L << (magnitude - SubBucketBits);
+        return (1L << magnitude) + ((subBucket + 1) * width) - 1;
+    }
+
+    private static long ValueAtQuantile(ReadOnlySpan<long> counts, long total, double quantile, long max)
+    {
+        long rank = Math.Max(1, (long)Math.Ceiling(total * quantile));
+        long seen = 0;
+        for (int index = 0; index < counts.Length; index++)
+        {
+            seen += counts[index];
+            if (seen >= rank)
+            {
+                return Math.Min(BucketUpperBound(index), max);
+            }
+        }
+
+        return max;
+    }
+}
+
+public readonly record struct LatencyHistogramSnapshot(
+    long Count,
+    long P50Nanoseconds,
+    long P99Nanoseconds,
+    long P999Nanoseconds,
+    long MaxNanoseconds)
+{
+    public double P50Us => P50Nanoseconds / 1000.0;
+    public double P99Us => P99Nanoseconds / 1000.0;
+    public double P999Us => P999Nanoseconds / 1000.0;
+    public double MaxUs => MaxNanoseconds / 1000.0;
+}
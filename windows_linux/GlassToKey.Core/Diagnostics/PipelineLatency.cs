@@ -0,0 +1,102 @@
+using System;
+using System.Diagnostics;
+
+namespace GlassToKey;
+
+// Stopwatch-domain timestamps a frame collects on its way from the kernel to the virtual
+// output device, carried on the frame envelope and then on each dispatch event it produced.
+// Zero means the stage was not stamped (e.g. replay has no kernel time).
+public readonly record struct PipelineTimestamps(
+    long KernelTicks,
+    long CommitTicks,
+    long DequeueTicks = 0,
+    long ProcessedTicks = 0,
+    long EnqueueTicks = 0,
+    long PumpDequeueTicks = 0);
+
+public enum PipelineLatencyStage
+{
+    // Kernel event time to the reader committing the frame.
+    KernelToReader = 0,
+    // Reader commit to the engine actor dequeuing the frame.
+    EngineQueue = 1,
+    // TouchProcessorCore.ProcessFrame.
+    EngineProcess = 2,
+    // End of ProcessFrame to the dispatch event entering the dispatch queue.
+    DispatchEnqueue = 3,
+    // Dispatch queue wait until the pump dequeues the event.
+    DispatchQueue = 4,
+    // Pump dequeue to the output device write() returning.
+    Output = 5,
+    // Kernel event time to the output device write() returning.
+    EndToEnd = 6
+}
+
+public sealed class PipelineLatencyRecorder
+{
+    public static readonly int StageCount = Enum.GetValues<PipelineLatencyStage>().Length;
+
+    private readonly LatencyHistogram[] _stages;
+    private readonly long _startedTicks;
+
+    public PipelineLatencyRecorder()
+    {
+        _stages = new LatencyHistogram[StageCount];
+        for (int index = 0; index < _stages.Length; index++)
+        {
+            _stages[index] = new LatencyHistogram();
+        }
+
+        _startedTicks = Stopwatch.GetTimestamp();
+    }
+
+    public void Record(PipelineLatencyStage stage, long startTicks, long endTicks)
+    {
+        if (startTicks == 0 || endTicks == 0)
+        {
+            return;
+        }
+
+        _stages[(int)stage].RecordTicks(endTicks - startTicks);
+    }
+
+    // Frame stages known once the engine finished with the frame.
+    public void RecordFrame(in PipelineTimestamps timestamps)
+    {
+        Record(PipelineLatencyStage.KernelToReader, timestamps.KernelTicks, timestamps.CommitTicks);
+        Record(PipelineLatencyStage.EngineQueue, timestamps.CommitTicks, timestamps.DequeueTicks);
+        Record(PipelineLatencyStage.EngineProcess, timestamps.DequeueTicks, timestamps.ProcessedTicks);
+    }
+
+    // Called right after the write() carrying the event's first report, or when Dispatch
+    // returns for dispatchers that cannot time their own output.
+    public void RecordOutput(in PipelineTimestamps timestamps, long writtenTicks)
+    {
+        Record(PipelineLatencyStage.Output, timestamps.PumpDequeueTicks, writtenTicks);
+        Record(PipelineLatencyStage.EndToEnd, timestamps.KernelTicks, writtenTicks);
+    }
+
+    public PipelineLatencySnapshot Snapshot()
+    {
+        LatencyHistogramSnapshot[] stages = new LatencyHistogramSnapshot[_stages.Length];
+        for (int index = 0; index < stages.Length; index++)
+        {
+            stages[index] = _stages[index].Snapshot();
+        }
+
+        return new PipelineLatencySnapshot(stages, Stopwatch.GetTimestamp() - _startedTicks, Stopwatch.Frequency);
+    }
+}
+
+public sealed record PipelineLatencySnapshot(
+    LatencyHistogramSnapshot[] Stages,
+    long RunTicks,
+    long StopwatchFrequency)
+{
+    public static PipelineLatencySnapshot Empty { get; } = new(
+        new LatencyHistogramSnapshot[PipelineLatencyRecorder.StageCount],
+        0,
+        Stopwatch.Frequency);
+
+    public LatencyHistogramSnapshot this[PipelineLatencyStage stage] => Stages[(int)stage];
+}
@@ -72,6 +72,14 @@ public static class AutocorrectDispatchKeyAnalyzer
             0xDE;
     }
 
+    // Boundaries an application may act on immediately (submit, focus change), so they cannot
+    // be erased and retyped by a correction that arrives late.
+    public static bool IsCommittingWordBoundary(in DispatchEvent dispatchEvent)
+    {
+        return dispatchEvent.SemanticAction.PrimaryCode is DispatchSemanticCode.Enter or DispatchSemanticCode.Tab ||
+               dispatchEvent.VirtualKey is VirtualKeyEnter or VirtualKeyTab;
+    }
+
     public static bool IsWordBoundary(DispatchSemanticCode code)
     {
         return code is
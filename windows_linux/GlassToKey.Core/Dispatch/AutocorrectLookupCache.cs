@@ -0,0 +1,203 @@
+using System;
+
+namespace GlassToKey;
+
+internal enum AutocorrectCacheOutcome : byte
+{
+    Lookup,
+    Blacklisted,
+    Override
+}
+
+// Bounded LRU of resolved words keyed by (lowercase word, max edit distance). Lookups take a
+// span, so a hit costs no allocation; only a miss materializes the key string it stores.
+internal sealed class AutocorrectLookupCache
+{
+    private readonly Entry[] _entries;
+    private readonly int[] _buckets;
+    private readonly int _bucketMask;
+    private int _count;
+    private int _head = -1;
+    private int _tail = -1;
+
+    public AutocorrectLookupCache(int capacity)
+    {
+        _entries = new Entry[Math.Max(1, capacity)];
+        int bucketCount = (int)System.Numerics.BitOperations.RoundUpToPowerOf2((uint)_entries.Length * 2);
+        _buckets = new int[bucketCount];
+        _bucketMask = bucketCount - 1;
+    }
+
+    public int Count => _count;
+
+    public int Capacity => _entries.Length;
+
+    public bool TryGet(ReadOnlySpan<char> word, int maxEditDistance, out AutocorrectCacheOutcome outcome, out string? value)
+    {
+        int index = Find(word, maxEditDistance, HashOf(word, maxEditDistance));
+        if (index < 0)
+        {
+            outcome = default;
+            value = null;
+            return false;
+        }
+
+        MoveToFront(index);
+        outcome = _entries[index].Outcome;
+        value = _entries[index].Value;
+        return true;
+    }
+
+    public void Set(string word, int maxEditDistance, AutocorrectCacheOutcome outcome, string? value)
+    {
+        int hash = HashOf(word, maxEditDistance);
+        int index = Find(word, maxEditDistance, hash);
+        if (index >= 0)
+        {
+            _entries[index].Outcome = outcome;
+            _entries[index].Value = value;
+            MoveToFront(index);
+            return;
+        }
+
+        if (_count < _entries.Length)
+        {
+            index = _count++;
+        }
+        else
+        {
+            // Full: recycle the least recently used entry.
+            index = _tail;
+            RemoveFromBucket(index);
+            Unlink(index);
+        }
+
+        ref Entry entry = ref _entries[index];
+        entry.Key = word;
+        entry.MaxEditDistance = maxEditDistance;
+        entry.HashCode = hash;
+        entry.Outcome = outcome;
+        entry.Value = value;
+        int bucket = hash & _bucketMask;
+        entry.NextInBucket = _buckets[bucket] - 1;
+        _buckets[bucket] = index + 1;
+        LinkAtFront(index);
+    }
+
+    public void Clear()
+    {
+        Array.Clear(_entries, 0, _count);
+        Array.Clear(_buckets);
+        _count = 0;
+        _head = -1;
+        _tail = -1;
+    }
+
+    private static int HashOf(ReadOnlySpan<char> word, int maxEditDistance)
+    {
+        return string.GetHashCode(word) ^ (maxEditDistance * 16777619);
+    }
+
+    private int Find(ReadOnlySpan<char> word, int maxEditDistance, int hash)
+    {
+        for (int index = _buckets[hash & _bucketMask] - 1; index >= 0; index = _entries[index].NextInBucket)
+        {
+            ref Entry entry = ref _entries[index];
+            if (entry.HashCode == hash &&
+                entry.MaxEditDistance == maxEditDistance &&
+                word.SequenceEqual(entry.Key))
+            {
+                return index;
+            }
+        }
+
+        return -1;
+    }
+
+    private void RemoveFromBucket(int index)
+    {
+        int bucket = _entries[index].HashCode & _bucketMask;
+        int previous = -1;
+        for (int current = _buckets[bucket] - 1; current >= 0; current = _entries[current].NextInBucket)
+        {
+            if (current != index)
+            {
+                previous = current;
+                continue;
+            }
+
+            if (previous < 0)
+            {
+                _buckets[bucket] = _entries[current].NextInBucket + 1;
+            }
+            else
+            {
+                _entries[previous].NextInBucket = _entries[current].NextInBucket;
+            }
+
+            return;
+        }
+    }
+
+    private void MoveToFront(int index)
+    {
+        if (index == _head)
+        {
+            return;
+        }
+
+        Unlink(index);
+        LinkAtFront(index);
+    }
+
+    private void Unlink(int index)
+    {
+        ref Entry entry = ref _entries[index];
+        if (entry.Previous >= 0)
+        {
+            _entries[entry.Previous].Next = entry.Next;
+        }
+        else
+        {
+            _head = entry.Next;
+        }
+
+        if (entry.Next >= 0)
+        {
+            _entries[entry.Next].Previous = entry.Previous;
+        }
+        else
+        {
+            _tail = entry.Previous;
+        }
+    }
+
+    private void LinkAtFront(int index)
+    {
+        ref Entry entry = ref _entries[index];
+        entry.Previous = -1;
+        entry.Next = _head;
+        if (_head >= 0)
+        {
+            _entries[_head].Previous = index;
+        }
+
+        _head = index;
+        if (_tail < 0)
+        {
+            _tail = index;
+        }
+    }
+
+    private struct Entry
+    {
+        public string Key;
+        public int MaxEditDistance;
+        public int HashCode;
+        public int NextInBucket;
+        public int Previous;
+        public int Next;
+        public AutocorrectCacheOutcome Outcome;
+        public string? Value;
+    }
+}
@@ -0,0 +1,81 @@
+using System;
+using System.Threading;
+
+namespace GlassToKey;
+
+internal readonly record struct AutocorrectLookupRequest(long Id, string TypedLower, int MaxEditDistance);
+
+internal readonly record struct AutocorrectLookupResult(long Id, string? CorrectedLower);
+
+// Runs SymSpell lookups on a dedicated thread so a slow lookup never holds up the dispatch
+// thread. Requests come from one session (single producer); results are polled back by it.
+internal sealed class AutocorrectLookupWorker : IDisposable
+{
+    private const int QueueCapacity = 16;
+
+    private readonly AutocorrectSession.IAutocorrectLexicon _lexicon;
+    private readonly BoundedMpscRing<AutocorrectLookupRequest> _requests = new(QueueCapacity);
+    private readonly BoundedMpscRing<AutocorrectLookupResult> _results = new(QueueCapacity);
+    private readonly Thread _thread;
+    private volatile bool _stopping;
+
+    public AutocorrectLookupWorker(AutocorrectSession.IAutocorrectLexicon lexicon)
+    {
+        _lexicon = lexicon;
+        _thread = new Thread(RunLoop)
+        {
+            IsBackground = true,
+            Name = "GlassToKey.Autocorrect"
+        };
+        _thread.Start();
+    }
+
+    public bool TryPost(in AutocorrectLookupRequest request)
+    {
+        return !_stopping && _requests.TryEnqueue(in request);
+    }
+
+    public bool TryTakeResult(out AutocorrectLookupResult result)
+    {
+        return _results.TryDequeue(out result);
+    }
+
+    public void Dispose()
+    {
+        if (_stopping)
+        {
+            return;
+        }
+
+        _stopping = true;
+        _requests.Wake();
+        _thread.Join();
+        _requests.Dispose();
+        _results.Dispose();
+    }
+
+    private void RunLoop()
+    {
+        while (!_stopping)
+        {
+            if (!_requests.TryDequeue(out AutocorrectLookupRequest request))
+            {
+                _requests.WaitForItem();
+                continue;
+            }
+
+            string? corrected;
+            try
+            {
+                corrected = _lexicon.ResolveCorrection(request.TypedLower, request.MaxEditDistance);
+            }
+            catch
+            {
+                corrected = null;
+            }
+
+            // The result ring is as deep as the request ring, so a result always has a slot.
+            _results.TryEnqueue(new AutocorrectLookupResult(request.Id, corrected));
+        }
+    }
+}
@@ -2,4 +2,11 @@ namespace GlassToKey;
 
 public readonly record struct AutocorrectReplacement(
     int BackspaceCount,
-    string ReplacementText);
+    string ReplacementText)
+{
+    // Set on replacements resolved after the boundary key went out: the boundary key and the
+    // letters typed since (TrailingText) are covered by BackspaceCount and must be retyped.
+    public bool RetypeBoundary { get; init; }
+
+    public string TrailingText { get; init; } = string.Empty;
+}
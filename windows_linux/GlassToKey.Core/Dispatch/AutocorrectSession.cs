@@ -1,11 +1,19 @@
 using System;
 using System.Collections.Generic;
 using System.IO;
-using System.Reflection;
 using System.Text;
+using System.Threading.Tasks;
 
 namespace GlassToKey;
 
+public enum AutocorrectCompletion
+{
+    None,
+    Replaced,
+    // The SymSpell lookup is running on the worker; poll TryTakeDeferredReplacement.
+    Deferred
+}
+
 public sealed class AutocorrectSession : IDisposable
 {
     private const int MinimumWordLength = 3;
@@ -16,19 +24,31 @@ public sealed class AutocorrectSession : IDisposable
     private const int MaxEditDistanceMax = 2;
 
     private readonly IAutocorrectLexicon _lexicon;
-    private readonly StringBuilder _wordBuffer = new(24);
-    private readonly Dictionary<string, string?> _cache = new(StringComparer.Ordinal);
+    private readonly char[] _wordChars = new char[MaximumWordLength];
+    private readonly char[] _lowerChars = new char[MaximumWordLength];
+    private readonly AutocorrectLookupCache _cache = new(CacheCapacity);
     private readonly HashSet<string> _blacklist = new(StringComparer.Ordinal);
     private readonly Dictionary<string, string> _overrides = new(StringComparer.Ordinal);
-    private readonly string[] _wordHistory = new string[WordHistoryCapacity];
+    private readonly char[] _wordHistoryChars = new char[WordHistoryCapacity * MaximumWordLength];
+    private readonly int[] _wordHistoryLengths = new int[WordHistoryCapacity];
+    private AutocorrectLookupWorker? _lookupWorker;
+    private long _lastLookupId;
+    private long _deferredLookupId;
+    private string _deferredTypedWord = string.Empty;
+    private string _deferredCacheKey = string.Empty;
+    private int _deferredMaxEditDistance;
+    private int _wordLength;
+    private bool _deferredResolved;
+    private string? _deferredCorrectedLower;
     private bool _enabled;
     private string _contextKey = string.Empty;
     private string _currentApp = "unknown";
     private string _lastCorrected = "none";
-    private string _bufferSnapshot = string.Empty;
+    // Status strings are built on demand so tracking a key never allocates.
+    private string? _bufferSnapshot = string.Empty;
     private string _skipReason = "idle";
     private string _lastResetSource = "none";
-    private string _wordHistorySnapshot = "<empty>";
+    private string? _wordHistorySnapshot = "<empty>";
     private int _wordHistoryWriteIndex;
     private int _wordHistoryCount;
     private int _maxEditDistance = MaxEditDistanceMax;
@@ -49,8 +69,22 @@ public sealed class AutocorrectSession : IDisposable
         _lexicon = lexicon ?? throw new ArgumentNullException(nameof(lexicon));
     }
 
+    // True from a deferred word boundary until its replacement is taken or the word goes stale.
+    public bool HasDeferredLookup => _deferredLookupId != 0;
+
+    public bool IsEnabled => _enabled;
+
+    // Blocks until the dictionary load started by SetEnabled finishes, for callers such as an
+    // offline replay that must not skip words typed while it loads.
+    public bool EnsureLexiconLoaded()
+    {
+        return _lexicon.EnsureLoaded();
+    }
+
     public void Dispose()
     {
+        _lookupWorker?.Dispose();
+        _lookupWorker = null;
         _lexicon.Unload();
     }
 
@@ -59,7 +93,9 @@ public sealed class AutocorrectSession : IDisposable
         _enabled = enabled;
         if (enabled)
         {
-            _ = _lexicon.EnsureLoaded();
+            // Parsing the dictionary takes long enough to stall key output, so it happens
+            // off the caller's thread; words completed before it finishes are skipped.
+            _lexicon.BeginLoad();
             _skipReason = "enabled";
             return;
         }
@@ -104,7 +140,9 @@ public sealed class AutocorrectSession : IDisposable
 
         if (cacheInvalidated)
         {
+            // A lookup still on the worker was resolved against the old settings.
             _cache.Clear();
+            CancelDeferredLookup("config_changed");
         }
     }
 
@@ -116,7 +154,7 @@ public sealed class AutocorrectSession : IDisposable
             MaxEditDistance: _maxEditDistance,
             CurrentApp: _currentApp,
             LastCorrected: _lastCorrected,
-            CurrentBuffer: _bufferSnapshot,
+            CurrentBuffer: _bufferSnapshot ??= new string(_wordChars, 0, _wordLength),
             SkipReason: _skipReason,
             LastResetSource: _lastResetSource,
             CorrectedCount: _counterCorrected,
@@ -124,7 +162,7 @@ public sealed class AutocorrectSession : IDisposable
             ResetByClickCount: _counterResetByClick,
             ResetByAppChangeCount: _counterResetByAppChange,
             ShortcutBypassCount: _counterShortcutBypass,
-            WordHistory: _wordHistorySnapshot);
+            WordHistory: _wordHistorySnapshot ??= BuildWordHistorySnapshot());
     }
 
     public void UpdateContext(string? contextKey, string? contextLabel)
@@ -161,10 +199,15 @@ public sealed class AutocorrectSession : IDisposable
 
     public void TrackBackspace()
     {
-        if (_wordBuffer.Length > 0)
+        if (_wordLength > 0)
+        {
+            _wordLength--;
+            _bufferSnapshot = null;
+        }
+        else
         {
-            _wordBuffer.Length--;
-            _bufferSnapshot = _wordBuffer.ToString();
+            // Erasing the boundary key invalidates the text a late correction would rewrite.
+            CancelDeferredLookup();
         }
 
         _skipReason = "manual_backspace";
@@ -172,10 +215,14 @@ public sealed class AutocorrectSession : IDisposable
 
     public void TrackLetter(char letter)
     {
-        if (_wordBuffer.Length < MaximumWordLength)
+        if (_wordLength < MaximumWordLength)
         {
-            _wordBuffer.Append(letter);
-            _bufferSnapshot = _wordBuffer.ToString();
+            _wordChars[_wordLength++] = letter;
+            _bufferSnapshot = null;
+        }
+        else
+        {
+            CancelDeferredLookup();
         }
 
         _skipReason = "tracking";
@@ -187,66 +234,232 @@ public sealed class AutocorrectSession : IDisposable
     }
 
     public bool TryCompleteWord(out AutocorrectReplacement replacement)
+    {
+        return CompleteWord(allowDeferred: false, out replacement) == AutocorrectCompletion.Replaced;
+    }
+
+    // With allowDeferred, overrides and cached words still resolve inline but SymSpell lookups
+    // go to the worker thread, and a dictionary that is still loading skips the word instead
+    // of blocking until it is ready.
+    public AutocorrectCompletion CompleteWord(bool allowDeferred, out AutocorrectReplacement replacement)
     {
         replacement = default;
 
-        string typedWord = _wordBuffer.ToString();
+        // A newer boundary supersedes a lookup that has not been applied yet.
+        CancelDeferredLookup();
+
+        ReadOnlySpan<char> typedWord = _wordChars.AsSpan(0, _wordLength);
         if (typedWord.Length == 0)
         {
             _skipReason = "word_empty";
             ResetState();
-            return false;
+            return AutocorrectCompletion.None;
         }
 
         RecordWordHistory(typedWord);
 
-        if (_wordBuffer.Length < MinimumWordLength || _wordBuffer.Length > MaximumWordLength)
+        if (typedWord.Length < MinimumWordLength || typedWord.Length > MaximumWordLength)
         {
             RegisterSkip("word_length");
             ResetState();
-            return false;
+            return AutocorrectCompletion.None;
         }
 
-        if (!_lexicon.EnsureLoaded())
+        if (allowDeferred ? !_lexicon.IsLoaded : !_lexicon.EnsureLoaded())
         {
-            RegisterSkip("dictionary_unavailable");
+            _lexicon.BeginLoad();
+            RegisterSkip(allowDeferred && _lexicon.IsLoading ? "dictionary_loading" : "dictionary_unavailable");
             ResetState();
-            return false;
+            return AutocorrectCompletion.None;
         }
 
-        string typedLower = typedWord.ToLowerInvariant();
-        if (_blacklist.Contains(typedLower))
+        // Cached words (the common case) resolve without allocating; a miss materializes the
+        // lowercase word once and keeps it as the cache key.
+        Span<char> typedLower = _lowerChars.AsSpan(0, typedWord.Length);
+        typedWord.ToLowerInvariant(typedLower);
+        if (!_cache.TryGet(typedLower, _maxEditDistance, out AutocorrectCacheOutcome outcome, out string? correctedLower))
+        {
+            string cacheKey = new(typedLower);
+            if (_blacklist.Contains(cacheKey))
+            {
+                outcome = AutocorrectCacheOutcome.Blacklisted;
+            }
+            else if (_overrides.TryGetValue(cacheKey, out string? overrideCorrection))
+            {
+                outcome = AutocorrectCacheOutcome.Override;
+                correctedLower = overrideCorrection;
+            }
+            else
+            {
+                if (allowDeferred && TryDeferLookup(typedWord, cacheKey))
+                {
+                    _skipReason = "lookup_pending";
+                    ResetState();
+                    return AutocorrectCompletion.Deferred;
+                }
+
+                outcome = AutocorrectCacheOutcome.Lookup;
+                correctedLower = _lexicon.ResolveCorrection(cacheKey, _maxEditDistance);
+            }
+
+            _cache.Set(cacheKey, _maxEditDistance, outcome, correctedLower);
+        }
+
+        if (outcome == AutocorrectCacheOutcome.Blacklisted)
         {
             RegisterSkip("blacklisted");
             ResetState();
+            return AutocorrectCompletion.None;
+        }
+
+        string resolutionSource = outcome == AutocorrectCacheOutcome.Override ? "override" : "symspell";
+        bool replaced = TryBuildReplacement(typedWord, correctedLower, resolutionSource, out replacement);
+        ResetState();
+        return replaced ? AutocorrectCompletion.Replaced : AutocorrectCompletion.None;
+    }
+
+    // Takes the result of a deferred lookup once the worker has produced it. The replacement
+    // also erases the boundary key and the letters typed since, which the caller retypes.
+    public bool TryTakeDeferredReplacement(out AutocorrectReplacement replacement)
+    {
+        replacement = default;
+        if (!PollDeferredLookup())
+        {
             return false;
         }
 
-        string resolutionSource;
-        string? correctedLower;
-        if (_overrides.TryGetValue(typedLower, out string? overrideCorrection))
+        string typedWord = _deferredTypedWord;
+        string cacheKey = _deferredCacheKey;
+        string? correctedLower = _deferredCorrectedLower;
+        int maxEditDistance = _deferredMaxEditDistance;
+        ClearDeferredLookup();
+
+        // The blacklist and overrides may have changed while the worker was busy.
+        AutocorrectCacheOutcome outcome = AutocorrectCacheOutcome.Lookup;
+        if (_blacklist.Contains(cacheKey))
+        {
+            outcome = AutocorrectCacheOutcome.Blacklisted;
+        }
+        else if (_overrides.TryGetValue(cacheKey, out string? overrideCorrection))
         {
+            outcome = AutocorrectCacheOutcome.Override;
             correctedLower = overrideCorrection;
-            resolutionSource = "override";
         }
-        else
+
+        _cache.Set(cacheKey, maxEditDistance, outcome, correctedLower);
+        if (outcome == AutocorrectCacheOutcome.Blacklisted)
+        {
+            RegisterSkip("blacklisted");
+            return false;
+        }
+
+        string resolutionSource = outcome == AutocorrectCacheOutcome.Override ? "override" : "symspell";
+        if (!TryBuildReplacement(typedWord, correctedLower, resolutionSource, out AutocorrectReplacement wordReplacement))
+        {
+            return false;
+        }
+
+        string trailing = new(_wordChars, 0, _wordLength);
+        replacement = new AutocorrectReplacement(wordReplacement.BackspaceCount + 1 + trailing.Length, wordReplacement.ReplacementText)
+        {
+            RetypeBoundary = true,
+            TrailingText = trailing
+        };
+        return true;
+    }
+
+    // True once the worker has answered the pending deferred lookup.
+    public bool PollDeferredLookup()
+    {
+        if (_deferredLookupId == 0)
+        {
+            return false;
+        }
+
+        while (!_deferredResolved && _lookupWorker != null && _lookupWorker.TryTakeResult(out AutocorrectLookupResult result))
+        {
+            // Results for cancelled lookups are dropped here.
+            if (result.Id == _deferredLookupId)
+            {
+                _deferredResolved = true;
+                _deferredCorrectedLower = result.CorrectedLower;
+            }
+        }
+
+        return _deferredResolved;
+    }
+
+    public void CancelDeferredLookup(string reason)
+    {
+        if (_deferredLookupId == 0)
+        {
+            return;
+        }
+
+        ClearDeferredLookup();
+        RegisterSkip(reason);
+    }
+
+    public void ForceReset(string reason)
+    {
+        ResetState(reason);
+    }
+
+    private bool TryDeferLookup(ReadOnlySpan<char> typedWord, string typedLower)
+    {
+        _lookupWorker ??= new AutocorrectLookupWorker(_lexicon);
+        while (_lookupWorker.TryTakeResult(out _))
         {
-            correctedLower = ResolveCorrection(typedLower);
-            resolutionSource = "symspell";
+            // Answers to lookups cancelled before they were polled.
         }
 
+        long id = ++_lastLookupId;
+        if (!_lookupWorker.TryPost(new AutocorrectLookupRequest(id, typedLower, _maxEditDistance)))
+        {
+            return false;
+        }
+
+        _deferredLookupId = id;
+        _deferredTypedWord = new string(typedWord);
+        _deferredCacheKey = typedLower;
+        _deferredMaxEditDistance = _maxEditDistance;
+        _deferredResolved = false;
+        _deferredCorrectedLower = null;
+        return true;
+    }
+
+    private void CancelDeferredLookup()
+    {
+        if (_deferredLookupId != 0)
+        {
+            _counterSkipped++;
+            ClearDeferredLookup();
+        }
+    }
+
+    private void ClearDeferredLookup()
+    {
+        _deferredLookupId = 0;
+        _deferredTypedWord = string.Empty;
+        _deferredCacheKey = string.Empty;
+        _deferredResolved = false;
+        _deferredCorrectedLower = null;
+    }
+
+    private bool TryBuildReplacement(ReadOnlySpan<char> typedChars, string? correctedLower, string resolutionSource, out AutocorrectReplacement replacement)
+    {
+        replacement = default;
         if (string.IsNullOrEmpty(correctedLower))
         {
             RegisterSkip("no_suggestion");
-            ResetState();
             return false;
         }
 
+        string typedWord = new(typedChars);
         string corrected = ApplyWordCasePattern(correctedLower, typedWord);
         if (string.Equals(corrected, typedWord, StringComparison.Ordinal))
         {
             RegisterSkip("already_correct");
-            ResetState();
             return false;
         }
 
@@ -255,7 +468,6 @@ public sealed class AutocorrectSession : IDisposable
             _counterSkipped++;
             _lastCorrected = $"{typedWord} -> {corrected} (dry-run)";
             _skipReason = "dry_run_preview";
-            ResetState();
             return false;
         }
 
@@ -265,42 +477,21 @@ public sealed class AutocorrectSession : IDisposable
             : $"{typedWord} -> {corrected}";
         _skipReason = "corrected";
         replacement = new AutocorrectReplacement(typedWord.Length, corrected);
-        ResetState();
         return true;
     }
 
-    public void ForceReset(string reason)
-    {
-        ResetState(reason);
-    }
-
-    private string? ResolveCorrection(string typedLower)
-    {
-        string cacheKey = $"{_maxEditDistance}:{typedLower}";
-        if (_cache.TryGetValue(cacheKey, out string? cached))
-        {
-            return cached;
-        }
-
-        string? correction = _lexicon.ResolveCorrection(typedLower, _maxEditDistance);
-        if (_cache.Count >= CacheCapacity)
-        {
-            _cache.Clear();
-        }
-
-        _cache[cacheKey] = correction;
-        return correction;
-    }
-
     private void ResetState(string? reason = null)
     {
-        _wordBuffer.Clear();
+        _wordLength = 0;
         _bufferSnapshot = string.Empty;
         if (string.IsNullOrWhiteSpace(reason))
         {
             return;
         }
 
+        // Clicks, app switches and non-word keys move the caret away from the corrected word.
+        CancelDeferredLookup();
+
         _skipReason = reason;
         _lastResetSource = reason;
         if (string.Equals(reason, "pointer_click", StringComparison.Ordinal))
@@ -319,21 +510,22 @@ public sealed class AutocorrectSession : IDisposable
         _skipReason = reason;
     }
 
-    private void RecordWordHistory(string word)
+    private void RecordWordHistory(ReadOnlySpan<char> word)
     {
-        if (string.IsNullOrWhiteSpace(word))
+        if (word.IsWhiteSpace())
         {
             return;
         }
 
-        _wordHistory[_wordHistoryWriteIndex] = word;
-        _wordHistoryWriteIndex = (_wordHistoryWriteIndex + 1) % _wordHistory.Length;
-        if (_wordHistoryCount < _wordHistory.Length)
+        word.CopyTo(_wordHistoryChars.AsSpan(_wordHistoryWriteIndex * MaximumWordLength, MaximumWordLength));
+        _wordHistoryLengths[_wordHistoryWriteIndex] = word.Length;
+        _wordHistoryWriteIndex = (_wordHistoryWriteIndex + 1) % WordHistoryCapacity;
+        if (_wordHistoryCount < WordHistoryCapacity)
         {
             _wordHistoryCount++;
         }
 
-        _wordHistorySnapshot = BuildWordHistorySnapshot();
+        _wordHistorySnapshot = null;
     }
 
     private string BuildWordHistorySnapshot()
@@ -346,13 +538,13 @@ public sealed class AutocorrectSession : IDisposable
         StringBuilder builder = new(capacity: 128);
         for (int i = 0; i < _wordHistoryCount; i++)
         {
-            int index = (_wordHistoryWriteIndex - _wordHistoryCount + i + _wordHistory.Length) % _wordHistory.Length;
+            int index = (_wordHistoryWriteIndex - _wordHistoryCount + i + WordHistoryCapacity) % WordHistoryCapacity;
             if (i > 0)
             {
                 builder.Append(' ');
             }
 
-            builder.Append(_wordHistory[index]);
+            builder.Append(_wordHistoryChars, index * MaximumWordLength, _wordHistoryLengths[index]);
         }
 
         return builder.ToString();
@@ -564,91 +756,197 @@ public sealed class AutocorrectSession : IDisposable
 
     public interface IAutocorrectLexicon
     {
+        bool IsLoaded { get; }
+        bool IsLoading { get; }
+
+        // Starts loading in the background if no load has been attempted yet.
+        void BeginLoad();
+
+        // Blocks until a load attempt finishes.
         bool EnsureLoaded();
-        string? ResolveCorrection(string typedLower, int maxEditDistance);
+
+        // Called from the lookup worker thread. Top-1 correction for an ASCII-lowercase word.
+        string? ResolveCorrection(ReadOnlySpan<char> typedLower, int maxEditDistance);
         void Unload();
     }
 
+    // Prefers the memory-mapped binary index; the in-memory SymSpell is only kept when the
+    // index cannot be written (read-only home, full disk).
     private sealed class SymSpellAutocorrectLexicon : IAutocorrectLexicon
     {
-        private const int SymSpellDictionaryMaxEditDistance = 2;
-        private const int SymSpellPrefixLength = 7;
-        private const int SymSpellDictionaryWordCount = 82765;
-        private const string DictionaryResourceName = "GlassToKey.SymSpell.frequency_dictionary_en_82_765.txt";
+        private readonly object _loadGate = new();
+        private volatile MappedSymSpellIndex? _index;
+        private volatile SymSpell? _symSpell;
+        private Task? _loadTask;
+        private int _loadGeneration;
+
+        public bool IsLoaded => _index != null || _symSpell != null;
+
+        public bool IsLoading
+        {
+            get
+            {
+                lock (_loadGate)
+                {
+                    return _loadTask is { IsCompleted: false };
+                }
+            }
+        }
 
-        private SymSpell? _symSpell;
-        private bool _loadAttempted;
+        public void BeginLoad()
+        {
+            lock (_loadGate)
+            {
+                StartLoadLocked();
+            }
+        }
 
         public bool EnsureLoaded()
         {
-            if (_symSpell != null)
+            if (IsLoaded)
             {
                 return true;
             }
 
-            if (_loadAttempted)
+            Task loadTask;
+            lock (_loadGate)
             {
-                return false;
+                loadTask = StartLoadLocked();
             }
 
-            _loadAttempted = true;
-            _symSpell = CreateSymSpell();
-            return _symSpell != null;
+            // The load task never faults; a failed load simply leaves the lexicon unloaded.
+            loadTask.GetAwaiter().GetResult();
+            return IsLoaded;
         }
 
-        public string? ResolveCorrection(string typedLower, int maxEditDistance)
+        public string? ResolveCorrection(ReadOnlySpan<char> typedLower, int maxEditDistance)
         {
-            if (!EnsureLoaded() || _symSpell == null)
+            string? term;
+            int distance;
+            MappedSymSpellIndex? index = _index;
+            SymSpell? symSpell = _symSpell;
+            if (index != null)
             {
-                return null;
+                // Throws ObjectDisposedException if Unload won the race; the worker maps that to no correction.
+                term = index.LookupTop(typedLower, maxEditDistance, out distance);
             }
-
-            List<SymSpell.SuggestItem> suggestions = _symSpell.Lookup(
-                typedLower,
-                SymSpell.Verbosity.Top,
-                maxEditDistance);
-            if (suggestions.Count == 0)
+            else if (symSpell != null)
+            {
+                List<SymSpell.SuggestItem> suggestions = symSpell.Lookup(
+                    typedLower.ToString(),
+                    SymSpell.Verbosity.Top,
+                    maxEditDistance);
+                term = suggestions.Count == 0 ? null : suggestions[0].term;
+                distance = suggestions.Count == 0 ? -1 : suggestions[0].distance;
+            }
+            else
             {
                 return null;
             }
 
-            SymSpell.SuggestItem suggestion = suggestions[0];
-            if (suggestion.distance <= 0 ||
-                !IsAsciiLetterWord(suggestion.term) ||
-                string.Equals(suggestion.term, typedLower, StringComparison.Ordinal))
+            if (term == null ||
+                distance <= 0 ||
+                !IsAsciiLetterWord(term) ||
+                typedLower.SequenceEqual(term))
             {
                 return null;
             }
 
-            return suggestion.term;
+            return term;
         }
 
         public void Unload()
         {
-            _symSpell = null;
-            _loadAttempted = false;
+            lock (_loadGate)
+            {
+                // A load still running completes into a stale generation and is discarded.
+                _loadGeneration++;
+                _index?.Dispose();
+                _index = null;
+                _symSpell = null;
+                _loadTask = null;
+            }
         }
 
-        private static SymSpell? CreateSymSpell()
+        // One attempt per generation; a failed load is not retried until Unload.
+        private Task StartLoadLocked()
         {
-            try
+            if (_loadTask != null)
+            {
+                return _loadTask;
+            }
+
+            int generation = _loadGeneration;
+            _loadTask = Task.Run(() =>
             {
-                SymSpell symSpell = new(
-                    initialCapacity: SymSpellDictionaryWordCount,
-                    maxDictionaryEditDistance: SymSpellDictionaryMaxEditDistance,
-                    prefixLength: SymSpellPrefixLength);
-                using Stream? stream = Assembly.GetExecutingAssembly().GetManifestResourceStream(DictionaryResourceName);
-                if (stream == null)
+                MappedSymSpellIndex? index;
+                SymSpell? symSpell;
+                try
                 {
-                    return null;
+                    index = LoadIndex(out symSpell);
+                }
+                catch
+                {
+                    // Any load failure (corrupt dictionary, out of memory, ...) means autocorrect
+                    // stays off for this generation rather than faulting the dispatch thread.
+                    return;
+                }
+
+                lock (_loadGate)
+                {
+                    if (generation == _loadGeneration)
+                    {
+                        _index = index;
+                        _symSpell = symSpell;
+                        return;
+                    }
                 }
 
-                return symSpell.LoadDictionary(stream, termIndex: 0, countIndex: 1) ? symSpell : null;
+                index?.Dispose();
+            });
+            return _loadTask;
+        }
+
+        // Maps a prebuilt or cached index; on a miss, builds SymSpell once, writes the cache and
+        // maps that so the built dictionary can be collected.
+        private static MappedSymSpellIndex? LoadIndex(out SymSpell? fallback)
+        {
+            fallback = null;
+            ulong sourceHash = BundledSymSpellIndex.ComputeSourceHash();
+            if (BundledSymSpellIndex.TryOpen(sourceHash, out MappedSymSpellIndex? index))
+            {
+                return index;
             }
-            catch
+
+            SymSpell? symSpell = BundledSymSpellIndex.CreateSymSpell();
+            if (symSpell == null)
             {
                 return null;
             }
+
+            string cachePath = BundledSymSpellIndex.CachePath;
+            try
+            {
+                SymSpellIndexFile.WriteFile(symSpell, sourceHash, cachePath);
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+            {
+                fallback = symSpell;
+                return null;
+            }
+
+            if (MappedSymSpellIndex.TryOpen(
+                    cachePath,
+                    sourceHash,
+                    BundledSymSpellIndex.MaxEditDistance,
+                    BundledSymSpellIndex.PrefixLength,
+                    out index))
+            {
+                return index;
+            }
+
+            fallback = symSpell;
+            return null;
         }
     }
 }
@@ -0,0 +1,82 @@
+using System;
+using System.Diagnostics;
+using System.IO;
+using System.Reflection;
+
+namespace GlassToKey;
+
+internal readonly record struct BundledSymSpellIndexBuild(string Path, SymSpellIndexStats Stats, double BuildMs, double WriteMs);
+
+// The bundled English dictionary and where its binary index lives: a prebuilt copy shipped next
+// to the binaries, else a per-user cache written on first use.
+internal static class BundledSymSpellIndex
+{
+    public const int MaxEditDistance = 2;
+    public const int PrefixLength = 7;
+    public const int DictionaryWordCount = 82765;
+    public const string FileName = "symspell-en-82765.idx";
+    private const string DictionaryResourceName = "GlassToKey.SymSpell.frequency_dictionary_en_82_765.txt";
+
+    public static string PrebuiltPath => Path.Combine(AppContext.BaseDirectory, FileName);
+
+    public static string CachePath => Path.Combine(
+        Environment.GetFolderPath(Environment.SpecialFolder.LocalApplicationData),
+        "GlassToKey",
+        FileName);
+
+    public static Stream? OpenDictionary()
+    {
+        return Assembly.GetExecutingAssembly().GetManifestResourceStream(DictionaryResourceName);
+    }
+
+    public static ulong ComputeSourceHash()
+    {
+        using Stream? stream = OpenDictionary();
+        return stream == null ? 0 : SymSpellIndexFile.ComputeSourceHash(stream, MaxEditDistance, PrefixLength);
+    }
+
+    public static bool TryOpen(ulong sourceHash, out MappedSymSpellIndex? index)
+    {
+        return MappedSymSpellIndex.TryOpen(PrebuiltPath, sourceHash, MaxEditDistance, PrefixLength, out index) ||
+               MappedSymSpellIndex.TryOpen(CachePath, sourceHash, MaxEditDistance, PrefixLength, out index);
+    }
+
+    public static SymSpell? CreateSymSpell()
+    {
+        try
+        {
+            SymSpell symSpell = new(
+                initialCapacity: DictionaryWordCount,
+                maxDictionaryEditDistance: MaxEditDistance,
+                prefixLength: PrefixLength);
+            using Stream? stream = OpenDictionary();
+            if (stream == null)
+            {
+                return null;
+            }
+
+            return symSpell.LoadDictionary(stream, termIndex: 0, countIndex: 1) ? symSpell : null;
+        }
+        catch
+        {
+            return null;
+        }
+    }
+
+    // Build step for packaging (and the first-run cache): rebuilds SymSpell and writes its index.
+    public static BundledSymSpellIndexBuild Build(string path)
+    {
+        ulong sourceHash = ComputeSourceHash();
+        long startTicks = Stopwatch.GetTimestamp();
+        SymSpell symSpell = CreateSymSpell() ??
+            throw new InvalidDataException("The bundled autocorrect dictionary could not be loaded.");
+        long builtTicks = Stopwatch.GetTimestamp();
+        SymSpellIndexStats stats = SymSpellIndexFile.WriteFile(symSpell, sourceHash, path);
+        long writtenTicks = Stopwatch.GetTimestamp();
+        return new BundledSymSpellIndexBuild(
+            path,
+            stats,
+            (builtTicks - startTicks) * 1000.0 / Stopwatch.Frequency,
+            (writtenTicks - builtTicks) * 1000.0 / Stopwatch.Frequency);
+    }
+}
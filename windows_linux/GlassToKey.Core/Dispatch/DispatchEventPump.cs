@@ -6,8 +6,13 @@ namespace GlassToKey;
 
 internal sealed class DispatchEventPump : IDisposable
 {
+    private const int StalledDeadlineWaitMs = 4;
+    private static readonly long StalledDeadlineStepTicks = StalledDeadlineWaitMs * Stopwatch.Frequency / 1000;
+
     private readonly DispatchEventQueue _queue;
     private readonly IInputDispatcher _dispatcher;
+    private readonly PipelineLatencyRecorder? _latency;
+    private readonly bool _dispatcherTimesOutput;
     private readonly Thread _thread;
     private long _dispatchCalls;
     private long _tickCalls;
@@ -18,10 +23,14 @@ internal sealed class DispatchEventPump : IDisposable
     private int _loopExited;
     private bool _disposed;
 
-    public DispatchEventPump(DispatchEventQueue queue, IInputDispatcher dispatcher)
+    // The pump thread waits and ticks in real time, so the dispatcher must be on the system
+    // clock. A dispatcher on a VirtualTimeProvider is driven with RunDueTicks instead.
+    public DispatchEventPump(DispatchEventQueue queue, IInputDispatcher dispatcher, PipelineLatencyRecorder? latency = null)
     {
         _queue = queue;
         _dispatcher = dispatcher;
+        _latency = latency;
+        _dispatcherTimesOutput = dispatcher is IPipelineLatencySink;
         _thread = new Thread(RunLoop)
         {
             IsBackground = true,
@@ -43,57 +52,58 @@ internal sealed class DispatchEventPump : IDisposable
         _dispatcher.Dispose();
     }
 
+    // Sleeps until the next event or the dispatcher's earliest deadline, so tap releases and
+    // repeats fire on time and an idle pump does not wake at all.
     private void RunLoop()
     {
+        bool deadlineStalled = false;
         while (true)
         {
-            bool hasEvent = _queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 4);
+            long deadlineTicks = GetDispatcherDeadlineTicks();
+            int waitMs = ComputeWaitMs(deadlineTicks, Stopwatch.GetTimestamp(), deadlineStalled);
+            bool hasEvent = _queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs);
             long nowTicks = Stopwatch.GetTimestamp();
             if (hasEvent)
             {
-                try
-                {
-                    _dispatcher.Dispatch(in dispatchEvent);
-                    Interlocked.Increment(ref _dispatchCalls);
-                    Volatile.Write(ref _lastDispatchTicks, nowTicks);
-                }
-                catch (Exception ex)
+                if (_latency != null && dispatchEvent.Timestamps.EnqueueTicks != 0)
                 {
-                    Volatile.Write(ref _lastFaultTicks, nowTicks);
-                    Volatile.Write(ref _lastFaultMessage, $"{ex.GetType().Name}: {ex.Message}");
-                    Thread.Sleep(2);
+                    _latency.Record(PipelineLatencyStage.DispatchQueue, dispatchEvent.Timestamps.EnqueueTicks, nowTicks);
+                    dispatchEvent = dispatchEvent with { Timestamps = dispatchEvent.Timestamps with { PumpDequeueTicks = nowTicks } };
                 }
 
                 try
                 {
-                    _dispatcher.Tick(nowTicks);
-                    Interlocked.Increment(ref _tickCalls);
-                    Volatile.Write(ref _lastTickTicks, nowTicks);
+                    _dispatcher.Dispatch(in dispatchEvent);
+                    if (_latency != null && !_dispatcherTimesOutput)
+                    {
+                        // Without a device-level hook, output is done when Dispatch returns.
+                        _latency.RecordOutput(dispatchEvent.Timestamps, Stopwatch.GetTimestamp());
+                    }
+
+                    Interlocked.Increment(ref _dispatchCalls);
+                    Volatile.Write(ref _lastDispatchTicks, nowTicks);
                 }
                 catch (Exception ex)
                 {
-                    Volatile.Write(ref _lastFaultTicks, nowTicks);
-                    Volatile.Write(ref _lastFaultMessage, $"{ex.GetType().Name}: {ex.Message}");
-                    Thread.Sleep(2);
+                    RecordFault(nowTicks, ex);
                 }
-
-                continue;
             }
 
-            try
+            if (hasEvent || nowTicks >= deadlineTicks)
             {
-                _dispatcher.Tick(nowTicks);
-                Interlocked.Increment(ref _tickCalls);
-                Volatile.Write(ref _lastTickTicks, nowTicks);
+                RunTick(nowTicks);
+
+                // A deadline that Tick did not move forward would spin the loop; fall back to
+                // the fixed cadence until the dispatcher reports a future deadline again.
+                deadlineStalled = !hasEvent && GetDispatcherDeadlineTicks() <= nowTicks;
             }
-            catch (Exception ex)
+            else if (waitMs == 0)
             {
-                Volatile.Write(ref _lastFaultTicks, nowTicks);
-                Volatile.Write(ref _lastFaultMessage, $"{ex.GetType().Name}: {ex.Message}");
-                Thread.Sleep(2);
+                // Sub-millisecond remainder before the deadline: a timed wait would overshoot.
+                Thread.Yield();
             }
 
-            if (_queue.IsCompleted && _queue.Count == 0)
+            if (!hasEvent && _queue.IsCompleted && _queue.Count == 0)
             {
                 Volatile.Write(ref _loopExited, 1);
                 return;
@@ -101,6 +111,94 @@ internal sealed class DispatchEventPump : IDisposable
         }
     }
 
+    private void RunTick(long nowTicks)
+    {
+        try
+        {
+            _dispatcher.Tick(nowTicks);
+            Interlocked.Increment(ref _tickCalls);
+            Volatile.Write(ref _lastTickTicks, nowTicks);
+        }
+        catch (Exception ex)
+        {
+            RecordFault(nowTicks, ex);
+        }
+    }
+
+    private long GetDispatcherDeadlineTicks()
+    {
+        try
+        {
+            return _dispatcher.GetNextDeadlineTicks();
+        }
+        catch (Exception ex)
+        {
+            long nowTicks = Stopwatch.GetTimestamp();
+            RecordFault(nowTicks, ex);
+            return nowTicks;
+        }
+    }
+
+    // Simulated-time counterpart of RunLoop's deadline handling: steps the clock to each
+    // dispatcher deadline up to untilTicks and ticks there, then leaves the clock at
+    // untilTicks. A deadline that Tick did not move forward is retried at the pump's fallback
+    // cadence, as RunLoop does. Returns the number of Tick calls.
+    public static int RunDueTicks(IInputDispatcher dispatcher, VirtualTimeProvider clock, long untilTicks)
+    {
+        int tickCalls = 0;
+        long lastTickTicks = long.MinValue;
+        while (true)
+        {
+            long deadlineTicks = dispatcher.GetNextDeadlineTicks();
+            if (lastTickTicks != long.MinValue && deadlineTicks <= lastTickTicks)
+            {
+                deadlineTicks = lastTickTicks + StalledDeadlineStepTicks;
+            }
+
+            if (deadlineTicks > untilTicks)
+            {
+                break;
+            }
+
+            clock.AdvanceTo(deadlineTicks);
+            lastTickTicks = clock.GetTimestamp();
+            dispatcher.Tick(lastTickTicks);
+            tickCalls++;
+        }
+
+        clock.AdvanceTo(untilTicks);
+        return tickCalls;
+    }
+
+    private void RecordFault(long nowTicks, Exception ex)
+    {
+        Volatile.Write(ref _lastFaultTicks, nowTicks);
+        Volatile.Write(ref _lastFaultMessage, $"{ex.GetType().Name}: {ex.Message}");
+        Thread.Sleep(2);
+    }
+
+    private static int ComputeWaitMs(long deadlineTicks, long nowTicks, bool deadlineStalled)
+    {
+        if (deadlineStalled)
+        {
+            return StalledDeadlineWaitMs;
+        }
+
+        if (deadlineTicks == long.MaxValue)
+        {
+            return Timeout.Infinite;
+        }
+
+        long remainingTicks = deadlineTicks - nowTicks;
+        if (remainingTicks <= 0)
+        {
+            return 0;
+        }
+
+        // Round down: waking early costs one more pass, waking late is visible repeat jitter.
+        return (int)Math.Min(int.MaxValue, remainingTicks / (double)Stopwatch.Frequency * 1000.0);
+    }
+
     public DispatchEventPumpDiagnostics Snapshot()
     {
         return new DispatchEventPumpDiagnostics(
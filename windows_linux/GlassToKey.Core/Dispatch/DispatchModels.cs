@@ -205,4 +205,5 @@ public readonly record struct DispatchEvent(
     TrackpadSide Side,
     string DispatchLabel,
     DispatchSemanticAction SemanticAction = default,
-    DispatchRepeatProfile RepeatProfile = default);
+    DispatchRepeatProfile RepeatProfile = default,
+    PipelineTimestamps Timestamps = default);
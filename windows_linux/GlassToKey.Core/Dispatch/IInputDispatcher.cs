@@ -6,6 +6,10 @@ public interface IInputDispatcher : IDisposable
 {
     void Dispatch(in DispatchEvent dispatchEvent);
     void Tick(long nowTicks);
+
+    // Earliest timestamp at which Tick has pending work (tap release, repeat), or
+    // long.MaxValue when Tick only needs to run after the next Dispatch.
+    long GetNextDeadlineTicks();
 }
 
 public readonly record struct InputDispatcherDiagnostics(
@@ -17,7 +21,11 @@ public readonly record struct InputDispatcherDiagnostics(
     int ActiveModifiers,
     long LastDispatchTicks,
     long LastTickTicks,
-    string LastErrorMessage);
+    string LastErrorMessage,
+    // Output batching: flushed reports/bursts, write() syscalls and events those carried.
+    long OutputFlushes = 0,
+    long OutputWriteCalls = 0,
+    long OutputEvents = 0);
 
 public interface IInputDispatcherDiagnosticsProvider
 {
@@ -0,0 +1,8 @@
+namespace GlassToKey;
+
+// Implemented by dispatchers that can time their own output write, so the last pipeline
+// stage is measured at the device rather than when Dispatch returns.
+public interface IPipelineLatencySink
+{
+    void AttachPipelineLatency(PipelineLatencyRecorder recorder);
+}
@@ -0,0 +1,751 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Runtime.InteropServices;
+using Microsoft.Win32.SafeHandles;
+
+namespace GlassToKey;
+
+// Read-only SymSpell dictionary backed by a mapped SymSpellIndexFile. Pages are shared between
+// processes and nothing but the header is touched on open. LookupTop reproduces
+// SymSpell.Lookup(Verbosity.Top) result for result.
+internal sealed unsafe class MappedSymSpellIndex : IDisposable
+{
+    private readonly MemoryMappedFile _file;
+    private readonly MemoryMappedViewAccessor _view;
+    private readonly SafeMemoryMappedViewHandle _viewHandle;
+    private readonly byte* _base;
+    private readonly SymSpellIndexLayout _layout;
+    private readonly int _wordCount;
+    private readonly int _wordSlotCount;
+    private readonly int _deleteSlotCount;
+    private readonly int _suggestionCount;
+    private readonly int _charCount;
+    private readonly string?[] _terms;
+    private int _disposed;
+
+    [ThreadStatic]
+    private static LookupScratch? t_scratch;
+
+    private MappedSymSpellIndex(
+        MemoryMappedFile file,
+        MemoryMappedViewAccessor view,
+        byte* basePointer,
+        in SymSpellIndexHeader header)
+    {
+        _file = file;
+        _view = view;
+        _viewHandle = view.SafeMemoryMappedViewHandle;
+        _base = basePointer;
+        MaxDictionaryEditDistance = header.MaxEditDistance;
+        PrefixLength = header.PrefixLength;
+        MaxWordLength = header.MaxWordLength;
+        CompactMask = header.CompactMask;
+        _wordCount = header.WordCount;
+        _wordSlotCount = header.WordSlotCount;
+        _deleteSlotCount = header.DeleteSlotCount;
+        _suggestionCount = header.SuggestionCount;
+        _charCount = header.CharCount;
+        _layout = SymSpellIndexFile.ComputeLayout(_wordCount, _wordSlotCount, _deleteSlotCount, _suggestionCount, _charCount);
+        _terms = new string?[_wordCount];
+    }
+
+    public int MaxDictionaryEditDistance { get; }
+
+    public int PrefixLength { get; }
+
+    public int MaxWordLength { get; }
+
+    public uint CompactMask { get; }
+
+    public int WordCount => _wordCount;
+
+    public long Length => _layout.Length;
+
+    // Returns false for a missing, stale or malformed file; the caller rebuilds it.
+    public static bool TryOpen(
+        string path,
+        ulong expectedSourceHash,
+        int maxEditDistance,
+        int prefixLength,
+        out MappedSymSpellIndex? index)
+    {
+        index = null;
+        FileStream stream;
+        try
+        {
+            stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.Read | FileShare.Delete);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            return false;
+        }
+
+        long fileLength = stream.Length;
+        if (fileLength < SymSpellIndexFile.HeaderSize)
+        {
+            stream.Dispose();
+            return false;
+        }
+
+        MemoryMappedFile? file = null;
+        MemoryMappedViewAccessor? view = null;
+        byte* basePointer = null;
+        try
+        {
+            file = MemoryMappedFile.CreateFromFile(
+                stream,
+                mapName: null,
+                capacity: 0,
+                MemoryMappedFileAccess.Read,
+                HandleInheritability.None,
+                leaveOpen: false);
+            view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+            view.SafeMemoryMappedViewHandle.AcquirePointer(ref basePointer);
+            basePointer += view.PointerOffset;
+
+            SymSpellIndexHeader header = *(SymSpellIndexHeader*)basePointer;
+            if (!IsUsable(header, fileLength, expectedSourceHash, maxEditDistance, prefixLength))
+            {
+                view.SafeMemoryMappedViewHandle.ReleasePointer();
+                view.Dispose();
+                file.Dispose();
+                return false;
+            }
+
+            index = new MappedSymSpellIndex(file, view, basePointer, header);
+            return true;
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            if (basePointer != null)
+            {
+                view!.SafeMemoryMappedViewHandle.ReleasePointer();
+            }
+
+            view?.Dispose();
+            if (file != null)
+            {
+                file.Dispose();
+            }
+            else
+            {
+                stream.Dispose();
+            }
+
+            return false;
+        }
+    }
+
+    // Top suggestion: smallest edit distance, then highest count. Returns null when nothing is
+    // within maxEditDistance. The view is ref-counted for the duration, so a concurrent Dispose
+    // from another thread defers the unmap instead of pulling pages out from under the lookup.
+    public string? LookupTop(ReadOnlySpan<char> input, int maxEditDistance, out int distance)
+    {
+        if (maxEditDistance > MaxDictionaryEditDistance)
+        {
+            throw new ArgumentOutOfRangeException(nameof(maxEditDistance));
+        }
+
+        bool added = false;
+        _viewHandle.DangerousAddRef(ref added);
+        try
+        {
+            int wordIndex = LookupTopCore(input, maxEditDistance, out distance);
+            if (wordIndex < 0)
+            {
+                return null;
+            }
+
+            // Each term is materialized once, so repeated suggestions do not allocate. Two
+            // threads racing here just build equal strings.
+            return _terms[wordIndex] ??= new string(WordChars(wordIndex));
+        }
+        finally
+        {
+            if (added)
+            {
+                _viewHandle.DangerousRelease();
+            }
+        }
+    }
+
+    public void Dispose()
+    {
+        if (System.Threading.Interlocked.Exchange(ref _disposed, 1) != 0)
+        {
+            return;
+        }
+
+        _viewHandle.ReleasePointer();
+        _view.Dispose();
+        _file.Dispose();
+    }
+
+    private ReadOnlySpan<SymSpellIndexWord> Words => new(_base + _layout.WordsOffset, _wordCount);
+
+    private ReadOnlySpan<int> WordSlots => new(_base + _layout.WordSlotsOffset, _wordSlotCount);
+
+    private ReadOnlySpan<SymSpellIndexDeleteSlot> DeleteSlots => new(_base + _layout.DeleteSlotsOffset, _deleteSlotCount);
+
+    private ReadOnlySpan<int> Suggestions => new(_base + _layout.SuggestionsOffset, _suggestionCount);
+
+    private ReadOnlySpan<char> Chars => new(_base + _layout.CharsOffset, _charCount);
+
+    private ReadOnlySpan<char> WordChars(int wordIndex)
+    {
+        SymSpellIndexWord word = Words[wordIndex];
+        return Chars.Slice(word.CharStart, word.Length);
+    }
+
+    private int FindWord(ReadOnlySpan<char> word)
+    {
+        ReadOnlySpan<int> slots = WordSlots;
+        int mask = _wordSlotCount - 1;
+        int slot = SymSpellIndexFile.SlotOf(SymSpellIndexFile.WordHash(word), _wordSlotCount);
+        // A well-formed table always has a free slot; the cap keeps a corrupt one from spinning.
+        for (int probe = 0; probe < _wordSlotCount; probe++, slot = (slot + 1) & mask)
+        {
+            int entry = slots[slot];
+            if (entry == 0)
+            {
+                return -1;
+            }
+
+            if (WordChars(entry - 1).SequenceEqual(word))
+            {
+                return entry - 1;
+            }
+        }
+
+        return -1;
+    }
+
+    private ReadOnlySpan<int> FindSuggestions(int deleteHash)
+    {
+        ReadOnlySpan<SymSpellIndexDeleteSlot> slots = DeleteSlots;
+        int mask = _deleteSlotCount - 1;
+        int slot = SymSpellIndexFile.SlotOf((uint)deleteHash, _deleteSlotCount);
+        // IsUsable cannot prove the delete table has a free slot without scanning it, so the
+        // probe is capped at one pass over the table.
+        for (int probe = 0; probe < _deleteSlotCount; probe++, slot = (slot + 1) & mask)
+        {
+            SymSpellIndexDeleteSlot entry = slots[slot];
+            if (entry.Count == 0)
+            {
+                return ReadOnlySpan<int>.Empty;
+            }
+
+            if (entry.Hash == deleteHash)
+            {
+                return Suggestions.Slice(entry.Start, entry.Count);
+            }
+        }
+
+        return ReadOnlySpan<int>.Empty;
+    }
+
+    // Port of SymSpell.Lookup for Verbosity.Top; keep the filters in step with the original.
+    // Candidates and the considered-suggestion set live in per-thread scratch, so a lookup
+    // allocates nothing beyond the returned term.
+    private int LookupTopCore(ReadOnlySpan<char> input, int maxEditDistance, out int bestDistance)
+    {
+        bestDistance = -1;
+        int inputLen = input.Length;
+        if (inputLen - maxEditDistance > MaxWordLength)
+        {
+            return -1;
+        }
+
+        int exact = FindWord(input);
+        if (exact >= 0)
+        {
+            bestDistance = 0;
+            return exact;
+        }
+
+        if (maxEditDistance == 0)
+        {
+            return -1;
+        }
+
+        int inputPrefixLen = Math.Min(inputLen, PrefixLength);
+        LookupScratch scratch = t_scratch ??= new LookupScratch();
+        scratch.Begin(PrefixLength, maxEditDistance);
+        scratch.AddCandidate(input.Slice(0, inputPrefixLen));
+
+        ReadOnlySpan<SymSpellIndexWord> words = Words;
+        int maxEditDistance2 = maxEditDistance;
+        int candidatePointer = 0;
+        int best = -1;
+        long bestCount = 0;
+        while (candidatePointer < scratch.CandidateCount)
+        {
+            ReadOnlySpan<char> candidate = scratch.Candidate(candidatePointer++);
+            int candidateLen = candidate.Length;
+            int lengthDiff = inputPrefixLen - candidateLen;
+
+            // Candidates are ordered by delete distance, so none after this can be closer.
+            if (lengthDiff > maxEditDistance2)
+            {
+                break;
+            }
+
+            ReadOnlySpan<int> suggestions = FindSuggestions(SymSpellIndexFile.DeleteHash(candidate, CompactMask));
+            for (int i = 0; i < suggestions.Length; i++)
+            {
+                int suggestionIndex = suggestions[i];
+                ReadOnlySpan<char> suggestion = WordChars(suggestionIndex);
+                int suggestionLen = suggestion.Length;
+                if (Math.Abs(suggestionLen - inputLen) > maxEditDistance2 ||
+                    suggestionLen < candidateLen ||
+                    (suggestionLen == candidateLen && !suggestion.SequenceEqual(candidate)))
+                {
+                    continue;
+                }
+
+                int suggPrefixLen = Math.Min(suggestionLen, PrefixLength);
+                if (suggPrefixLen > inputPrefixLen && (suggPrefixLen - candidateLen) > maxEditDistance2)
+                {
+                    continue;
+                }
+
+                int distance;
+                int min = 0;
+                if (candidateLen == 0)
+                {
+                    distance = Math.Max(inputLen, suggestionLen);
+                    if (distance > maxEditDistance2 || !scratch.AddSuggestion(suggestionIndex))
+                    {
+                        continue;
+                    }
+                }
+                else if (suggestionLen == 1)
+                {
+                    distance = input.IndexOf(suggestion[0]) < 0 ? inputLen : inputLen - 1;
+                    if (distance > maxEditDistance2 || !scratch.AddSuggestion(suggestionIndex))
+                    {
+                        continue;
+                    }
+                }
+                else if ((PrefixLength - maxEditDistance == candidateLen)
+                         && (((min = Math.Min(inputLen, suggestionLen) - PrefixLength) > 1)
+                             && !input.Slice(inputLen + 1 - min).SequenceEqual(suggestion.Slice(suggestionLen + 1 - min)))
+                         || ((min > 0) && (input[inputLen - min] != suggestion[suggestionLen - min])
+                             && ((input[inputLen - min - 1] != suggestion[suggestionLen - min])
+                                 || (input[inputLen - min] != suggestion[suggestionLen - min - 1]))))
+                {
+                    continue;
+                }
+                else
+                {
+                    if (!DeleteInSuggestionPrefix(candidate, suggestion) || !scratch.AddSuggestion(suggestionIndex))
+                    {
+                        continue;
+                    }
+
+                    distance = DamerauOsaDistance(input, suggestion, maxEditDistance2);
+                    if (distance < 0)
+                    {
+                        continue;
+                    }
+                }
+
+                if (distance <= maxEditDistance2)
+                {
+                    long count = words[suggestionIndex].Count;
+                    if (best >= 0 && !(distance < maxEditDistance2 || count > bestCount))
+                    {
+                        continue;
+                    }
+
+                    maxEditDistance2 = distance;
+                    best = suggestionIndex;
+                    bestCount = count;
+                    bestDistance = distance;
+                }
+            }
+
+            if (lengthDiff < maxEditDistance && candidateLen <= PrefixLength)
+            {
+                // Do not create edits with edit distance smaller than suggestions already found.
+                if (lengthDiff >= maxEditDistance2)
+                {
+                    continue;
+                }
+
+                for (int i = 0; i < candidateLen; i++)
+                {
+                    scratch.AddDelete(candidatePointer - 1, i);
+                }
+            }
+        }
+
+        return best;
+    }
+
+    // All delete chars must appear in the suggestion prefix in order; otherwise the bucket
+    // only matched through a hash collision.
+    private bool DeleteInSuggestionPrefix(ReadOnlySpan<char> delete, ReadOnlySpan<char> suggestion)
+    {
+        if (delete.Length == 0)
+        {
+            return true;
+        }
+
+        int suggestionLen = Math.Min(suggestion.Length, PrefixLength);
+        int j = 0;
+        for (int i = 0; i < delete.Length; i++)
+        {
+            char delChar = delete[i];
+            while (j < suggestionLen && delChar != suggestion[j])
+            {
+                j++;
+            }
+
+            if (j == suggestionLen)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // SoftWx DamerauOSA.Distance(string, string, maxDistance) over spans: -1 when the distance
+    // exceeds maxDistance, except that the unbounded path may return a larger value as the
+    // original does.
+    internal static int DamerauOsaDistance(ReadOnlySpan<char> string1, ReadOnlySpan<char> string2, int maxDistance)
+    {
+        if (maxDistance <= 0)
+        {
+            return string1.SequenceEqual(string2) ? 0 : -1;
+        }
+
+        if (string1.Length > string2.Length)
+        {
+            ReadOnlySpan<char> swap = string1;
+            string1 = string2;
+            string2 = swap;
+        }
+
+        if (string2.Length - string1.Length > maxDistance)
+        {
+            return -1;
+        }
+
+        int len2 = string2.Length;
+        int len1 = string1.Length;
+        while (len1 != 0 && string1[len1 - 1] == string2[len2 - 1])
+        {
+            len1--;
+            len2--;
+        }
+
+        int start = 0;
+        while (start != len1 && string1[start] == string2[start])
+        {
+            start++;
+        }
+
+        len1 -= start;
+        len2 -= start;
+        if (len1 == 0)
+        {
+            return len2 <= maxDistance ? len2 : -1;
+        }
+
+        string1 = string1.Slice(start, len1);
+        string2 = string2.Slice(start, len2);
+        Span<int> char1Costs = len2 <= 64 ? stackalloc int[64] : new int[len2];
+        Span<int> prevChar1Costs = len2 <= 64 ? stackalloc int[64] : new int[len2];
+        prevChar1Costs.Clear();
+        return maxDistance < len2
+            ? BoundedOsa(string1, string2, maxDistance, char1Costs, prevChar1Costs)
+            : UnboundedOsa(string1, string2, char1Costs, prevChar1Costs);
+    }
+
+    private static int UnboundedOsa(ReadOnlySpan<char> string1, ReadOnlySpan<char> string2, Span<int> char1Costs, Span<int> prevChar1Costs)
+    {
+        int len1 = string1.Length;
+        int len2 = string2.Length;
+        int j;
+        for (j = 0; j < len2;)
+        {
+            char1Costs[j] = ++j;
+        }
+
+        char char1 = ' ';
+        int currentCost = 0;
+        for (int i = 0; i < len1; ++i)
+        {
+            char prevChar1 = char1;
+            char1 = string1[i];
+            char char2 = ' ';
+            int leftCharCost = i;
+            int aboveCharCost = i;
+            int nextTransCost = 0;
+            for (j = 0; j < len2; ++j)
+            {
+                int thisTransCost = nextTransCost;
+                nextTransCost = prevChar1Costs[j];
+                prevChar1Costs[j] = currentCost = leftCharCost;
+                leftCharCost = char1Costs[j];
+                char prevChar2 = char2;
+                char2 = string2[j];
+                if (char1 != char2)
+                {
+                    if (aboveCharCost < currentCost) currentCost = aboveCharCost;
+                    if (leftCharCost < currentCost) currentCost = leftCharCost;
+                    ++currentCost;
+                    if (i != 0 && j != 0 && char1 == prevChar2 && prevChar1 == char2 && thisTransCost + 1 < currentCost)
+                    {
+                        currentCost = thisTransCost + 1;
+                    }
+                }
+
+                char1Costs[j] = aboveCharCost = currentCost;
+            }
+        }
+
+        return currentCost;
+    }
+
+    private static int BoundedOsa(ReadOnlySpan<char> string1, ReadOnlySpan<char> string2, int maxDistance, Span<int> char1Costs, Span<int> prevChar1Costs)
+    {
+        int len1 = string1.Length;
+        int len2 = string2.Length;
+        int i, j;
+        for (j = 0; j < maxDistance;)
+        {
+            char1Costs[j] = ++j;
+        }
+
+        for (; j < len2;)
+        {
+            char1Costs[j++] = maxDistance + 1;
+        }
+
+        int lenDiff = len2 - len1;
+        int jStartOffset = maxDistance - lenDiff;
+        int jStart = 0;
+        int jEnd = maxDistance;
+        char char1 = ' ';
+        int currentCost = 0;
+        for (i = 0; i < len1; ++i)
+        {
+            char prevChar1 = char1;
+            char1 = string1[i];
+            char char2 = ' ';
+            int leftCharCost = i;
+            int aboveCharCost = i;
+            int nextTransCost = 0;
+            jStart += (i > jStartOffset) ? 1 : 0;
+            jEnd += (jEnd < len2) ? 1 : 0;
+            for (j = jStart; j < jEnd; ++j)
+            {
+                int thisTransCost = nextTransCost;
+                nextTransCost = prevChar1Costs[j];
+                prevChar1Costs[j] = currentCost = leftCharCost;
+                leftCharCost = char1Costs[j];
+                char prevChar2 = char2;
+                char2 = string2[j];
+                if (char1 != char2)
+                {
+                    if (aboveCharCost < currentCost) currentCost = aboveCharCost;
+                    if (leftCharCost < currentCost) currentCost = leftCharCost;
+                    ++currentCost;
+                    if (i != 0 && j != 0 && char1 == prevChar2 && prevChar1 == char2 && thisTransCost + 1 < currentCost)
+                    {
+                        currentCost = thisTransCost + 1;
+                    }
+                }
+
+                char1Costs[j] = aboveCharCost = currentCost;
+            }
+
+            if (char1Costs[i + lenDiff] > maxDistance)
+            {
+                return -1;
+            }
+        }
+
+        return currentCost <= maxDistance ? currentCost : -1;
+    }
+
+    private static bool IsUsable(
+        in SymSpellIndexHeader header,
+        long fileLength,
+        ulong expectedSourceHash,
+        int maxEditDistance,
+        int prefixLength)
+    {
+        if (header.Magic != SymSpellIndexFile.Magic ||
+            header.Version != SymSpellIndexFile.Version ||
+            header.SourceHash != expectedSourceHash ||
+            header.MaxEditDistance != maxEditDistance ||
+            header.PrefixLength != prefixLength ||
+            header.WordCount < 0 ||
+            header.SuggestionCount < 0 ||
+            header.CharCount < 0 ||
+            !IsPowerOfTwo(header.WordSlotCount) ||
+            !IsPowerOfTwo(header.DeleteSlotCount) ||
+            header.WordSlotCount <= header.WordCount)
+        {
+            return false;
+        }
+
+        SymSpellIndexLayout layout = SymSpellIndexFile.ComputeLayout(
+            header.WordCount,
+            header.WordSlotCount,
+            header.DeleteSlotCount,
+            header.SuggestionCount,
+            header.CharCount);
+        return header.Length == layout.Length && layout.Length == fileLength;
+    }
+
+    private static bool IsPowerOfTwo(int value)
+    {
+        return value > 0 && (value & (value - 1)) == 0;
+    }
+}
+
+// Per-thread lookup state. Candidates are the input prefix and its deletes, stored in
+// fixed-width slots; considered suggestions go in an open-addressed set cleared by stamping.
+internal sealed class LookupScratch
+{
+    private char[] _candidateChars = Array.Empty<char>();
+    private int[] _candidateLengths = Array.Empty<int>();
+    private int[] _suggestionKeys = new int[256];
+    private int[] _suggestionStamps = new int[256];
+    private int _slotWidth;
+    private int _stamp;
+    private int _suggestionCount;
+
+    public int CandidateCount { get; private set; }
+
+    public void Begin(int prefixLength, int maxEditDistance)
+    {
+        // At most sum(C(prefixLength, k)) for k <= maxEditDistance distinct candidates.
+        int capacity = 1;
+        int term = 1;
+        for (int k = 1; k <= maxEditDistance; k++)
+        {
+            term = term * (prefixLength - k + 1) / k;
+            capacity += term;
+        }
+
+        // One spare slot: AddDelete builds a delete in place before checking for duplicates.
+        capacity++;
+        if (_slotWidth != prefixLength || _candidateLengths.Length < capacity)
+        {
+            _slotWidth = prefixLength;
+            _candidateChars = new char[capacity * prefixLength];
+            _candidateLengths = new int[capacity];
+        }
+
+        CandidateCount = 0;
+        _suggestionCount = 0;
+        if (++_stamp == int.MaxValue)
+        {
+            Array.Clear(_suggestionStamps);
+            _stamp = 1;
+        }
+    }
+
+    public ReadOnlySpan<char> Candidate(int index)
+    {
+        return _candidateChars.AsSpan(index * _slotWidth, _candidateLengths[index]);
+    }
+
+    public void AddCandidate(ReadOnlySpan<char> candidate)
+    {
+        candidate.CopyTo(_candidateChars.AsSpan(CandidateCount * _slotWidth, _slotWidth));
+        _candidateLengths[CandidateCount++] = candidate.Length;
+    }
+
+    // Adds source with the character at position removed, unless that delete is already queued.
+    public void AddDelete(int source, int position)
+    {
+        ReadOnlySpan<char> parent = Candidate(source);
+        Span<char> slot = _candidateChars.AsSpan(CandidateCount * _slotWidth, _slotWidth);
+        parent.Slice(0, position).CopyTo(slot);
+        parent.Slice(position + 1).CopyTo(slot.Slice(position));
+        ReadOnlySpan<char> delete = slot.Slice(0, parent.Length - 1);
+        for (int index = 0; index < CandidateCount; index++)
+        {
+            if (_candidateLengths[index] == delete.Length && Candidate(index).SequenceEqual(delete))
+            {
+                return;
+            }
+        }
+
+        _candidateLengths[CandidateCount++] = delete.Length;
+    }
+
+    public bool AddSuggestion(int wordIndex)
+    {
+        if ((_suggestionCount + 1) * 2 > _suggestionKeys.Length)
+        {
+            Grow();
+        }
+
+        int mask = _suggestionKeys.Length - 1;
+        int slot = SymSpellIndexFile.SlotOf((uint)wordIndex, _suggestionKeys.Length);
+        for (int probe = 0; probe < _suggestionKeys.Length; probe++, slot = (slot + 1) & mask)
+        {
+            if (_suggestionStamps[slot] != _stamp)
+            {
+                _suggestionStamps[slot] = _stamp;
+                _suggestionKeys[slot] = wordIndex;
+                _suggestionCount++;
+                return true;
+            }
+
+            if (_suggestionKeys[slot] == wordIndex)
+            {
+                return false;
+            }
+        }
+
+        // Unreachable while Grow keeps the set at most half full.
+        Grow();
+        return AddSuggestion(wordIndex);
+    }
+
+    private void Grow()
+    {
+        int[] oldKeys = _suggestionKeys;
+        int[] oldStamps = _suggestionStamps;
+        int oldStamp = _stamp;
+        _suggestionKeys = new int[oldKeys.Length * 2];
+        _suggestionStamps = new int[oldKeys.Length * 2];
+        _stamp = 1;
+        _suggestionCount = 0;
+        for (int slot = 0; slot < oldKeys.Length; slot++)
+        {
+            if (oldStamps[slot] == oldStamp)
+            {
+                AddSuggestion(oldKeys[slot]);
+            }
+        }
+    }
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 4)]
+internal readonly struct SymSpellIndexHeader
+{
+    public readonly ulong Magic;
+    public readonly int Version;
+    public readonly int MaxEditDistance;
+    public readonly int PrefixLength;
+    public readonly int MaxWordLength;
+    public readonly uint CompactMask;
+    public readonly int WordCount;
+    public readonly int WordSlotCount;
+    public readonly int DeleteSlotCount;
+    public readonly int SuggestionCount;
+    public readonly int CharCount;
+    public readonly ulong SourceHash;
+    public readonly long Length;
+}
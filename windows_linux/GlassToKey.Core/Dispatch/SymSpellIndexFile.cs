@@ -0,0 +1,255 @@
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Numerics;
+using System.Runtime.InteropServices;
+
+namespace GlassToKey;
+
+// Flat little-endian image of a built SymSpell dictionary so it can be memory-mapped instead of
+// rebuilt. Layout: 64-byte header, word records, word hash slots, delete hash slots, suggestion
+// lists (word indices in SymSpell order) and one UTF-16 string pool.
+internal static class SymSpellIndexFile
+{
+    public const ulong Magic = 0x3158495353324B47UL; // "G2KSSIX1"
+    public const int Version = 1;
+    public const int HeaderSize = 64;
+
+    public static SymSpellIndexLayout ComputeLayout(
+        int wordCount,
+        int wordSlotCount,
+        int deleteSlotCount,
+        int suggestionCount,
+        int charCount)
+    {
+        long wordsOffset = HeaderSize;
+        long wordSlotsOffset = wordsOffset + ((long)wordCount * Marshal.SizeOf<SymSpellIndexWord>());
+        long deleteSlotsOffset = wordSlotsOffset + ((long)wordSlotCount * sizeof(int));
+        long suggestionsOffset = deleteSlotsOffset + ((long)deleteSlotCount * Marshal.SizeOf<SymSpellIndexDeleteSlot>());
+        long charsOffset = suggestionsOffset + ((long)suggestionCount * sizeof(int));
+        long length = charsOffset + ((long)charCount * sizeof(char));
+        return new SymSpellIndexLayout(wordsOffset, wordSlotsOffset, deleteSlotsOffset, suggestionsOffset, charsOffset, length);
+    }
+
+    // Hash-table slot for a 32-bit hash; SymSpell delete hashes keep their length bits low, so
+    // they are mixed before masking.
+    public static int SlotOf(uint hash, int slotCount)
+    {
+        return (int)(((hash * 0x9E3779B1u) ^ (hash >> 16)) & (uint)(slotCount - 1));
+    }
+
+    public static uint WordHash(ReadOnlySpan<char> word)
+    {
+        uint hash = 2166136261;
+        for (int index = 0; index < word.Length; index++)
+        {
+            hash ^= word[index];
+            hash *= 16777619;
+        }
+
+        return hash;
+    }
+
+    // Same hash SymSpell keys its deletes dictionary with.
+    public static int DeleteHash(ReadOnlySpan<char> delete, uint compactMask)
+    {
+        uint hash = WordHash(delete);
+        hash &= compactMask;
+        hash |= (uint)Math.Min(delete.Length, 3);
+        return (int)hash;
+    }
+
+    public static ulong ComputeSourceHash(Stream source, int maxEditDistance, int prefixLength)
+    {
+        ulong hash = 14695981039346656037UL;
+        hash = (hash ^ (uint)maxEditDistance) * 1099511628211UL;
+        hash = (hash ^ (uint)prefixLength) * 1099511628211UL;
+        byte[] buffer = new byte[64 * 1024];
+        int read;
+        while ((read = source.Read(buffer, 0, buffer.Length)) > 0)
+        {
+            for (int index = 0; index < read; index++)
+            {
+                hash = (hash ^ buffer[index]) * 1099511628211UL;
+            }
+        }
+
+        return hash;
+    }
+
+    public static SymSpellIndexStats Write(SymSpell symSpell, ulong sourceHash, Stream output)
+    {
+        IReadOnlyDictionary<string, long> words = symSpell.Words;
+        IReadOnlyDictionary<int, string[]> deletes = symSpell.Deletes;
+
+        Dictionary<string, int> wordIndices = new(words.Count, StringComparer.Ordinal);
+        SymSpellIndexWord[] wordRecords = new SymSpellIndexWord[words.Count];
+        List<char> chars = new(words.Count * 8);
+        foreach ((string word, long count) in words)
+        {
+            int wordIndex = wordIndices.Count;
+            wordIndices.Add(word, wordIndex);
+            wordRecords[wordIndex] = new SymSpellIndexWord(chars.Count, word.Length, count);
+            foreach (char c in word)
+            {
+                chars.Add(c);
+            }
+        }
+
+        // Open addressing at a load factor of at most 2/3.
+        int wordSlotCount = SlotCountFor(words.Count);
+        int[] wordSlots = new int[wordSlotCount];
+        foreach ((string word, int wordIndex) in wordIndices)
+        {
+            int slot = SlotOf(WordHash(word), wordSlotCount);
+            while (wordSlots[slot] != 0)
+            {
+                slot = (slot + 1) & (wordSlotCount - 1);
+            }
+
+            wordSlots[slot] = wordIndex + 1;
+        }
+
+        int deleteSlotCount = SlotCountFor(deletes.Count);
+        SymSpellIndexDeleteSlot[] deleteSlots = new SymSpellIndexDeleteSlot[deleteSlotCount];
+        List<int> suggestions = new(deletes.Count * 2);
+        foreach ((int hash, string[] suggestionWords) in deletes)
+        {
+            // Empty slots have a zero count; SymSpell never stores an empty suggestion list.
+            int slot = SlotOf((uint)hash, deleteSlotCount);
+            while (deleteSlots[slot].Count != 0)
+            {
+                slot = (slot + 1) & (deleteSlotCount - 1);
+            }
+
+            deleteSlots[slot] = new SymSpellIndexDeleteSlot(hash, suggestions.Count, suggestionWords.Length);
+            foreach (string suggestion in suggestionWords)
+            {
+                suggestions.Add(wordIndices[suggestion]);
+            }
+        }
+
+        SymSpellIndexLayout layout = ComputeLayout(wordRecords.Length, wordSlotCount, deleteSlotCount, suggestions.Count, chars.Count);
+        using BinaryWriter writer = new(output, System.Text.Encoding.UTF8, leaveOpen: true);
+        writer.Write(Magic);
+        writer.Write(Version);
+        writer.Write(symSpell.MaxDictionaryEditDistance);
+        writer.Write(symSpell.PrefixLength);
+        writer.Write(symSpell.MaxLength);
+        writer.Write(symSpell.CompactMask);
+        writer.Write(wordRecords.Length);
+        writer.Write(wordSlotCount);
+        writer.Write(deleteSlotCount);
+        writer.Write(suggestions.Count);
+        writer.Write(chars.Count);
+        writer.Write(sourceHash);
+        writer.Write(layout.Length);
+
+        foreach (SymSpellIndexWord record in wordRecords)
+        {
+            writer.Write(record.CharStart);
+            writer.Write(record.Length);
+            writer.Write(record.Count);
+        }
+
+        foreach (int slot in wordSlots)
+        {
+            writer.Write(slot);
+        }
+
+        foreach (SymSpellIndexDeleteSlot slot in deleteSlots)
+        {
+            writer.Write(slot.Hash);
+            writer.Write(slot.Start);
+            writer.Write(slot.Count);
+        }
+
+        foreach (int suggestion in suggestions)
+        {
+            writer.Write(suggestion);
+        }
+
+        // BinaryWriter.Write(char) encodes; the pool is raw UTF-16 so it can be read in place.
+        foreach (char c in chars)
+        {
+            writer.Write((ushort)c);
+        }
+
+        writer.Flush();
+        return new SymSpellIndexStats(wordRecords.Length, deletes.Count, suggestions.Count, layout.Length);
+    }
+
+    // Writes next to the target and renames over it, so a reader never maps a partial file.
+    public static SymSpellIndexStats WriteFile(SymSpell symSpell, ulong sourceHash, string path)
+    {
+        string? directory = Path.GetDirectoryName(path);
+        if (!string.IsNullOrWhiteSpace(directory))
+        {
+            Directory.CreateDirectory(directory);
+        }
+
+        string tempPath = $"{path}.{Environment.ProcessId}.tmp";
+        try
+        {
+            SymSpellIndexStats stats;
+            using (FileStream stream = new(tempPath, FileMode.Create, FileAccess.Write, FileShare.None, bufferSize: 1 << 16))
+            {
+                stats = Write(symSpell, sourceHash, stream);
+                stream.Flush(flushToDisk: true);
+            }
+
+            File.Move(tempPath, path, overwrite: true);
+            return stats;
+        }
+        catch
+        {
+            File.Delete(tempPath);
+            throw;
+        }
+    }
+
+    private static int SlotCountFor(int entries)
+    {
+        return (int)BitOperations.RoundUpToPowerOf2((uint)Math.Max(2, entries + (entries / 2) + 1));
+    }
+}
+
+internal readonly record struct SymSpellIndexLayout(
+    long WordsOffset,
+    long WordSlotsOffset,
+    long DeleteSlotsOffset,
+    long SuggestionsOffset,
+    long CharsOffset,
+    long Length);
+
+internal readonly record struct SymSpellIndexStats(int Words, int Deletes, int Suggestions, long Bytes);
+
+[StructLayout(LayoutKind.Sequential)]
+internal readonly struct SymSpellIndexWord
+{
+    public readonly int CharStart;
+    public readonly int Length;
+    public readonly long Count;
+
+    public SymSpellIndexWord(int charStart, int length, long count)
+    {
+        CharStart = charStart;
+        Length = length;
+        Count = count;
+    }
+}
+
+[StructLayout(LayoutKind.Sequential)]
+internal readonly struct SymSpellIndexDeleteSlot
+{
+    public readonly int Hash;
+    public readonly int Start;
+    public readonly int Count;
+
+    public SymSpellIndexDeleteSlot(int hash, int start, int count)
+    {
+        Hash = hash;
+        Start = start;
+        Count = count;
+    }
+}
@@ -1,30 +1,60 @@
 using System;
 using System.Collections.Generic;
 using System.Globalization;
+using System.Numerics;
+using System.Runtime.InteropServices;
+using System.Runtime.Intrinsics;
 
 namespace GlassToKey;
 
+// Hit geometry is stored per bucket slot rather than per binding: every bucket's candidates
+// are copied into one contiguous structure-of-arrays run, padded to a multiple of four lanes
+// with never-matching sentinels, so HitTest scores 4-8 keys per step with plain vector loads.
 internal sealed class BindingIndex
 {
-    private readonly int[][] _buckets;
-    private readonly KeyHitGeometry[] _geometries;
-
-    public BindingIndex(
-        EngineKeyBinding[] bindings,
-        KeyHitGeometry[] geometries,
-        int bucketRows,
-        int bucketColumns,
-        int[][] buckets,
+    private const int SlotAlignment = 4;
+    private const float ScoreTieEpsilon = 1e-6f;
+
+    private readonly int[] _bucketStarts;
+    private readonly int[] _slotBindings;
+    private readonly float[] _slotCenterX;
+    private readonly float[] _slotCenterY;
+    private readonly float[] _slotHalfWidth;
+    private readonly float[] _slotHalfHeight;
+    private readonly float[] _slotCos;
+    private readonly float[] _slotSin;
+    private readonly float[] _slotArea;
+
+    private BindingIndex(
+        EngineKeyBinding[] bindings,
+        int bucketRows,
+        int bucketColumns,
+        int[] bucketStarts,
+        int[] slotBindings,
+        float[] slotCenterX,
+        float[] slotCenterY,
+        float[] slotHalfWidth,
+        float[] slotHalfHeight,
+        float[] slotCos,
+        float[] slotSin,
+        float[] slotArea,
         int[] snapBindingIndices,
         float[] snapCentersX,
         float[] snapCentersY,
         float[] snapRadiusSq)
-    {
-        Bindings = bindings;
-        _geometries = geometries;
-        BucketRows = bucketRows;
-        BucketColumns = bucketColumns;
-        _buckets = buckets;
+    {
+        Bindings = bindings;
+        BucketRows = bucketRows;
+        BucketColumns = bucketColumns;
+        _bucketStarts = bucketStarts;
+        _slotBindings = slotBindings;
+        _slotCenterX = slotCenterX;
+        _slotCenterY = slotCenterY;
+        _slotHalfWidth = slotHalfWidth;
+        _slotHalfHeight = slotHalfHeight;
+        _slotCos = slotCos;
+        _slotSin = slotSin;
+        _slotArea = slotArea;
         SnapBindingIndices = snapBindingIndices;
         SnapCentersX = snapCentersX;
         SnapCentersY = snapCentersY;
@@ -38,38 +68,149 @@ internal sealed class BindingIndex
     public float[] SnapCentersX { get; }
     public float[] SnapCentersY { get; }
     public float[] SnapRadiusSq { get; }
+    public int SlotCount => _slotBindings.Length;
 
+    // Deepest containing key wins (largest distance to its nearest edge); near-ties go to the
+    // smaller key, then to the earlier candidate.
     public EngineBindingHit HitTest(double normalizedX, double normalizedY)
     {
-        int row = BucketIndex(normalizedY, BucketRows);
-        int col = BucketIndex(normalizedX, BucketColumns);
-        int bucket = row * BucketColumns + col;
-        int[] candidates = _buckets[bucket];
+        return HitTest(normalizedX, normalizedY, allowVectorized: true);
+    }
+
+    internal EngineBindingHit HitTest(double normalizedX, double normalizedY, bool allowVectorized)
+    {
+        int bucket = (BucketIndex(normalizedY, BucketRows) * BucketColumns) + BucketIndex(normalizedX, BucketColumns);
+        int slot = _bucketStarts[bucket];
+        int end = _bucketStarts[bucket + 1];
+        float x = (float)normalizedX;
+        float y = (float)normalizedY;
         int best = -1;
-        double bestScore = double.NegativeInfinity;
-        double bestArea = double.PositiveInfinity;
-        for (int i = 0; i < candidates.Length; i++)
-        {
-            int index = candidates[i];
-            KeyHitGeometry geometry = _geometries[index];
-            if (!geometry.Contains(normalizedX, normalizedY))
-            {
-                continue;
-            }
-
-            double score = geometry.DistanceToEdge(normalizedX, normalizedY);
-            double area = geometry.Area;
-            if (score > bestScore || (Math.Abs(score - bestScore) < 1e-9 && area < bestArea))
+        float bestScore = float.NegativeInfinity;
+        float bestArea = float.PositiveInfinity;
+
+        if (allowVectorized && Vector256.IsHardwareAccelerated)
+        {
+            Vector256<float> x8 = Vector256.Create(x);
+            Vector256<float> y8 = Vector256.Create(y);
+            for (; slot + Vector256<float>.Count <= end; slot += Vector256<float>.Count)
+            {
+                Vector256<float> scores = ScoreSlots(x8, y8, slot);
+                uint hits = Vector256.GreaterThanOrEqual(scores, Vector256<float>.Zero).ExtractMostSignificantBits();
+                if (hits != 0)
+                {
+                    SelectHits(hits, slot, scores.GetLower(), scores.GetUpper(), ref best, ref bestScore, ref bestArea);
+                }
+            }
+        }
+
+        if (allowVectorized && Vector128.IsHardwareAccelerated)
+        {
+            Vector128<float> x4 = Vector128.Create(x);
+            Vector128<float> y4 = Vector128.Create(y);
+            for (; slot < end; slot += Vector128<float>.Count)
             {
-                best = index;
-                bestScore = score;
-                bestArea = area;
+                Vector128<float> scores = ScoreSlots(x4, y4, slot);
+                uint hits = Vector128.GreaterThanOrEqual(scores, Vector128<float>.Zero).ExtractMostSignificantBits();
+                if (hits != 0)
+                {
+                    SelectHits(hits, slot, scores, Vector128<float>.Zero, ref best, ref bestScore, ref bestArea);
+                }
+            }
+        }
+
+        for (; slot < end; slot++)
+        {
+            float score = ScoreSlot(x, y, slot);
+            if (score >= 0)
+            {
+                Consider(slot, score, ref best, ref bestScore, ref bestArea);
             }
         }
 
         return best >= 0 ? new EngineBindingHit(true, best) : EngineBindingHit.Miss;
     }
 
+    // Signed distance to the nearest edge in key-local space; >= 0 means the point is inside.
+    private Vector256<float> ScoreSlots(Vector256<float> x, Vector256<float> y, int slot)
+    {
+        Vector256<float> translatedX = x - Load256(_slotCenterX, slot);
+        Vector256<float> translatedY = y - Load256(_slotCenterY, slot);
+        Vector256<float> cos = Load256(_slotCos, slot);
+        Vector256<float> sin = Load256(_slotSin, slot);
+        Vector256<float> localX = (translatedX * cos) - (translatedY * sin);
+        Vector256<float> localY = (translatedX * sin) + (translatedY * cos);
+        return Vector256.Min(
+            Load256(_slotHalfWidth, slot) - Vector256.Abs(localX),
+            Load256(_slotHalfHeight, slot) - Vector256.Abs(localY));
+    }
+
+    private Vector128<float> ScoreSlots(Vector128<float> x, Vector128<float> y, int slot)
+    {
+        Vector128<float> translatedX = x - Load128(_slotCenterX, slot);
+        Vector128<float> translatedY = y - Load128(_slotCenterY, slot);
+        Vector128<float> cos = Load128(_slotCos, slot);
+        Vector128<float> sin = Load128(_slotSin, slot);
+        Vector128<float> localX = (translatedX * cos) - (translatedY * sin);
+        Vector128<float> localY = (translatedX * sin) + (translatedY * cos);
+        return Vector128.Min(
+            Load128(_slotHalfWidth, slot) - Vector128.Abs(localX),
+            Load128(_slotHalfHeight, slot) - Vector128.Abs(localY));
+    }
+
+    private float ScoreSlot(float x, float y, int slot)
+    {
+        float translatedX = x - _slotCenterX[slot];
+        float translatedY = y - _slotCenterY[slot];
+        float cos = _slotCos[slot];
+        float sin = _slotSin[slot];
+        float localX = (translatedX * cos) - (translatedY * sin);
+        float localY = (translatedX * sin) + (translatedY * cos);
+        return MathF.Min(_slotHalfWidth[slot] - MathF.Abs(localX), _slotHalfHeight[slot] - MathF.Abs(localY));
+    }
+
+    // Walks hit lanes in slot order so ties resolve exactly as a scalar scan would.
+    private void SelectHits(
+        uint hits,
+        int slot,
+        Vector128<float> lowerScores,
+        Vector128<float> upperScores,
+        ref int best,
+        ref float bestScore,
+        ref float bestArea)
+    {
+        while (hits != 0)
+        {
+            int lane = BitOperations.TrailingZeroCount(hits);
+            hits &= hits - 1;
+            float score = lane < Vector128<float>.Count
+                ? lowerScores.GetElement(lane)
+                : upperScores.GetElement(lane - Vector128<float>.Count);
+            Consider(slot + lane, score, ref best, ref bestScore, ref bestArea);
+        }
+    }
+
+    private void Consider(int slot, float score, ref int best, ref float bestScore, ref float bestArea)
+    {
+        float area = _slotArea[slot];
+        if (score > bestScore + ScoreTieEpsilon ||
+            (MathF.Abs(score - bestScore) <= ScoreTieEpsilon && area < bestArea))
+        {
+            best = _slotBindings[slot];
+            bestScore = score;
+            bestArea = area;
+        }
+    }
+
+    private static Vector256<float> Load256(float[] values, int slot)
+    {
+        return Vector256.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(values), (nuint)slot);
+    }
+
+    private static Vector128<float> Load128(float[] values, int slot)
+    {
+        return Vector128.LoadUnsafe(ref MemoryMarshal.GetArrayDataReference(values), (nuint)slot);
+    }
+
     public static BindingIndex Build(
         KeyLayout layout,
         TrackpadSide side,
@@ -83,9 +224,9 @@ internal sealed class BindingIndex
         int rows = layout.Rects.Length;
         IReadOnlyList<CustomButton> customButtons = keymap.ResolveCustomButtons(layer, side);
         int estimated = (rows == 0 ? 0 : rows * layout.Rects[0].Length) + customButtons.Count;
-        EngineKeyBinding[] bindings = new EngineKeyBinding[estimated];
-        KeyHitGeometry[] geometries = new KeyHitGeometry[estimated];
-        int[] snapBindingIndices = new int[estimated];
+        EngineKeyBinding[] bindings = new EngineKeyBinding[estimated];
+        KeyHitGeometry[] geometries = new KeyHitGeometry[estimated];
+        int[] snapBindingIndices = new int[estimated];
         float[] snapCentersX = new float[estimated];
         float[] snapCentersY = new float[estimated];
         float[] snapRadiusSq = new float[estimated];
@@ -189,11 +330,11 @@ internal sealed class BindingIndex
 
         for (int i = 0; i < bindings.Length; i++)
         {
-            KeyHitGeometry geometry = geometries[i];
-            int minRow = BucketIndex(geometry.MinY, bucketRows);
-            int maxRow = BucketIndex(geometry.MaxY, bucketRows);
-            int minCol = BucketIndex(geometry.MinX, bucketColumns);
-            int maxCol = BucketIndex(geometry.MaxX, bucketColumns);
+            KeyHitGeometry geometry = geometries[i];
+            int minRow = BucketIndex(geometry.MinY, bucketRows);
+            int maxRow = BucketIndex(geometry.MaxY, bucketRows);
+            int minCol = BucketIndex(geometry.MinX, bucketColumns);
+            int maxCol = BucketIndex(geometry.MaxX, bucketColumns);
             for (int row = minRow; row <= maxRow; row++)
             {
                 for (int col = minCol; col <= maxCol; col++)
@@ -203,13 +344,67 @@ internal sealed class BindingIndex
             }
         }
 
-        int[][] buckets = new int[bucketLists.Length][];
+        int[] bucketStarts = new int[bucketLists.Length + 1];
         for (int i = 0; i < bucketLists.Length; i++)
         {
-            buckets[i] = bucketLists[i].ToArray();
+            int padded = (bucketLists[i].Count + SlotAlignment - 1) / SlotAlignment * SlotAlignment;
+            bucketStarts[i + 1] = bucketStarts[i] + padded;
+        }
+
+        int slotCount = bucketStarts[^1];
+        int[] slotBindings = new int[slotCount];
+        float[] slotCenterX = new float[slotCount];
+        float[] slotCenterY = new float[slotCount];
+        float[] slotHalfWidth = new float[slotCount];
+        float[] slotHalfHeight = new float[slotCount];
+        float[] slotCos = new float[slotCount];
+        float[] slotSin = new float[slotCount];
+        float[] slotArea = new float[slotCount];
+        for (int i = 0; i < bucketLists.Length; i++)
+        {
+            List<int> candidates = bucketLists[i];
+            for (int slot = bucketStarts[i], candidate = 0; slot < bucketStarts[i + 1]; slot++, candidate++)
+            {
+                if (candidate >= candidates.Count)
+                {
+                    // Negative extents make the score negative for every point.
+                    slotBindings[slot] = -1;
+                    slotHalfWidth[slot] = -1f;
+                    slotHalfHeight[slot] = -1f;
+                    slotCos[slot] = 1f;
+                    continue;
+                }
+
+                int bindingIndex = candidates[candidate];
+                KeyHitGeometry geometry = geometries[bindingIndex];
+                slotBindings[slot] = bindingIndex;
+                slotCenterX[slot] = (float)geometry.CenterX;
+                slotCenterY[slot] = (float)geometry.CenterY;
+                slotHalfWidth[slot] = (float)geometry.HalfWidth;
+                slotHalfHeight[slot] = (float)geometry.HalfHeight;
+                slotCos[slot] = (float)geometry.Cos;
+                slotSin[slot] = (float)geometry.Sin;
+                slotArea[slot] = (float)geometry.Area;
+            }
         }
 
-        return new BindingIndex(bindings, geometries, bucketRows, bucketColumns, buckets, snapBindingIndices, snapCentersX, snapCentersY, snapRadiusSq);
+        return new BindingIndex(
+            bindings,
+            bucketRows,
+            bucketColumns,
+            bucketStarts,
+            slotBindings,
+            slotCenterX,
+            slotCenterY,
+            slotHalfWidth,
+            slotHalfHeight,
+            slotCos,
+            slotSin,
+            slotArea,
+            snapBindingIndices,
+            snapCentersX,
+            snapCentersY,
+            snapRadiusSq);
     }
 
     private static bool IsSnappable(EngineKeyAction action)
@@ -0,0 +1,159 @@
+using System;
+using System.Numerics;
+using System.Runtime.InteropServices;
+using System.Threading;
+
+namespace GlassToKey;
+
+// Bounded multi-producer/single-consumer ring (Vyukov sequence cells). Producers never take
+// a lock; the consumer spins briefly when empty and only then parks, so a producer signals
+// the wait handle only when the consumer is actually asleep.
+internal sealed class BoundedMpscRing<T> : IDisposable where T : struct
+{
+    // Spinning on a single CPU only steals time from the producer we are waiting for.
+    private static readonly int SpinIterations = Environment.ProcessorCount > 1 ? 64 : 0;
+
+    private readonly Cell[] _cells;
+    private readonly long _mask;
+    private readonly AutoResetEvent _parkSignal = new(false);
+    private PaddedPosition _enqueuePosition;
+    private PaddedPosition _dequeuePosition;
+    private int _consumerParked;
+    private int _wakeRequested;
+
+    // The requested capacity is rounded up to a power of two (minimum 2) so a position maps to
+    // its cell with a mask; Capacity reports the depth actually allocated, and the ring drops
+    // only once that many items are queued.
+    public BoundedMpscRing(int capacity)
+    {
+        int size = (int)BitOperations.RoundUpToPowerOf2((uint)Math.Max(2, capacity));
+        _cells = new Cell[size];
+        for (int index = 0; index < size; index++)
+        {
+            _cells[index].Sequence = index;
+        }
+
+        _mask = size - 1;
+    }
+
+    public int Capacity => _cells.Length;
+
+    public bool TryEnqueue(in T item)
+    {
+        long position = Volatile.Read(ref _enqueuePosition.Value);
+        while (true)
+        {
+            ref Cell cell = ref _cells[position & _mask];
+            long sequence = Volatile.Read(ref cell.Sequence);
+            long difference = sequence - position;
+            if (difference == 0)
+            {
+                if (Interlocked.CompareExchange(ref _enqueuePosition.Value, position + 1, position) == position)
+                {
+                    cell.Item = item;
+                    Volatile.Write(ref cell.Sequence, position + 1);
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+
+            position = Volatile.Read(ref _enqueuePosition.Value);
+        }
+
+        // Pairs with the barrier in WaitForItem: either the consumer sees the new cell or we
+        // see its parked flag.
+        Interlocked.MemoryBarrier();
+        if (Volatile.Read(ref _consumerParked) != 0 &&
+            Interlocked.Exchange(ref _consumerParked, 0) != 0)
+        {
+            _parkSignal.Set();
+        }
+
+        return true;
+    }
+
+    // Single consumer only.
+    public bool TryDequeue(out T item)
+    {
+        long position = _dequeuePosition.Value;
+        ref Cell cell = ref _cells[position & _mask];
+        if (Volatile.Read(ref cell.Sequence) != position + 1)
+        {
+            item = default;
+            return false;
+        }
+
+        item = cell.Item;
+        cell.Item = default;
+        Volatile.Write(ref cell.Sequence, position + _mask + 1);
+        _dequeuePosition.Value = position + 1;
+        return true;
+    }
+
+    // Single consumer only. Returns once an item is available, Wake was called, or the
+    // park timeout elapses.
+    public void WaitForItem(int parkTimeoutMs = Timeout.Infinite)
+    {
+        SpinWait spinner = default;
+        for (int iteration = 0; iteration < SpinIterations; iteration++)
+        {
+            if (HasItem() || Volatile.Read(ref _wakeRequested) != 0)
+            {
+                Interlocked.Exchange(ref _wakeRequested, 0);
+                return;
+            }
+
+            spinner.SpinOnce(sleep1Threshold: -1);
+        }
+
+        // A signal left over from a wake that raced with the re-check below only costs one
+        // spurious return; callers always re-try TryDequeue.
+        Volatile.Write(ref _consumerParked, 1);
+        Interlocked.MemoryBarrier();
+        if (!HasItem() && Interlocked.Exchange(ref _wakeRequested, 0) == 0)
+        {
+            _parkSignal.WaitOne(parkTimeoutMs);
+        }
+
+        Volatile.Write(ref _consumerParked, 0);
+    }
+
+    public void Wake()
+    {
+        Volatile.Write(ref _wakeRequested, 1);
+        Interlocked.MemoryBarrier();
+        if (Interlocked.Exchange(ref _consumerParked, 0) != 0)
+        {
+            _parkSignal.Set();
+        }
+    }
+
+    public void Dispose()
+    {
+        _parkSignal.Dispose();
+    }
+
+    private bool HasItem()
+    {
+        long position = _dequeuePosition.Value;
+        return Volatile.Read(ref _cells[position & _mask].Sequence) == position + 1;
+    }
+
+    private struct Cell
+    {
+        public long Sequence;
+        public T Item;
+    }
+}
+
+// Keeps producer and consumer cursors on separate cache lines. Lives outside the generic
+// ring because generic types cannot use explicit layout.
+[StructLayout(LayoutKind.Explicit, Size = 128)]
+internal struct PaddedPosition
+{
+    [FieldOffset(64)]
+    public long Value;
+}
@@ -112,6 +112,26 @@ internal readonly record struct EngineBindingHit(bool Found, int BindingIndex)
     public static EngineBindingHit Miss => new(false, -1);
 }
 
+// One bit per per-frame gesture recognizer, in the order the engine runs them.
+[Flags]
+public enum GestureRecognizers : ushort
+{
+    None = 0,
+    FiveFingerSwipe = 1 << 0,
+    ThreeFingerSwipe = 1 << 1,
+    FourFingerSwipe = 1 << 2,
+    ThreeFingerTap = 1 << 3,
+    TwoFingerHold = 1 << 4,
+    ThreeFingerHold = 1 << 5,
+    FourFingerHold = 1 << 6,
+    CornerHold = 1 << 7,
+    EdgeSlide = 1 << 8,
+    CornerSwipe = 1 << 9,
+    Triangle = 1 << 10,
+    ForceClick = 1 << 11,
+    CornerClickTap = 1 << 12
+}
+
 internal readonly record struct TouchProcessorSnapshot(
     IntentMode IntentMode,
     int ActiveLayer,
@@ -149,7 +169,8 @@ internal readonly record struct TouchProcessorSnapshot(
     long SnapAttempts,
     long SnapAccepted,
     long SnapRejected,
-    ulong IntentTraceFingerprint)
+    ulong IntentTraceFingerprint,
+    GestureRecognizers EnabledGestureRecognizers)
 {
     public string ToSummary()
     {
@@ -178,7 +199,18 @@ internal readonly record struct EngineDiagnosticEvent(
     int LeftRawContacts,
     int RightRawContacts,
     string DispatchLabel,
-    string Reason);
+    string Reason,
+    EngineFrameDiagnostic Frame = default);
+
+// Per-frame bookkeeping counts carried as numbers so recording a frame_end event does not
+// format a string on the frame path.
+internal readonly record struct EngineFrameDiagnostic(
+    int OnKeyContacts,
+    int FrameKeys,
+    int TouchStates,
+    int IntentTouches,
+    int OccupiedTouchStates,
+    int OccupiedIntentTouches);
 
 internal readonly record struct IntentTransition(
     long TimestampTicks,
@@ -58,6 +58,9 @@ internal sealed class TouchProcessorCore
     private const double ThreeFingerTapMaxMovementMm = 1.6;
     private const double ThreeFingerDragPixelsPerMm = 10.0;
     private const ushort ShiftVirtualKey = 0x10;
+    private const int LayerCount = 8;
+    private const int FallbackDispatchLabelKeyCount = 256;
+    private static readonly string?[]?[] s_fallbackDispatchLabels = new string?[]?[(int)DispatchEventKind.AppLaunch + 1];
 
     private TouchProcessorConfig _config;
     private readonly IntentTransition[] _transitionRing = new IntentTransition[256];
@@ -74,6 +77,10 @@ internal sealed class TouchProcessorCore
     private KeymapStore _keymap;
     private BindingIndex? _leftBindingIndex;
     private BindingIndex? _rightBindingIndex;
+    // Every layer is built together after a keymap/layout/snap change, so a momentary-layer
+    // press or release only swaps the active pair instead of re-resolving the grid.
+    private readonly BindingIndex?[] _leftLayerBindingIndexes = new BindingIndex?[LayerCount];
+    private readonly BindingIndex?[] _rightLayerBindingIndexes = new BindingIndex?[LayerCount];
     private int _bindingsGeneration;
     private int _bindingsLayer = -1;
 
@@ -178,6 +185,8 @@ internal sealed class TouchProcessorCore
     private EngineKeyAction _bottomEdgeLeftGestureAction = EngineKeyAction.None;
     private EngineKeyAction _bottomEdgeRightGestureAction = EngineKeyAction.None;
     private EngineKeyAction _threeFingerTapGestureAction = EngineKeyAction.None;
+    private GestureRecognizers[] _gesturePipeline = [];
+    private GestureRecognizers _enabledGestureRecognizers;
     private EngineKeyAction _threeFingerClickGestureAction = EngineKeyAction.None;
     private EngineKeyAction _fourFingerClickGestureAction = EngineKeyAction.None;
     private EngineKeyAction _outerCornersGestureAction = EngineKeyAction.None;
@@ -233,18 +242,30 @@ internal sealed class TouchProcessorCore
     private int _diagnosticRingCount;
     private long _clockAnchorTimestampTicks;
     private long _clockAnchorWallTicks;
+    private readonly TimeProvider _clock;
 
+    // The clock is read wherever the engine needs "now" without a frame timestamp (API calls,
+    // snapshots between frames). It must count in Stopwatch ticks; a VirtualTimeProvider runs
+    // the engine on simulated time.
     public TouchProcessorCore(
         KeyLayout leftLayout,
         KeyLayout rightLayout,
         KeymapStore keymap,
-        TouchProcessorConfig? config = null)
+        TouchProcessorConfig? config = null,
+        TimeProvider? clock = null)
     {
+        _clock = clock ?? TimeProvider.System;
+        if (_clock.TimestampFrequency != Stopwatch.Frequency)
+        {
+            throw new ArgumentException("The engine clock must tick at Stopwatch.Frequency.", nameof(clock));
+        }
+
         _leftLayout = leftLayout;
         _rightLayout = rightLayout;
         _keymap = keymap;
         _config = NormalizeConfig(config ?? TouchProcessorConfig.Default);
         RefreshGestureActionsFromConfig();
+        CompileGesturePipeline();
     }
 
     public TouchProcessorConfig CurrentConfig => _config;
@@ -270,6 +291,7 @@ internal sealed class TouchProcessorCore
             Math.Abs(normalized.SnapAmbiguityRatio - _config.SnapAmbiguityRatio) > 0.0001;
         _config = normalized;
         RefreshGestureActionsFromConfig();
+        CompileGesturePipeline();
         if (rebuildBindings)
         {
             InvalidateBindings();
@@ -279,60 +301,16 @@ internal sealed class TouchProcessorCore
         {
             _chordShiftLeft = false;
             _chordShiftRight = false;
-            UpdateChordShiftKeyState(Stopwatch.GetTimestamp());
+            UpdateChordShiftKeyState(_clock.GetTimestamp());
         }
 
-        if (_topLeftTriangleGestureAction.Kind == EngineActionKind.None &&
-            _topRightTriangleGestureAction.Kind == EngineActionKind.None &&
-            _bottomLeftTriangleGestureAction.Kind == EngineActionKind.None &&
-            _bottomRightTriangleGestureAction.Kind == EngineActionKind.None)
-        {
-            _triangleGestureLeft = default;
-            _triangleGestureRight = default;
-        }
-
-        if (_topLeftCornerSwipeGestureAction.Kind == EngineActionKind.None &&
-            _topRightCornerSwipeGestureAction.Kind == EngineActionKind.None &&
-            _bottomLeftCornerSwipeGestureAction.Kind == EngineActionKind.None &&
-            _bottomRightCornerSwipeGestureAction.Kind == EngineActionKind.None)
-        {
-            _cornerSwipeGestureLeft = default;
-            _cornerSwipeGestureRight = default;
-        }
-
-        if (_leftEdgeUpGestureAction.Kind == EngineActionKind.None &&
-            _leftEdgeDownGestureAction.Kind == EngineActionKind.None &&
-            _rightEdgeUpGestureAction.Kind == EngineActionKind.None &&
-            _rightEdgeDownGestureAction.Kind == EngineActionKind.None &&
-            _topEdgeLeftGestureAction.Kind == EngineActionKind.None &&
-            _topEdgeRightGestureAction.Kind == EngineActionKind.None &&
-            _bottomEdgeLeftGestureAction.Kind == EngineActionKind.None &&
-            _bottomEdgeRightGestureAction.Kind == EngineActionKind.None)
-        {
-            _edgeSlideGestureLeft = default;
-            _edgeSlideGestureRight = default;
-        }
+        RetireDisabledGestureRecognizers(_clock.GetTimestamp());
 
         if (_forceClick2GestureAction.Kind == EngineActionKind.None &&
             _forceClick3GestureAction.Kind == EngineActionKind.None)
         {
             _forceClickGestureLeft = default;
             _forceClickGestureRight = default;
-        }
-
-        if (_upperLeftCornerClickGestureAction.Kind == EngineActionKind.None &&
-            _upperRightCornerClickGestureAction.Kind == EngineActionKind.None &&
-            _lowerLeftCornerClickGestureAction.Kind == EngineActionKind.None &&
-            _lowerRightCornerClickGestureAction.Kind == EngineActionKind.None)
-        {
-            _cornerClickTapGestureLeft = default;
-            _cornerClickTapGestureRight = default;
-        }
-
-        if (_threeFingerTapGestureAction.Kind == EngineActionKind.None)
-        {
-            _threeFingerTapGestureLeft = default;
-            _threeFingerTapGestureRight = default;
         }
     }
 
@@ -344,7 +322,7 @@ internal sealed class TouchProcessorCore
 
     public void SetTypingEnabled(bool enabled)
     {
-        SetTypingEnabledState(enabled, Stopwatch.GetTimestamp(), TypingToggleSource.Api);
+        SetTypingEnabledState(enabled, _clock.GetTimestamp(), TypingToggleSource.Api);
     }
 
     public void SetKeyboardModeEnabled(bool enabled)
@@ -360,7 +338,7 @@ internal sealed class TouchProcessorCore
             return;
         }
 
-        long nowTicks = Stopwatch.GetTimestamp();
+        long nowTicks = _clock.GetTimestamp();
         if (_intentMode is IntentMode.MouseCandidate or IntentMode.MouseActive)
         {
             if (_intentTouches.Count > 0)
@@ -388,7 +366,7 @@ internal sealed class TouchProcessorCore
         _threeFingerDragEnabled = enabled;
         if (!enabled)
         {
-            ReleaseThreeFingerDragState(Stopwatch.GetTimestamp(), armPointerIntentSequence: false);
+            ReleaseThreeFingerDragState(_clock.GetTimestamp(), armPointerIntentSequence: false);
         }
     }
 
@@ -426,12 +404,21 @@ internal sealed class TouchProcessorCore
 
     public void RecordQueueDrop()
     {
-        _queueDrops++;
+        // Called from producer threads without the core gate.
+        Interlocked.Increment(ref _queueDrops);
+        if (EngineEventSource.Log.IsQueueDropEnabled)
+        {
+            EngineEventSource.Log.QueueDrop(0);
+        }
     }
 
     public void RecordDispatchDrop()
     {
         _dispatchDrops++;
+        if (EngineEventSource.Log.IsQueueDropEnabled)
+        {
+            EngineEventSource.Log.QueueDrop(1);
+        }
     }
 
     public int CopyDiagnostics(Span<EngineDiagnosticEvent> destination)
@@ -476,7 +463,7 @@ internal sealed class TouchProcessorCore
 
     public void ResetState()
     {
-        EndAllGestureDispatches(Stopwatch.GetTimestamp());
+        EndAllGestureDispatches(_clock.GetTimestamp());
         _intentTouches.RemoveAll();
         _touchStates.RemoveAll();
         _momentaryLayerTouches.RemoveAll();
@@ -736,6 +723,10 @@ internal sealed class TouchProcessorCore
                     OnKey: onKey,
                     KeyboardAnchor: keyboardAnchor,
                     InitialBindingIndex: hit.Found ? hit.BindingIndex : -1));
+                if (EngineEventSource.Log.IsEnabled(EngineEventSource.Keywords.Touch))
+                {
+                    EngineEventSource.Log.TouchBegin((int)side, (int)contact.Id, hit.Found ? hit.BindingIndex : -1);
+                }
             }
 
             HandleContactLifecycle(
@@ -765,13 +756,16 @@ internal sealed class TouchProcessorCore
             SetThreePlusGestureSuppress(side, enabled: false);
         }
 
-        string frameReason = "frame_end";
+        EngineFrameDiagnostic frameDiagnostic = default;
         if (_diagnosticsEnabled)
         {
-            int occupiedTouchStates = CountOccupiedTouchStates();
-            int occupiedIntentTouches = CountOccupiedIntentTouches();
-            frameReason =
-                $"frame_end onKey={onKeyTipContactsInFrame} frameKeys={frameKeyCount} states={_touchStates.Count}/{_intentTouches.Count} occ={occupiedTouchStates}/{occupiedIntentTouches}";
+            frameDiagnostic = new EngineFrameDiagnostic(
+                OnKeyContacts: onKeyTipContactsInFrame,
+                FrameKeys: frameKeyCount,
+                TouchStates: _touchStates.Count,
+                IntentTouches: _intentTouches.Count,
+                OccupiedTouchStates: CountOccupiedTouchStates(),
+                OccupiedIntentTouches: CountOccupiedIntentTouches());
         }
 
         RecordDiagnostic(
@@ -792,7 +786,8 @@ internal sealed class TouchProcessorCore
             tipContactsInFrame,
             _lastRawLeftContacts,
             _lastRawRightContacts,
-            frameReason);
+            "frame_end",
+            frame: frameDiagnostic);
 
         IntentAggregate aggregate = BuildIntentAggregate();
         double centroidX = 0.0;
@@ -801,53 +796,78 @@ internal sealed class TouchProcessorCore
         {
             centroidX = tipSumXNorm / tipContactsInFrame;
             centroidY = tipSumYNorm / tipContactsInFrame;
-            UpdateFiveFingerSwipe(side, tipContactsInFrame, centroidX, centroidY, timestampTicks);
-            UpdateThreeFingerSwipe(side, tipContactsInFrame, centroidX, centroidY, timestampTicks);
-            UpdateFourFingerSwipe(side, tipContactsInFrame, centroidX, centroidY, timestampTicks);
-        }
-        else
-        {
-            UpdateFiveFingerSwipe(side, 0, 0, 0, timestampTicks);
-            UpdateThreeFingerSwipe(side, 0, 0, 0, timestampTicks);
-            UpdateFourFingerSwipe(side, 0, 0, 0, timestampTicks);
         }
-        if (_threeFingerTapGestureAction.Kind != EngineActionKind.None ||
-            _threeFingerTapGestureLeft.Active ||
-            _threeFingerTapGestureRight.Active)
+
+        // Only the recognizers Configure found enabled run; a disabled gesture costs nothing here.
+        GestureRecognizers[] pipeline = _gesturePipeline;
+        for (int i = 0; i < pipeline.Length; i++)
         {
-            UpdateThreeFingerTapGesture(
-                side,
-                tipContactsInFrame,
-                centroidX,
-                centroidY,
-                frame.IsButtonPressed,
-                timestampTicks);
+            switch (pipeline[i])
+            {
+                case GestureRecognizers.FiveFingerSwipe:
+                    UpdateFiveFingerSwipe(side, tipContactsInFrame, centroidX, centroidY, timestampTicks);
+                    break;
+                case GestureRecognizers.ThreeFingerSwipe:
+                    UpdateThreeFingerSwipe(side, tipContactsInFrame, centroidX, centroidY, timestampTicks);
+                    break;
+                case GestureRecognizers.FourFingerSwipe:
+                    UpdateFourFingerSwipe(side, tipContactsInFrame, centroidX, centroidY, timestampTicks);
+                    break;
+                case GestureRecognizers.ThreeFingerTap:
+                    UpdateThreeFingerTapGesture(
+                        side,
+                        tipContactsInFrame,
+                        centroidX,
+                        centroidY,
+                        frame.IsButtonPressed,
+                        timestampTicks);
+                    break;
+                case GestureRecognizers.TwoFingerHold:
+                    UpdateTwoFingerHoldGesture(aggregate, timestampTicks);
+                    break;
+                case GestureRecognizers.ThreeFingerHold:
+                    UpdateThreeFingerHoldGesture(aggregate, timestampTicks);
+                    break;
+                case GestureRecognizers.FourFingerHold:
+                    UpdateFourFingerHoldGesture(aggregate, timestampTicks);
+                    break;
+                case GestureRecognizers.CornerHold:
+                    UpdateCornerHoldGesture(side, timestampTicks);
+                    break;
+                case GestureRecognizers.EdgeSlide:
+                    UpdateEdgeSlideGesture(side, tipContactsInFrame, timestampTicks);
+                    break;
+                case GestureRecognizers.CornerSwipe:
+                    UpdateCornerSwipeGesture(side, tipContactsInFrame, timestampTicks);
+                    break;
+                case GestureRecognizers.Triangle:
+                    UpdateTriangleGesture(side, tipContactsInFrame, timestampTicks);
+                    break;
+                case GestureRecognizers.ForceClick:
+                    UpdateForceClickGesture(
+                        side,
+                        tipContactsInFrame,
+                        hasSingleTipSnapshot,
+                        singleTipXNorm,
+                        singleTipYNorm,
+                        singleTipForceNorm,
+                        singleTipKeyboardAnchor,
+                        timestampTicks);
+                    break;
+                case GestureRecognizers.CornerClickTap:
+                    UpdateCornerClickTapGesture(
+                        side,
+                        tipContactsInFrame,
+                        hasSingleTipSnapshot,
+                        singleTipXNorm,
+                        singleTipYNorm,
+                        singleTipForceNorm,
+                        singleTipKeyboardAnchor,
+                        timestampTicks);
+                    break;
+            }
         }
-        UpdateTwoFingerHoldGesture(aggregate, timestampTicks);
-        UpdateThreeFingerHoldGesture(aggregate, timestampTicks);
-        UpdateFourFingerHoldGesture(aggregate, timestampTicks);
-        UpdateCornerHoldGesture(side, timestampTicks);
-        UpdateEdgeSlideGesture(side, tipContactsInFrame, timestampTicks);
-        UpdateCornerSwipeGesture(side, tipContactsInFrame, timestampTicks);
-        UpdateTriangleGesture(side, tipContactsInFrame, timestampTicks);
-        UpdateForceClickGesture(
-            side,
-            tipContactsInFrame,
-            hasSingleTipSnapshot,
-            singleTipXNorm,
-            singleTipYNorm,
-            singleTipForceNorm,
-            singleTipKeyboardAnchor,
-            timestampTicks);
-        UpdateCornerClickTapGesture(
-            side,
-            tipContactsInFrame,
-            hasSingleTipSnapshot,
-            singleTipXNorm,
-            singleTipYNorm,
-            singleTipForceNorm,
-            singleTipKeyboardAnchor,
-            timestampTicks);
+
         UpdateIntentState(aggregate, timestampTicks);
     }
 
@@ -885,7 +905,7 @@ internal sealed class TouchProcessorCore
             ChordShiftLeft: _chordShiftLeft,
             ChordShiftRight: _chordShiftRight,
             FramesProcessed: _framesProcessed,
-            QueueDrops: _queueDrops,
+            QueueDrops: Interlocked.Read(ref _queueDrops),
             StaleTouchExpirations: 0,
             ReleaseDroppedTotal: _releaseDroppedTotal,
             ReleaseDroppedGesturePriority: _releaseDroppedGesturePriority,
@@ -897,19 +917,33 @@ internal sealed class TouchProcessorCore
             SnapAttempts: _snapAttempts,
             SnapAccepted: _snapAccepted,
             SnapRejected: _snapRejected,
-            IntentTraceFingerprint: _intentTraceFingerprint);
+            IntentTraceFingerprint: _intentTraceFingerprint,
+            EnabledGestureRecognizers: _enabledGestureRecognizers);
+    }
+
+    // Engine-thread view of the intent state for the preview channel; unlike Snapshot it
+    // neither allocates nor refreshes passive intent.
+    public void CopyPreviewState(ref PreviewChannelFrame frame)
+    {
+        frame.IntentMode = (byte)_intentMode;
+        frame.ActiveLayer = (byte)_activeLayer;
+        frame.FramesProcessed = _framesProcessed;
+        frame.StateFlags = (byte)(
+            (_typingEnabled ? PreviewChannelFrame.TypingEnabledFlag : 0) |
+            (_keyboardModeEnabled ? PreviewChannelFrame.KeyboardModeEnabledFlag : 0) |
+            (IsMomentaryLayerActive() ? PreviewChannelFrame.MomentaryLayerActiveFlag : 0));
     }
 
     private void CaptureClockAnchor(long timestampTicks)
     {
         _clockAnchorTimestampTicks = timestampTicks;
-        _clockAnchorWallTicks = Stopwatch.GetTimestamp();
+        _clockAnchorWallTicks = _clock.GetTimestamp();
     }
 
     private long EstimateNowTicks()
     {
         long anchorWallTicks = _clockAnchorWallTicks;
-        long wallNowTicks = Stopwatch.GetTimestamp();
+        long wallNowTicks = _clock.GetTimestamp();
         if (anchorWallTicks == 0)
         {
             return wallNowTicks;
@@ -997,6 +1031,8 @@ internal sealed class TouchProcessorCore
         _bindingsGeneration++;
         _leftBindingIndex = null;
         _rightBindingIndex = null;
+        Array.Clear(_leftLayerBindingIndexes);
+        Array.Clear(_rightLayerBindingIndexes);
     }
 
     private void EnsureBindingIndexes()
@@ -1008,8 +1044,19 @@ internal sealed class TouchProcessorCore
             return;
         }
 
-        _leftBindingIndex = BindingIndex.Build(_leftLayout, TrackpadSide.Left, _activeLayer, _keymap, snapRadiusFraction: _config.SnapRadiusPercent / 100.0);
-        _rightBindingIndex = BindingIndex.Build(_rightLayout, TrackpadSide.Right, _activeLayer, _keymap, snapRadiusFraction: _config.SnapRadiusPercent / 100.0);
+        if (_leftLayerBindingIndexes[0] == null)
+        {
+            double snapRadiusFraction = _config.SnapRadiusPercent / 100.0;
+            for (int layer = 0; layer < LayerCount; layer++)
+            {
+                _leftLayerBindingIndexes[layer] = BindingIndex.Build(_leftLayout, TrackpadSide.Left, layer, _keymap, snapRadiusFraction: snapRadiusFraction);
+                _rightLayerBindingIndexes[layer] = BindingIndex.Build(_rightLayout, TrackpadSide.Right, layer, _keymap, snapRadiusFraction: snapRadiusFraction);
+            }
+        }
+
+        int activeLayer = Math.Clamp(_activeLayer, 0, LayerCount - 1);
+        _leftBindingIndex = _leftLayerBindingIndexes[activeLayer];
+        _rightBindingIndex = _rightLayerBindingIndexes[activeLayer];
         _bindingsLayer = _activeLayer;
     }
 
@@ -1259,7 +1306,11 @@ internal sealed class TouchProcessorCore
         for (int i = 0; i < removalCount; i++)
         {
             ulong key = _removalBuffer[i];
-            _intentTouches.Remove(key, out _);
+            if (_intentTouches.Remove(key, out IntentTouchInfo ended))
+            {
+                TraceTouchEnd(key, in ended, timestampTicks, cancelled: false);
+            }
+
             HandleRelease(key, timestampTicks);
         }
     }
@@ -2358,6 +2409,25 @@ internal sealed class TouchProcessorCore
             return dispatchLabel;
         }
 
+        // Fallback labels are built once per kind and key/button, then reused, so diagnostics
+        // do not allocate a string for every dispatch.
+        int labelKey = kind is DispatchEventKind.MouseButtonClick or DispatchEventKind.MouseButtonDown or DispatchEventKind.MouseButtonUp
+            ? (int)mouseButton
+            : virtualKey;
+        if ((uint)kind >= (uint)s_fallbackDispatchLabels.Length || labelKey >= FallbackDispatchLabelKeyCount)
+        {
+            return BuildFallbackDispatchLabel(kind, virtualKey, mouseButton);
+        }
+
+        string?[] labels = s_fallbackDispatchLabels[(int)kind] ??= new string?[FallbackDispatchLabelKeyCount];
+        return labels[labelKey] ??= BuildFallbackDispatchLabel(kind, virtualKey, mouseButton);
+    }
+
+    private static string BuildFallbackDispatchLabel(
+        DispatchEventKind kind,
+        ushort virtualKey,
+        DispatchMouseButton mouseButton)
+    {
         return kind switch
         {
             DispatchEventKind.MouseButtonClick => $"Mouse{mouseButton}Click",
@@ -3134,7 +3204,11 @@ internal sealed class TouchProcessorCore
         for (int i = 0; i < removalCount; i++)
         {
             ulong key = _removalBuffer[i];
-            _intentTouches.Remove(key, out _);
+            if (_intentTouches.Remove(key, out IntentTouchInfo ended))
+            {
+                TraceTouchEnd(key, in ended, timestampTicks, cancelled: true);
+            }
+
             CancelTouchWithoutReleaseAction(key, timestampTicks);
         }
 
@@ -5799,7 +5873,11 @@ internal sealed class TouchProcessorCore
         for (int i = 0; i < removalCount; i++)
         {
             ulong key = _removalBuffer[i];
-            _intentTouches.Remove(key, out _);
+            if (_intentTouches.Remove(key, out IntentTouchInfo ended))
+            {
+                TraceTouchEnd(key, in ended, timestampTicks, cancelled: true);
+            }
+
             CancelTouchWithoutReleaseAction(key, timestampTicks);
         }
     }
@@ -5928,6 +6006,142 @@ internal sealed class TouchProcessorCore
         _lowerRightCornerClickGestureAction = EngineActionResolver.ResolveActionLabel(_config.LowerRightCornerClickAction);
     }
 
+    // Recognizers in the order ProcessFrame has always run them; order matters because the
+    // swipes read each other's state within a frame.
+    private static readonly GestureRecognizers[] GestureRecognizerOrder =
+    [
+        GestureRecognizers.FiveFingerSwipe,
+        GestureRecognizers.ThreeFingerSwipe,
+        GestureRecognizers.FourFingerSwipe,
+        GestureRecognizers.ThreeFingerTap,
+        GestureRecognizers.TwoFingerHold,
+        GestureRecognizers.ThreeFingerHold,
+        GestureRecognizers.FourFingerHold,
+        GestureRecognizers.CornerHold,
+        GestureRecognizers.EdgeSlide,
+        GestureRecognizers.CornerSwipe,
+        GestureRecognizers.Triangle,
+        GestureRecognizers.ForceClick,
+        GestureRecognizers.CornerClickTap
+    ];
+
+    private void CompileGesturePipeline()
+    {
+        GestureRecognizers enabled = GestureRecognizers.None;
+        int count = 0;
+        for (int i = 0; i < GestureRecognizerOrder.Length; i++)
+        {
+            if (IsGestureRecognizerEnabled(GestureRecognizerOrder[i]))
+            {
+                enabled |= GestureRecognizerOrder[i];
+                count++;
+            }
+        }
+
+        GestureRecognizers[] pipeline = new GestureRecognizers[count];
+        count = 0;
+        for (int i = 0; i < GestureRecognizerOrder.Length; i++)
+        {
+            if ((enabled & GestureRecognizerOrder[i]) != 0)
+            {
+                pipeline[count++] = GestureRecognizerOrder[i];
+            }
+        }
+
+        _gesturePipeline = pipeline;
+        _enabledGestureRecognizers = enabled;
+    }
+
+    private bool IsGestureRecognizerEnabled(GestureRecognizers recognizer)
+    {
+        return recognizer switch
+        {
+            GestureRecognizers.FiveFingerSwipe => HasAnyFiveFingerSwipeAction(),
+            GestureRecognizers.ThreeFingerSwipe => HasAnyThreeFingerSwipeAction(),
+            GestureRecognizers.FourFingerSwipe => HasAnyFourFingerSwipeAction(),
+            GestureRecognizers.ThreeFingerTap => AreThreeFingerTapGesturesEnabled(),
+            GestureRecognizers.TwoFingerHold => _twoFingerHoldGestureAction.Kind != EngineActionKind.None,
+            GestureRecognizers.ThreeFingerHold => _threeFingerHoldGestureAction.Kind != EngineActionKind.None,
+            GestureRecognizers.FourFingerHold => _fourFingerHoldGestureAction.Kind != EngineActionKind.None,
+            GestureRecognizers.CornerHold => AreCornerGesturesEnabled(),
+            GestureRecognizers.EdgeSlide => AreEdgeSlideGesturesEnabled(),
+            GestureRecognizers.CornerSwipe => AreCornerSwipeGesturesEnabled(),
+            GestureRecognizers.Triangle => AreTriangleGesturesEnabled(),
+            GestureRecognizers.ForceClick => AreForceClickGesturesEnabled(),
+            GestureRecognizers.CornerClickTap => AreCornerClickTapGesturesEnabled(),
+            _ => false
+        };
+    }
+
+    // A recognizer dropped from the pipeline no longer sees frames, so release anything it
+    // holds now. Each update takes its disabled path here: end any held dispatch and reset.
+    private void RetireDisabledGestureRecognizers(long nowTicks)
+    {
+        GestureRecognizers disabled = ~_enabledGestureRecognizers;
+        IntentAggregate aggregate = default;
+        for (int i = 0; i < GestureRecognizerOrder.Length; i++)
+        {
+            GestureRecognizers recognizer = GestureRecognizerOrder[i];
+            if ((disabled & recognizer) == 0)
+            {
+                continue;
+            }
+
+            switch (recognizer)
+            {
+                case GestureRecognizers.TwoFingerHold:
+                    UpdateTwoFingerHoldGesture(aggregate, nowTicks);
+                    continue;
+                case GestureRecognizers.ThreeFingerHold:
+                    UpdateThreeFingerHoldGesture(aggregate, nowTicks);
+                    continue;
+                case GestureRecognizers.FourFingerHold:
+                    UpdateFourFingerHoldGesture(aggregate, nowTicks);
+                    continue;
+            }
+
+            RetireSideGestureRecognizer(recognizer, TrackpadSide.Left, nowTicks);
+            RetireSideGestureRecognizer(recognizer, TrackpadSide.Right, nowTicks);
+        }
+    }
+
+    private void RetireSideGestureRecognizer(GestureRecognizers recognizer, TrackpadSide side, long nowTicks)
+    {
+        switch (recognizer)
+        {
+            case GestureRecognizers.FiveFingerSwipe:
+                UpdateFiveFingerSwipe(side, 0, 0, 0, nowTicks);
+                break;
+            case GestureRecognizers.ThreeFingerSwipe:
+                UpdateThreeFingerSwipe(side, 0, 0, 0, nowTicks);
+                break;
+            case GestureRecognizers.FourFingerSwipe:
+                UpdateFourFingerSwipe(side, 0, 0, 0, nowTicks);
+                break;
+            case GestureRecognizers.ThreeFingerTap:
+                UpdateThreeFingerTapGesture(side, 0, 0, 0, buttonPressed: false, nowTicks);
+                break;
+            case GestureRecognizers.CornerHold:
+                UpdateCornerHoldGesture(side, nowTicks);
+                break;
+            case GestureRecognizers.EdgeSlide:
+                UpdateEdgeSlideGesture(side, 0, nowTicks);
+                break;
+            case GestureRecognizers.CornerSwipe:
+                UpdateCornerSwipeGesture(side, 0, nowTicks);
+                break;
+            case GestureRecognizers.Triangle:
+                UpdateTriangleGesture(side, 0, nowTicks);
+                break;
+            case GestureRecognizers.ForceClick:
+                UpdateForceClickGesture(side, 0, false, 0, 0, 0, false, nowTicks);
+                break;
+            case GestureRecognizers.CornerClickTap:
+                UpdateCornerClickTapGesture(side, 0, false, 0, 0, 0, false, nowTicks);
+                break;
+        }
+    }
+
     private static bool IsChordShiftGestureLabel(string? action)
     {
         if (string.IsNullOrWhiteSpace(action))
@@ -6054,6 +6268,11 @@ internal sealed class TouchProcessorCore
         _intentTraceFingerprint = Mix(_intentTraceFingerprint, (ulong)_intentMode);
         _intentTraceFingerprint = Mix(_intentTraceFingerprint, (ulong)next);
         _intentTraceFingerprint = Mix(_intentTraceFingerprint, StableStringHash(reason));
+        if (EngineEventSource.Log.IsEnabled(EngineEventSource.Keywords.Intent))
+        {
+            EngineEventSource.Log.IntentTransition((int)_intentMode, (int)next);
+        }
+
         _intentMode = next;
         RecordDiagnostic(
             timestampTicks,
@@ -6095,8 +6314,21 @@ internal sealed class TouchProcessorCore
         int leftRawContacts,
         int rightRawContacts,
         string reason,
-        string dispatchLabel = "")
+        string dispatchLabel = "",
+        EngineFrameDiagnostic frame = default)
     {
+        if (EngineEventSource.Log.IsEnabled(EngineEventSource.Keywords.Dispatch))
+        {
+            if (kind == EngineDiagnosticEventKind.DispatchEnqueued)
+            {
+                EngineEventSource.Log.DispatchEnqueued((int)side, (int)dispatchKind, virtualKey, (int)mouseButton);
+            }
+            else if (kind == EngineDiagnosticEventKind.DispatchSuppressed)
+            {
+                EngineEventSource.Log.DispatchSuppressed((int)side, (int)dispatchKind, virtualKey, (int)suppressReason);
+            }
+        }
+
         if (!_diagnosticsEnabled)
         {
             return;
@@ -6121,7 +6353,8 @@ internal sealed class TouchProcessorCore
             leftRawContacts,
             rightRawContacts,
             dispatchLabel,
-            reason);
+            reason,
+            frame);
         _diagnosticRingHead = (_diagnosticRingHead + 1) % _diagnosticRing.Length;
         if (_diagnosticRingCount < _diagnosticRing.Length)
         {
@@ -6129,6 +6362,17 @@ internal sealed class TouchProcessorCore
         }
     }
 
+    private static void TraceTouchEnd(ulong touchKey, in IntentTouchInfo touch, long timestampTicks, bool cancelled)
+    {
+        if (!EngineEventSource.Log.IsEnabled(EngineEventSource.Keywords.Touch))
+        {
+            return;
+        }
+
+        long durationNanoseconds = (long)((timestampTicks - touch.StartTicks) * (1_000_000_000.0 / Stopwatch.Frequency));
+        EngineEventSource.Log.TouchEnd((int)touch.Side, (int)(uint)touchKey, cancelled, durationNanoseconds);
+    }
+
     private static ulong MakeTouchKey(TrackpadSide side, uint contactId)
     {
         ulong sideBits = side == TrackpadSide.Left ? 0ul : 1ul;
@@ -6874,27 +7118,32 @@ internal sealed class TouchProcessorActor : IDisposable
     private readonly object _coreGate = new();
     private readonly DispatchEventQueue? _dispatchQueue;
     private readonly IThreeFingerDragSink? _threeFingerDragSink;
-    private readonly FrameEnvelope[] _queue;
-    private readonly object _gate = new();
-    private readonly AutoResetEvent _signal = new(false);
+    private readonly PreviewChannelWriter? _previewChannel;
+    private readonly PipelineLatencyRecorder? _latency;
+    private readonly BoundedMpscRing<FrameEnvelope> _queue;
     private readonly Thread _thread;
     private bool _disposing;
-    private int _head;
-    private int _tail;
-    private int _count;
+    // Set once no post can still be enqueueing; only then may an empty ring end the loop.
+    private bool _stopping;
+    private int _activePosts;
     private long _postedCount;
     private long _processedCount;
 
+    // The frame ring holds queueCapacity rounded up to a power of two (at least 16).
     public TouchProcessorActor(
         TouchProcessorCore core,
         int queueCapacity = 2048,
         DispatchEventQueue? dispatchQueue = null,
-        IThreeFingerDragSink? threeFingerDragSink = null)
+        IThreeFingerDragSink? threeFingerDragSink = null,
+        PreviewChannelWriter? previewChannel = null,
+        PipelineLatencyRecorder? latency = null)
     {
         _core = core;
         _dispatchQueue = dispatchQueue;
         _threeFingerDragSink = threeFingerDragSink;
-        _queue = new FrameEnvelope[Math.Max(16, queueCapacity)];
+        _previewChannel = previewChannel;
+        _latency = latency;
+        _queue = new BoundedMpscRing<FrameEnvelope>(Math.Max(16, queueCapacity));
         _thread = new Thread(RunLoop)
         {
             IsBackground = true,
@@ -6903,28 +7152,51 @@ internal sealed class TouchProcessorActor : IDisposable
         _thread.Start();
     }
 
-    public bool Post(TrackpadSide side, in InputFrame frame, ushort maxX, ushort maxY, long timestampTicks)
+    public bool Post(
+        TrackpadSide side,
+        in InputFrame frame,
+        ushort maxX,
+        ushort maxY,
+        long timestampTicks,
+        PipelineTimestamps timestamps = default)
     {
-        lock (_gate)
+        // Dispose waits for posts that got past this check, so every accepted frame is
+        // either processed or counted as a drop, never stranded in the ring.
+        Interlocked.Increment(ref _activePosts);
+        try
         {
-            if (_disposing)
-            {
-                return false;
-            }
+            return Volatile.Read(ref _disposing)
+                ? false
+                : PostCore(side, in frame, maxX, maxY, timestampTicks, timestamps);
+        }
+        finally
+        {
+            Interlocked.Decrement(ref _activePosts);
+        }
+    }
 
-            if (_count >= _queue.Length)
-            {
-                _core.RecordQueueDrop();
-                return false;
-            }
+    private bool PostCore(
+        TrackpadSide side,
+        in InputFrame frame,
+        ushort maxX,
+        ushort maxY,
+        long timestampTicks,
+        PipelineTimestamps timestamps)
+    {
+        if (_latency != null && timestamps.CommitTicks == 0)
+        {
+            // No reader stamp (e.g. a HID source): queueing starts at the post.
+            timestamps = timestamps with { CommitTicks = Stopwatch.GetTimestamp() };
+        }
 
-            _queue[_tail] = new FrameEnvelope(side, frame, maxX, maxY, timestampTicks);
-            _tail = (_tail + 1) % _queue.Length;
-            _count++;
-            _postedCount++;
-            _signal.Set();
-            return true;
+        if (!_queue.TryEnqueue(new FrameEnvelope(side, frame, maxX, maxY, timestampTicks, timestamps)))
+        {
+            _core.RecordQueueDrop();
+            return false;
         }
+
+        Interlocked.Increment(ref _postedCount);
+        return true;
     }
 
     public void Configure(TouchProcessorConfig config)
@@ -6985,7 +7257,7 @@ internal sealed class TouchProcessorActor : IDisposable
 
     public void SetThreeFingerDragEnabled(bool enabled)
     {
-        TouchProcessorCore.PointerDragEffect[] dragScratchBuffer = new TouchProcessorCore.PointerDragEffect[8];
+        Span<TouchProcessorCore.PointerDragEffect> dragScratchBuffer = stackalloc TouchProcessorCore.PointerDragEffect[8];
         lock (_coreGate)
         {
             _core.SetThreeFingerDragEnabled(enabled && _threeFingerDragSink != null);
@@ -7122,14 +7394,18 @@ internal sealed class TouchProcessorActor : IDisposable
             }
         }
 
-        lock (_gate)
+        Volatile.Write(ref _disposing, true);
+        Interlocked.MemoryBarrier();
+        SpinWait spinner = default;
+        while (Volatile.Read(ref _activePosts) != 0)
         {
-            _disposing = true;
-            _signal.Set();
-        }
-
+            spinner.SpinOnce();
+        }
+
+        Volatile.Write(ref _stopping, true);
+        _queue.Wake();
         _thread.Join();
-        _signal.Dispose();
+        _queue.Dispose();
     }
 
     private void RunLoop()
@@ -7138,37 +7414,48 @@ internal sealed class TouchProcessorActor : IDisposable
         TouchProcessorCore.PointerDragEffect[] dragScratchBuffer = new TouchProcessorCore.PointerDragEffect[16];
         while (true)
         {
-            FrameEnvelope frame;
-            bool hasFrame = false;
-            lock (_gate)
-            {
-                if (_count > 0)
-                {
-                    frame = _queue[_head];
-                    _head = (_head + 1) % _queue.Length;
-                    _count--;
-                    hasFrame = true;
-                }
-                else if (_disposing)
-                {
-                    return;
-                }
-                else
-                {
-                    frame = default;
+            if (!_queue.TryDequeue(out FrameEnvelope frame))
+            {
+                if (Volatile.Read(ref _stopping))
+                {
+                    return;
                 }
-            }
 
-            if (!hasFrame)
-            {
-                _signal.WaitOne(4);
+                _queue.WaitForItem();
                 continue;
             }
 
             InputFrame payload = frame.Frame;
+            PipelineTimestamps timestamps = default;
+            if (_latency != null)
+            {
+                timestamps = frame.Timestamps with { DequeueTicks = Stopwatch.GetTimestamp() };
+            }
+
+            bool traceFrame = EngineEventSource.Log.IsFrameEnabled;
             lock (_coreGate)
             {
+                long processStartTicks = traceFrame ? Stopwatch.GetTimestamp() : 0;
                 _core.ProcessFrame(frame.Side, in payload, frame.MaxX, frame.MaxY, frame.TimestampTicks);
+                if (traceFrame)
+                {
+                    long durationNanoseconds = (long)((Stopwatch.GetTimestamp() - processStartTicks) * (1_000_000_000.0 / Stopwatch.Frequency));
+                    EngineEventSource.Log.FrameProcessed((int)frame.Side, payload.GetClampedContactCount(), durationNanoseconds);
+                }
+
+                if (_latency != null)
+                {
+                    timestamps = timestamps with { ProcessedTicks = Stopwatch.GetTimestamp() };
+                    _latency.RecordFrame(in timestamps);
+                }
+
+                if (_previewChannel != null)
+                {
+                    PreviewChannelFrame preview = PreviewChannelFrame.FromInput(frame.Side, in payload, frame.MaxX, frame.MaxY, frame.TimestampTicks);
+                    _core.CopyPreviewState(ref preview);
+                    _previewChannel.Publish(ref preview);
+                }
+
                 while (true)
                 {
                     int drainedDragEffects = _core.DrainPointerDragEffects(dragScratchBuffer);
@@ -7195,6 +7482,13 @@ internal sealed class TouchProcessorActor : IDisposable
 
                         for (int i = 0; i < drained; i++)
                         {
+                            if (_latency != null)
+                            {
+                                long enqueueTicks = Stopwatch.GetTimestamp();
+                                _latency.Record(PipelineLatencyStage.DispatchEnqueue, timestamps.ProcessedTicks, enqueueTicks);
+                                scratchBuffer[i] = scratchBuffer[i] with { Timestamps = timestamps with { EnqueueTicks = enqueueTicks } };
+                            }
+
                             if (!_dispatchQueue.TryEnqueue(in scratchBuffer[i]))
                             {
                                 _core.RecordDispatchDrop();
@@ -7241,5 +7535,6 @@ internal sealed class TouchProcessorActor : IDisposable
         InputFrame Frame,
         ushort MaxX,
         ushort MaxY,
-        long TimestampTicks);
+        long TimestampTicks,
+        PipelineTimestamps Timestamps);
 }
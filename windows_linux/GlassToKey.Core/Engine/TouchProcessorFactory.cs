@@ -7,14 +7,14 @@ internal static class TouchProcessorFactory
     private const double KeyWidthMm = 18.0;
     private const double KeyHeightMm = 17.0;
 
-    public static TouchProcessorCore CreateDefault(KeymapStore keymap, TrackpadLayoutPreset? preset = null, TouchProcessorConfig? config = null)
+    public static TouchProcessorCore CreateDefault(KeymapStore keymap, TrackpadLayoutPreset? preset = null, TouchProcessorConfig? config = null, TimeProvider? clock = null)
     {
         TrackpadLayoutPreset layoutPreset = preset ?? TrackpadLayoutPreset.SixByThree;
         keymap.SetActiveLayout(layoutPreset.Name);
         ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(layoutPreset.Columns);
         KeyLayout left = LayoutBuilder.BuildLayout(layoutPreset, TrackpadWidthMm, TrackpadHeightMm, KeyWidthMm, KeyHeightMm, columns, mirrored: true);
         KeyLayout right = LayoutBuilder.BuildLayout(layoutPreset, TrackpadWidthMm, TrackpadHeightMm, KeyWidthMm, KeyHeightMm, columns, mirrored: false);
-        TouchProcessorCore core = new(left, right, keymap, config);
+        TouchProcessorCore core = new(left, right, keymap, config, clock);
         core.SetPersistentLayer(0);
         return core;
     }
@@ -22,7 +22,8 @@ internal static class TouchProcessorFactory
     public static TouchProcessorCore CreateConfigured(
         KeymapStore keymap,
         UserSettings settings,
-        TrackpadLayoutPreset? preset = null)
+        TrackpadLayoutPreset? preset = null,
+        TimeProvider? clock = null)
     {
         ArgumentNullException.ThrowIfNull(keymap);
         ArgumentNullException.ThrowIfNull(settings);
@@ -37,7 +38,7 @@ internal static class TouchProcessorFactory
         RuntimeConfigurationFactory.BuildLayouts(profile, keymap, layoutPreset, columns, out KeyLayout left, out KeyLayout right);
         TouchProcessorConfig config = RuntimeConfigurationFactory.BuildTouchConfig(profile);
 
-        TouchProcessorCore core = new(left, right, keymap, config);
+        TouchProcessorCore core = new(left, right, keymap, config, clock);
         core.SetPersistentLayer(Math.Clamp(profile.ActiveLayer, 0, 7));
         core.SetTypingEnabled(profile.TypingEnabled);
         core.SetKeyboardModeEnabled(profile.KeyboardModeEnabled);
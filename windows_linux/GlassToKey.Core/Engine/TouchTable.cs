@@ -12,6 +12,8 @@ internal struct TouchTable<TValue> where TValue : struct
     private ulong[] _keys;
     private TValue[] _values;
     private byte[] _states;
+    private ulong[]? _compactKeys;
+    private TValue[]? _compactValues;
     private int _count;
     private int _tombstones;
 
@@ -21,6 +23,8 @@ internal struct TouchTable<TValue> where TValue : struct
         _keys = new ulong[capacity];
         _values = new TValue[capacity];
         _states = new byte[capacity];
+        _compactKeys = null;
+        _compactValues = null;
         _count = 0;
         _tombstones = 0;
     }
@@ -198,10 +202,57 @@ internal struct TouchTable<TValue> where TValue : struct
         // instead of growing unboundedly due churn-heavy workloads.
         if ((desiredCount + _tombstones) * 2 >= capacity)
         {
-            Rehash(capacity);
+            CompactTombstones();
         }
     }
 
+    // Same-capacity rehash through scratch arrays that are kept for the table's lifetime, so
+    // steady touch churn does not allocate a new table every few hundred frames.
+    private void CompactTombstones()
+    {
+        int capacity = _keys.Length;
+        if (_compactKeys == null || _compactKeys.Length != capacity)
+        {
+            _compactKeys = new ulong[capacity];
+            _compactValues = new TValue[capacity];
+        }
+
+        TValue[] compactValues = _compactValues!;
+        int liveCount = 0;
+        for (int i = 0; i < capacity; i++)
+        {
+            if (_states[i] != SlotOccupied)
+            {
+                continue;
+            }
+
+            _compactKeys[liveCount] = _keys[i];
+            compactValues[liveCount] = _values[i];
+            liveCount++;
+        }
+
+        Array.Clear(_states, 0, capacity);
+        Array.Clear(_values, 0, capacity);
+        _count = 0;
+        _tombstones = 0;
+        int mask = capacity - 1;
+        for (int i = 0; i < liveCount; i++)
+        {
+            int index = HashIndex(_compactKeys[i], mask);
+            while (_states[index] == SlotOccupied)
+            {
+                index = (index + 1) & mask;
+            }
+
+            _keys[index] = _compactKeys[i];
+            _values[index] = compactValues[i];
+            _states[index] = SlotOccupied;
+            _count++;
+        }
+
+        Array.Clear(compactValues, 0, liveCount);
+    }
+
     private void Rehash(int newCapacity)
     {
         TouchTable<TValue> next = new(newCapacity);
@@ -5,7 +5,8 @@ public readonly record struct TrackpadFrameEnvelope(
     InputFrame Frame,
     ushort MaxX,
     ushort MaxY,
-    long TimestampTicks);
+    long TimestampTicks,
+    PipelineTimestamps Timestamps = default);
 
 public interface ITrackpadFrameTarget
 {
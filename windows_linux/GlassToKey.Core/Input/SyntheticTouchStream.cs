@@ -0,0 +1,280 @@
+using System;
+using System.Diagnostics;
+
+namespace GlassToKey;
+
+public enum SyntheticTouchPattern
+{
+    // Cycles through the patterns below, one round each.
+    Mixed = 0,
+    // Both hands tapping keys, alternating, with occasional rollover.
+    Typing = 1,
+    // Three to five fingers (up to MaxContacts) sliding together on one side.
+    Swipe = 2,
+    // One finger held still on one side while the other side types.
+    Hold = 3,
+    // Four fingers resting on one side (chord shift) while the other side types.
+    ChordShift = 4
+}
+
+public readonly record struct SyntheticTouchStreamOptions(
+    double ReportRateHz = 1000.0,
+    int MaxContacts = InputFrame.MaxContacts,
+    SyntheticTouchPattern Pattern = SyntheticTouchPattern.Mixed,
+    int Seed = 1,
+    ushort MaxX = 7612,
+    ushort MaxY = 5065);
+
+public readonly record struct SyntheticTouchFrame(TrackpadSide Side, InputFrame Frame, long Tick, long TimestampTicks);
+
+// Deterministic two-trackpad report stream for stress runs and tests. Every report tick
+// yields one frame per side (left first), like two devices polled by one reader; the same
+// options and seed always produce the same frames. Generating a frame does not allocate.
+public sealed class SyntheticTouchStream
+{
+    private const byte TipAndConfidence = 0x03;
+    private const int MaxScheduledContacts = 16;
+
+    private readonly SyntheticTouchStreamOptions _options;
+    private readonly int _maxContacts;
+    private readonly long _startTicks;
+    private readonly double _ticksPerReport;
+    private readonly Random _random;
+    private readonly SideSchedule _left = new();
+    private readonly SideSchedule _right = new();
+    private long _tick;
+    private long _roundEndTick;
+    private int _round;
+    private bool _rightPending;
+
+    public SyntheticTouchStream(SyntheticTouchStreamOptions options, long startTicks = 0)
+    {
+        if (!(options.ReportRateHz > 0))
+        {
+            throw new ArgumentOutOfRangeException(nameof(options), "Report rate must be positive.");
+        }
+
+        _options = options;
+        _maxContacts = Math.Clamp(options.MaxContacts, 1, InputFrame.MaxContacts);
+        _startTicks = startTicks;
+        _ticksPerReport = Stopwatch.Frequency / options.ReportRateHz;
+        _random = new Random(options.Seed);
+    }
+
+    public SyntheticTouchStreamOptions Options => _options;
+
+    // Report ticks generated so far, counting both sides of a tick once.
+    public long Tick => _tick;
+
+    public long TimestampForTick(long tick)
+    {
+        return _startTicks + (long)(tick * _ticksPerReport);
+    }
+
+    public SyntheticTouchFrame Next()
+    {
+        if (!_rightPending)
+        {
+            if (_tick >= _roundEndTick)
+            {
+                StartRound();
+            }
+
+            _rightPending = true;
+            return BuildFrame(TrackpadSide.Left, _left);
+        }
+
+        _rightPending = false;
+        SyntheticTouchFrame right = BuildFrame(TrackpadSide.Right, _right);
+        _tick++;
+        return right;
+    }
+
+    private SyntheticTouchFrame BuildFrame(TrackpadSide side, SideSchedule schedule)
+    {
+        long timestampTicks = TimestampForTick(_tick);
+        InputFrame frame = new()
+        {
+            ArrivalQpcTicks = timestampTicks,
+            ScanTime = (ushort)(_tick * 10)
+        };
+
+        int count = 0;
+        for (int index = 0; index < schedule.Count && count < _maxContacts; index++)
+        {
+            ref ScheduledContact contact = ref schedule.Contacts[index];
+            if (_tick < contact.StartTick || _tick >= contact.EndTick)
+            {
+                continue;
+            }
+
+            double elapsed = _tick - contact.StartTick;
+            double x = Math.Clamp(contact.X + (contact.VelocityX * elapsed), 0.01, 0.99);
+            double y = Math.Clamp(contact.Y + (contact.VelocityY * elapsed), 0.01, 0.99);
+            frame.SetContact(count++, new ContactFrame(
+                contact.Id,
+                (ushort)(x * _options.MaxX),
+                (ushort)(y * _options.MaxY),
+                TipAndConfidence,
+                Pressure: 0,
+                Phase: 0,
+                HasForceData: false));
+        }
+
+        frame.ContactCount = (byte)count;
+        return new SyntheticTouchFrame(side, frame, _tick, timestampTicks);
+    }
+
+    private void StartRound()
+    {
+        SyntheticTouchPattern pattern = _options.Pattern == SyntheticTouchPattern.Mixed
+            ? (SyntheticTouchPattern)(1 + (_round % 4))
+            : _options.Pattern;
+        // Alternate which hand leads so both sides see every role.
+        bool leftLeads = (_round & 1) == 0;
+        SideSchedule lead = leftLeads ? _left : _right;
+        SideSchedule other = leftLeads ? _right : _left;
+        _round++;
+        lead.Clear();
+        other.Clear();
+
+        long start = _tick;
+        long end;
+        switch (pattern)
+        {
+            case SyntheticTouchPattern.Swipe:
+                end = ScheduleSwipe(lead, start);
+                break;
+            case SyntheticTouchPattern.Hold:
+            {
+                long typingEnd = ScheduleTyping(other, start + MsToTicks(120), staggerMs: 0);
+                ScheduleHold(lead, start, typingEnd, fingers: 1);
+                end = typingEnd;
+                break;
+            }
+            case SyntheticTouchPattern.ChordShift:
+            {
+                long typingEnd = ScheduleTyping(other, start + MsToTicks(80), staggerMs: 0);
+                ScheduleHold(lead, start, typingEnd, fingers: Math.Min(4, _maxContacts));
+                end = typingEnd;
+                break;
+            }
+            default:
+                end = Math.Max(
+                    ScheduleTyping(lead, start, staggerMs: 0),
+                    ScheduleTyping(other, start, staggerMs: 45));
+                break;
+        }
+
+        // All fingers up for a moment between rounds, as between words or gestures.
+        _roundEndTick = end + MsToTicks(60 + _random.Next(80));
+    }
+
+    private long ScheduleTyping(SideSchedule schedule, long start, int staggerMs)
+    {
+        int taps = 6 + _random.Next(7);
+        long at = start + MsToTicks(staggerMs);
+        long end = at;
+        for (int tap = 0; tap < taps; tap++)
+        {
+            long down = MsToTicks(35 + _random.Next(40));
+            // Spacing shorter than the previous press gives two-key rollover.
+            long spacing = MsToTicks(55 + _random.Next(70));
+            schedule.Add(NextId(schedule), at, at + down, 0.1 + (_random.NextDouble() * 0.8), 0.2 + (_random.NextDouble() * 0.7), 0, 0);
+            end = Math.Max(end, at + down);
+            at += spacing;
+        }
+
+        return end;
+    }
+
+    private long ScheduleSwipe(SideSchedule schedule, long start)
+    {
+        int fingers = Math.Min(_maxContacts, 3 + _random.Next(3));
+        long duration = MsToTicks(180 + _random.Next(120));
+        double direction = _random.Next(2) == 0 ? 1.0 : -1.0;
+        bool horizontal = _random.Next(3) != 0;
+        double travel = 0.45 / Math.Max(1, duration);
+        double originX = direction > 0 ? 0.2 : 0.7;
+        double originY = 0.35 + (_random.NextDouble() * 0.2);
+        long end = start;
+        for (int finger = 0; finger < fingers; finger++)
+        {
+            long fingerStart = start + finger;
+            long fingerEnd = fingerStart + duration;
+            double x = horizontal ? originX : 0.3 + (finger * 0.12);
+            double y = horizontal ? originY + (finger * 0.08) : (direction > 0 ? 0.2 : 0.75);
+            schedule.Add(
+                NextId(schedule),
+                fingerStart,
+                fingerEnd,
+                x,
+                y,
+                horizontal ? direction * travel : 0,
+                horizontal ? 0 : direction * travel);
+            end = Math.Max(end, fingerEnd);
+        }
+
+        return end;
+    }
+
+    private void ScheduleHold(SideSchedule schedule, long start, long end, int fingers)
+    {
+        for (int finger = 0; finger < fingers; finger++)
+        {
+            schedule.Add(NextId(schedule), start + finger, end, 0.2 + (finger * 0.15), 0.55 + (_random.NextDouble() * 0.1), 0, 0);
+        }
+    }
+
+    private long MsToTicks(int milliseconds)
+    {
+        return Math.Max(1, (long)Math.Round(milliseconds * _options.ReportRateHz / 1000.0));
+    }
+
+    private static uint NextId(SideSchedule schedule)
+    {
+        return ++schedule.LastId;
+    }
+
+    private struct ScheduledContact
+    {
+        public uint Id;
+        public long StartTick;
+        public long EndTick;
+        public double X;
+        public double Y;
+        public double VelocityX;
+        public double VelocityY;
+    }
+
+    private sealed class SideSchedule
+    {
+        public readonly ScheduledContact[] Contacts = new ScheduledContact[MaxScheduledContacts];
+        public int Count;
+        public uint LastId;
+
+        public void Clear()
+        {
+            Count = 0;
+        }
+
+        public void Add(uint id, long startTick, long endTick, double x, double y, double velocityX, double velocityY)
+        {
+            if (Count >= Contacts.Length)
+            {
+                return;
+            }
+
+            Contacts[Count++] = new ScheduledContact
+            {
+                Id = id,
+                StartTick = startTick,
+                EndTick = endTick,
+                X = x,
+                Y = y,
+                VelocityX = velocityX,
+                VelocityY = velocityY
+            };
+        }
+    }
+}
@@ -2,3 +2,4 @@ using System.Runtime.CompilerServices;
 
 [assembly: InternalsVisibleTo("GlassToKey.Windows")]
 [assembly: InternalsVisibleTo("GlassToKey.Linux")]
+[assembly: InternalsVisibleTo("GlassToKey.Core.Benchmarks")]
@@ -0,0 +1,514 @@
+using System;
+using System.IO;
+using System.IO.MemoryMappedFiles;
+using System.Runtime.InteropServices;
+using System.Runtime.Versioning;
+using System.Threading;
+
+namespace GlassToKey;
+
+// Shared-memory feed of the latest raw contacts and intent state, for viewers in other
+// processes. The engine thread is the only writer: each frame goes into the next slot of a
+// ring, guarded by that slot's seqlock (odd while a write is in progress), and then
+// LatestSequence is advanced. Readers never block the writer; they retry if the slot changed
+// under them. Nothing on the write path allocates.
+//
+// File layout: PreviewChannelHeader, padded to HeaderSize, then SlotCount slots of SlotSize
+// bytes. Each slot is a long seqlock followed by a PreviewChannelFrame.
+[StructLayout(LayoutKind.Sequential, Pack = 4)]
+public struct PreviewChannelContact
+{
+    public uint Id;
+    public ushort X;
+    public ushort Y;
+    public byte Pressure;
+    public byte Flags;
+    public ushort Reserved;
+
+    public readonly bool TipSwitch => (Flags & 0x02) != 0;
+    public readonly bool Confidence => (Flags & 0x01) != 0;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 4)]
+public struct PreviewChannelFrame
+{
+    public const byte TypingEnabledFlag = 0x01;
+    public const byte KeyboardModeEnabledFlag = 0x02;
+    public const byte MomentaryLayerActiveFlag = 0x04;
+
+    public long Sequence;
+    public long TimestampTicks;
+    public long FramesProcessed;
+    public ushort MaxX;
+    public ushort MaxY;
+    public byte Side;
+    public byte ContactCount;
+    public byte IsButtonPressed;
+    public byte IntentMode;
+    public byte ActiveLayer;
+    public byte StateFlags;
+    public ushort Reserved;
+    public PreviewChannelContact Contact0;
+    public PreviewChannelContact Contact1;
+    public PreviewChannelContact Contact2;
+    public PreviewChannelContact Contact3;
+    public PreviewChannelContact Contact4;
+
+    public readonly TrackpadSide TrackpadSide => (TrackpadSide)Side;
+
+    public readonly bool TypingEnabled => (StateFlags & TypingEnabledFlag) != 0;
+
+    public readonly bool KeyboardModeEnabled => (StateFlags & KeyboardModeEnabledFlag) != 0;
+
+    public readonly bool MomentaryLayerActive => (StateFlags & MomentaryLayerActiveFlag) != 0;
+
+    public readonly string IntentModeName => ((IntentMode)IntentMode).ToString();
+
+    public static PreviewChannelFrame FromInput(TrackpadSide side, in InputFrame frame, ushort maxX, ushort maxY, long timestampTicks)
+    {
+        int count = frame.GetClampedContactCount();
+        PreviewChannelFrame preview = new()
+        {
+            TimestampTicks = timestampTicks,
+            MaxX = maxX,
+            MaxY = maxY,
+            Side = (byte)side,
+            ContactCount = (byte)count,
+            IsButtonPressed = frame.IsButtonClicked
+        };
+        for (int index = 0; index < count; index++)
+        {
+            ContactFrame contact = frame.GetContact(index);
+            preview.SetContact(index, new PreviewChannelContact
+            {
+                Id = contact.Id,
+                X = contact.X,
+                Y = contact.Y,
+                Pressure = contact.Pressure8,
+                Flags = contact.Flags
+            });
+        }
+
+        return preview;
+    }
+
+    public readonly PreviewChannelContact GetContact(int index)
+    {
+        return index switch
+        {
+            0 => Contact0,
+            1 => Contact1,
+            2 => Contact2,
+            3 => Contact3,
+            4 => Contact4,
+            _ => throw new ArgumentOutOfRangeException(nameof(index))
+        };
+    }
+
+    public void SetContact(int index, in PreviewChannelContact contact)
+    {
+        switch (index)
+        {
+            case 0:
+                Contact0 = contact;
+                break;
+            case 1:
+                Contact1 = contact;
+                break;
+            case 2:
+                Contact2 = contact;
+                break;
+            case 3:
+                Contact3 = contact;
+                break;
+            case 4:
+                Contact4 = contact;
+                break;
+            default:
+                throw new ArgumentOutOfRangeException(nameof(index));
+        }
+    }
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 4)]
+internal struct PreviewChannelHeader
+{
+    public const ulong ExpectedMagic = 0x31305652504B3247UL; // "G2KPRV01"
+    public const int CurrentVersion = 1;
+
+    public ulong Magic;
+    public int Version;
+    public int SlotCount;
+    public int SlotSize;
+    public int FrameSize;
+    public int WriterProcessId;
+    public int Closed;
+    public long LatestSequence;
+}
+
+internal static class PreviewChannelLayout
+{
+    public const int HeaderSize = 64;
+    public const int SlotLockSize = sizeof(long);
+
+    // Slots are cache-line multiples so a reader spinning on one does not share a line with
+    // the slot being written.
+    public static unsafe int SlotSize => (SlotLockSize + sizeof(PreviewChannelFrame) + 63) & ~63;
+
+    public static long Length(int slotCount) => HeaderSize + ((long)slotCount * SlotSize);
+}
+
+public sealed unsafe class PreviewChannelWriter : IDisposable
+{
+    public const int DefaultSlotCount = 64;
+    private const UnixFileMode PrivateDirectoryMode = UnixFileMode.UserRead | UnixFileMode.UserWrite | UnixFileMode.UserExecute;
+    private const UnixFileMode PrivateFileMode = UnixFileMode.UserRead | UnixFileMode.UserWrite;
+
+    private readonly MemoryMappedFile _file;
+    private readonly MemoryMappedViewAccessor _view;
+    private readonly byte* _base;
+    private readonly PreviewChannelHeader* _header;
+    private readonly int _slotCount;
+    private readonly int _slotSize;
+    private long _sequence;
+    private int _disposed;
+
+    private PreviewChannelWriter(MemoryMappedFile file, MemoryMappedViewAccessor view, byte* basePointer, int slotCount)
+    {
+        _file = file;
+        _view = view;
+        _base = basePointer;
+        _header = (PreviewChannelHeader*)basePointer;
+        _slotCount = slotCount;
+        _slotSize = PreviewChannelLayout.SlotSize;
+    }
+
+    public string Path { get; private init; } = string.Empty;
+
+    public long Sequence => Volatile.Read(ref _sequence);
+
+    // Replaces any previous channel at path. The old file is unlinked rather than truncated,
+    // so a viewer that still maps it keeps valid pages and sees Closed instead of SIGBUS.
+    // On Unix the directory and file are private to the current user: frames carry raw
+    // touch contacts, and the directory may sit in world-writable /dev/shm.
+    public static PreviewChannelWriter Create(string path, int slotCount = DefaultSlotCount)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(path);
+        ArgumentOutOfRangeException.ThrowIfLessThan(slotCount, 2);
+
+        string? directory = System.IO.Path.GetDirectoryName(path);
+        if (!string.IsNullOrWhiteSpace(directory))
+        {
+            if (OperatingSystem.IsWindows())
+            {
+                Directory.CreateDirectory(directory);
+            }
+            else
+            {
+                EnsurePrivateDirectory(directory);
+            }
+        }
+
+        if (File.Exists(path))
+        {
+            File.Delete(path);
+        }
+
+        long length = PreviewChannelLayout.Length(slotCount);
+        FileStreamOptions options = new()
+        {
+            Mode = FileMode.CreateNew,
+            Access = FileAccess.ReadWrite,
+            Share = FileShare.ReadWrite | FileShare.Delete
+        };
+        if (!OperatingSystem.IsWindows())
+        {
+            options.UnixCreateMode = PrivateFileMode;
+        }
+
+        FileStream stream = new(path, options);
+        MemoryMappedFile? file = null;
+        MemoryMappedViewAccessor? view = null;
+        byte* basePointer = null;
+        try
+        {
+            stream.SetLength(length);
+            file = MemoryMappedFile.CreateFromFile(
+                stream,
+                mapName: null,
+                capacity: 0,
+                MemoryMappedFileAccess.ReadWrite,
+                HandleInheritability.None,
+                leaveOpen: false);
+            view = file.CreateViewAccessor(0, length, MemoryMappedFileAccess.ReadWrite);
+            view.SafeMemoryMappedViewHandle.AcquirePointer(ref basePointer);
+            basePointer += view.PointerOffset;
+            new Span<byte>(basePointer, checked((int)length)).Clear();
+
+            PreviewChannelHeader* header = (PreviewChannelHeader*)basePointer;
+            header->Version = PreviewChannelHeader.CurrentVersion;
+            header->SlotCount = slotCount;
+            header->SlotSize = PreviewChannelLayout.SlotSize;
+            header->FrameSize = sizeof(PreviewChannelFrame);
+            header->WriterProcessId = Environment.ProcessId;
+            // Magic goes last so a reader never accepts a half-initialized header.
+            Volatile.Write(ref header->Magic, PreviewChannelHeader.ExpectedMagic);
+            return new PreviewChannelWriter(file, view, basePointer, slotCount) { Path = path };
+        }
+        catch
+        {
+            if (basePointer != null)
+            {
+                view!.SafeMemoryMappedViewHandle.ReleasePointer();
+            }
+
+            view?.Dispose();
+            if (file != null)
+            {
+                file.Dispose();
+            }
+            else
+            {
+                stream.Dispose();
+            }
+
+            throw;
+        }
+    }
+
+    [UnsupportedOSPlatform("windows")]
+    private static void EnsurePrivateDirectory(string directory)
+    {
+        Directory.CreateDirectory(directory, PrivateDirectoryMode);
+        if (new DirectoryInfo(directory).LinkTarget != null)
+        {
+            throw new IOException($"Preview channel directory '{directory}' is a symbolic link.");
+        }
+
+        // chmod succeeds only for the owner, so this rejects a directory another user
+        // pre-created and also tightens one of ours that was left group/world accessible.
+        File.SetUnixFileMode(directory, PrivateDirectoryMode);
+    }
+
+    // Single writer: only the engine thread may call this, and the owner disposes the writer
+    // only after that thread stopped. Assigns frame.Sequence.
+    public void Publish(ref PreviewChannelFrame frame)
+    {
+        if (Volatile.Read(ref _disposed) != 0)
+        {
+            return;
+        }
+
+        long sequence = _sequence + 1;
+        frame.Sequence = sequence;
+        byte* slot = _base + PreviewChannelLayout.HeaderSize + ((sequence % _slotCount) * _slotSize);
+        long* slotLock = (long*)slot;
+        long version = *slotLock;
+        Volatile.Write(ref *slotLock, version + 1);
+        Interlocked.MemoryBarrier();
+        *(PreviewChannelFrame*)(slot + PreviewChannelLayout.SlotLockSize) = frame;
+        Volatile.Write(ref *slotLock, version + 2);
+        Volatile.Write(ref _header->LatestSequence, sequence);
+        Volatile.Write(ref _sequence, sequence);
+    }
+
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _disposed, 1) != 0)
+        {
+            return;
+        }
+
+        Volatile.Write(ref _header->Closed, 1);
+        _view.SafeMemoryMappedViewHandle.ReleasePointer();
+        _view.Dispose();
+        _file.Dispose();
+        try
+        {
+            File.Delete(Path);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            // A leftover file is replaced by the next writer.
+        }
+    }
+}
+
+public sealed unsafe class PreviewChannelReader : IDisposable
+{
+    private const int MaxReadAttempts = 64;
+
+    private readonly MemoryMappedFile _file;
+    private readonly MemoryMappedViewAccessor _view;
+    private readonly byte* _base;
+    private readonly PreviewChannelHeader* _header;
+    private readonly int _slotCount;
+    private readonly int _slotSize;
+    private int _disposed;
+
+    private PreviewChannelReader(MemoryMappedFile file, MemoryMappedViewAccessor view, byte* basePointer)
+    {
+        _file = file;
+        _view = view;
+        _base = basePointer;
+        _header = (PreviewChannelHeader*)basePointer;
+        _slotCount = _header->SlotCount;
+        _slotSize = _header->SlotSize;
+        WriterProcessId = _header->WriterProcessId;
+    }
+
+    public int WriterProcessId { get; }
+
+    public long LatestSequence => Volatile.Read(ref _header->LatestSequence);
+
+    // Set once the writer shut down; a new runtime publishes through a new file at the same
+    // path, so viewers reopen.
+    public bool IsClosed => Volatile.Read(ref _header->Closed) != 0;
+
+    // Returns false when there is no channel at path or it was written by an incompatible build.
+    public static bool TryOpen(string path, out PreviewChannelReader? reader)
+    {
+        reader = null;
+        FileStream stream;
+        try
+        {
+            stream = new FileStream(path, FileMode.Open, FileAccess.Read, FileShare.ReadWrite | FileShare.Delete);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            return false;
+        }
+
+        long fileLength = stream.Length;
+        if (fileLength < PreviewChannelLayout.HeaderSize)
+        {
+            stream.Dispose();
+            return false;
+        }
+
+        MemoryMappedFile? file = null;
+        MemoryMappedViewAccessor? view = null;
+        byte* basePointer = null;
+        try
+        {
+            file = MemoryMappedFile.CreateFromFile(
+                stream,
+                mapName: null,
+                capacity: 0,
+                MemoryMappedFileAccess.Read,
+                HandleInheritability.None,
+                leaveOpen: false);
+            view = file.CreateViewAccessor(0, 0, MemoryMappedFileAccess.Read);
+            view.SafeMemoryMappedViewHandle.AcquirePointer(ref basePointer);
+            basePointer += view.PointerOffset;
+
+            PreviewChannelHeader* header = (PreviewChannelHeader*)basePointer;
+            if (Volatile.Read(ref header->Magic) != PreviewChannelHeader.ExpectedMagic ||
+                header->Version != PreviewChannelHeader.CurrentVersion ||
+                header->FrameSize != sizeof(PreviewChannelFrame) ||
+                header->SlotSize != PreviewChannelLayout.SlotSize ||
+                header->SlotCount < 2 ||
+                PreviewChannelLayout.Length(header->SlotCount) > fileLength)
+            {
+                view.SafeMemoryMappedViewHandle.ReleasePointer();
+                view.Dispose();
+                file.Dispose();
+                return false;
+            }
+
+            reader = new PreviewChannelReader(file, view, basePointer);
+            return true;
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            if (basePointer != null)
+            {
+                view!.SafeMemoryMappedViewHandle.ReleasePointer();
+            }
+
+            view?.Dispose();
+            if (file != null)
+            {
+                file.Dispose();
+            }
+            else
+            {
+                stream.Dispose();
+            }
+
+            return false;
+        }
+    }
+
+    public bool TryReadLatest(out PreviewChannelFrame frame)
+    {
+        for (int attempt = 0; attempt < MaxReadAttempts; attempt++)
+        {
+            long latest = LatestSequence;
+            if (latest == 0)
+            {
+                break;
+            }
+
+            if (TryRead(latest, out frame))
+            {
+                return true;
+            }
+        }
+
+        frame = default;
+        return false;
+    }
+
+    // False when sequence was never written or the ring has already wrapped past it.
+    public bool TryRead(long sequence, out PreviewChannelFrame frame)
+    {
+        frame = default;
+        if (sequence <= 0 || sequence > LatestSequence)
+        {
+            return false;
+        }
+
+        byte* slot = _base + PreviewChannelLayout.HeaderSize + ((sequence % _slotCount) * _slotSize);
+        long* slotLock = (long*)slot;
+        for (int attempt = 0; attempt < MaxReadAttempts; attempt++)
+        {
+            long before = Volatile.Read(ref *slotLock);
+            if ((before & 1) != 0)
+            {
+                Thread.SpinWait(1);
+                continue;
+            }
+
+            frame = *(PreviewChannelFrame*)(slot + PreviewChannelLayout.SlotLockSize);
+            Interlocked.MemoryBarrier();
+            if (Volatile.Read(ref *slotLock) != before)
+            {
+                continue;
+            }
+
+            if (frame.Sequence != sequence)
+            {
+                frame = default;
+                return false;
+            }
+
+            return true;
+        }
+
+        frame = default;
+        return false;
+    }
+
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _disposed, 1) != 0)
+        {
+            return;
+        }
+
+        _view.SafeMemoryMappedViewHandle.ReleasePointer();
+        _view.Dispose();
+        _file.Dispose();
+    }
+}
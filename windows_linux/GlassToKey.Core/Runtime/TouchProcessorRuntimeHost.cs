@@ -1,11 +1,19 @@
+using System.Diagnostics;
+
 namespace GlassToKey;
 
 public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposable
 {
+    // TryGetSnapshot runs per frame; histogram percentiles only need to be this fresh there.
+    private static readonly long PipelineLatencyRefreshTicks = Stopwatch.Frequency / 4;
+
     private readonly IInputDispatcher _dispatcher;
+    private readonly PipelineLatencyRecorder _latency = new();
     private readonly DispatchEventQueue _dispatchQueue;
     private readonly DispatchEventPump _dispatchPump;
     private readonly TouchProcessorActor _actor;
+    private PipelineLatencySnapshot _latencySnapshot = PipelineLatencySnapshot.Empty;
+    private long _latencySnapshotTicks;
     private bool _disposed;
 
     public TouchProcessorRuntimeHost(
@@ -14,7 +22,8 @@ public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposabl
         TrackpadLayoutPreset? preset = null,
         UserSettings? settings = null,
         bool ignoreTypingToggleActions = false,
-        bool pureKeyboardIntent = false)
+        bool pureKeyboardIntent = false,
+        PreviewChannelWriter? previewChannel = null)
     {
         ArgumentNullException.ThrowIfNull(dispatcher);
         _dispatcher = dispatcher;
@@ -27,12 +36,19 @@ public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposabl
         _actor = new TouchProcessorActor(
             core,
             dispatchQueue: _dispatchQueue,
-            threeFingerDragSink: dispatcher as IThreeFingerDragSink);
+            threeFingerDragSink: dispatcher as IThreeFingerDragSink,
+            previewChannel: previewChannel,
+            latency: _latency);
         _actor.SetHapticsOnKeyDispatchEnabled(settings?.HapticsEnabled ?? false);
         _actor.SetPointerIntentEnabled(!pureKeyboardIntent);
         _actor.SetTypingToggleActionsEnabled(!ignoreTypingToggleActions);
         _actor.SetThreeFingerDragEnabled(settings?.ThreeFingerDragEnabled == true);
-        _dispatchPump = new DispatchEventPump(_dispatchQueue, dispatcher);
+        if (dispatcher is IPipelineLatencySink latencySink)
+        {
+            latencySink.AttachPipelineLatency(_latency);
+        }
+
+        _dispatchPump = new DispatchEventPump(_dispatchQueue, dispatcher, _latency);
         if (settings != null)
         {
             ConfigureDispatcherAutocorrect(dispatcher, settings);
@@ -47,7 +63,13 @@ public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposabl
         }
 
         InputFrame payload = frame.Frame;
-        return _actor.Post(frame.Side, in payload, frame.MaxX, frame.MaxY, frame.TimestampTicks);
+        return _actor.Post(frame.Side, in payload, frame.MaxX, frame.MaxY, frame.TimestampTicks, frame.Timestamps);
+    }
+
+    // Per-stage latency from kernel timestamp to output write since the host started.
+    public PipelineLatencySnapshot GetPipelineLatency()
+    {
+        return _latency.Snapshot();
     }
 
     public bool RequestsExclusiveInput => false;
@@ -90,6 +112,7 @@ public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposabl
             GesturePriorityRight: engineSnapshot.GesturePriorityRight,
             ChordShiftLeft: engineSnapshot.ChordShiftLeft,
             ChordShiftRight: engineSnapshot.ChordShiftRight,
+            EnabledGestureRecognizers: engineSnapshot.EnabledGestureRecognizers,
             IntentMode: engineSnapshot.IntentMode.ToString(),
             FramesProcessed: engineSnapshot.FramesProcessed,
             QueueDrops: engineSnapshot.QueueDrops,
@@ -118,7 +141,11 @@ public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposabl
             DispatcherActiveModifiers: dispatcherSnapshot.ActiveModifiers,
             DispatcherLastDispatchTicks: dispatcherSnapshot.LastDispatchTicks,
             DispatcherLastTickTicks: dispatcherSnapshot.LastTickTicks,
-            DispatcherLastError: dispatcherSnapshot.LastErrorMessage);
+            DispatcherLastError: dispatcherSnapshot.LastErrorMessage,
+            DispatcherOutputFlushes: dispatcherSnapshot.OutputFlushes,
+            DispatcherOutputWriteCalls: dispatcherSnapshot.OutputWriteCalls,
+            DispatcherOutputEvents: dispatcherSnapshot.OutputEvents,
+            PipelineLatency: GetCachedPipelineLatency());
         return true;
     }
 
@@ -193,6 +220,21 @@ public sealed class TouchProcessorRuntimeHost : ITrackpadFrameTarget, IDisposabl
         _dispatchQueue.Dispose();
     }
 
+    private PipelineLatencySnapshot GetCachedPipelineLatency()
+    {
+        long nowTicks = Stopwatch.GetTimestamp();
+        PipelineLatencySnapshot snapshot = Volatile.Read(ref _latencySnapshot);
+        if (nowTicks - Volatile.Read(ref _latencySnapshotTicks) < PipelineLatencyRefreshTicks)
+        {
+            return snapshot;
+        }
+
+        snapshot = _latency.Snapshot();
+        Volatile.Write(ref _latencySnapshot, snapshot);
+        Volatile.Write(ref _latencySnapshotTicks, nowTicks);
+        return snapshot;
+    }
+
     private static void ConfigureDispatcherAutocorrect(IInputDispatcher dispatcher, UserSettings settings)
     {
         if (dispatcher is not IAutocorrectController autocorrectController)
@@ -22,6 +22,7 @@ public readonly record struct TouchProcessorRuntimeSnapshot(
     bool GesturePriorityRight = false,
     bool ChordShiftLeft = false,
     bool ChordShiftRight = false,
+    GestureRecognizers EnabledGestureRecognizers = GestureRecognizers.None,
     string IntentMode = "Idle",
     long FramesProcessed = 0,
     long QueueDrops = 0,
@@ -50,4 +51,8 @@ public readonly record struct TouchProcessorRuntimeSnapshot(
     int DispatcherActiveModifiers = 0,
     long DispatcherLastDispatchTicks = 0,
     long DispatcherLastTickTicks = 0,
-    string DispatcherLastError = "");
+    string DispatcherLastError = "",
+    long DispatcherOutputFlushes = 0,
+    long DispatcherOutputWriteCalls = 0,
+    long DispatcherOutputEvents = 0,
+    PipelineLatencySnapshot? PipelineLatency = null);
@@ -0,0 +1,53 @@
+using System;
+using System.Diagnostics;
+using System.Threading;
+
+namespace GlassToKey;
+
+// Simulated clock for the engine and dispatchers. Timestamps are Stopwatch ticks, the unit
+// every hold, repeat and grace constant in the pipeline is computed in, and they only move
+// when the driver advances them: a replay full of holds and key repeats then runs as fast
+// as frames can be processed and produces the same output on every run. Only GetTimestamp
+// is simulated; wall-clock time and timers still come from the system.
+public sealed class VirtualTimeProvider : TimeProvider
+{
+    private long _nowTicks;
+
+    public VirtualTimeProvider(long startTicks = 0)
+    {
+        _nowTicks = startTicks;
+    }
+
+    public override long TimestampFrequency => Stopwatch.Frequency;
+
+    public override long GetTimestamp()
+    {
+        return Volatile.Read(ref _nowTicks);
+    }
+
+    // Time never runs backwards: a target at or before the current time is ignored.
+    public void AdvanceTo(long timestampTicks)
+    {
+        long current = Volatile.Read(ref _nowTicks);
+        while (timestampTicks > current)
+        {
+            long observed = Interlocked.CompareExchange(ref _nowTicks, timestampTicks, current);
+            if (observed == current)
+            {
+                return;
+            }
+
+            current = observed;
+        }
+    }
+
+    public void Advance(TimeSpan duration)
+    {
+        if (duration < TimeSpan.Zero)
+        {
+            throw new ArgumentOutOfRangeException(nameof(duration), "Virtual time cannot run backwards.");
+        }
+
+        Interlocked.Add(ref _nowTicks, (long)(duration.TotalSeconds * Stopwatch.Frequency));
+    }
+}
@@ -139,6 +139,11 @@ public class SymSpell
     /// <summary>Number of word prefixes and intermediate word deletes encoded in the dictionary.</summary>
     public int EntryCount { get { return this.deletes.Count; } }
 
+    // GlassToKey: read by SymSpellIndexFile to serialize the built index.
+    internal IReadOnlyDictionary<string, Int64> Words { get { return this.words; } }
+    internal IReadOnlyDictionary<int, string[]> Deletes { get { return this.deletes; } }
+    internal uint CompactMask { get { return this.compactMask; } }
+
     /// <summary>Create a new instanc of SymSpell.</summary>
     /// <remarks>Specifying ann accurate initialCapacity is not essential, 
     /// but it can help speed up processing by aleviating the need for 
@@ -5,7 +5,6 @@ using Avalonia.Controls.Templates;
 using Avalonia.Interactivity;
 using Avalonia.Markup.Xaml;
 using Avalonia.Controls.ApplicationLifetimes;
-using Avalonia.Controls.Shapes;
 using Avalonia.Input;
 using Avalonia.Platform.Storage;
 using Avalonia.Threading;
@@ -118,8 +117,8 @@ public partial class MainWindow : Window
     private readonly TextBlock _runtimeTypingStatusText;
     private readonly TextBlock _leftPreviewText;
     private readonly TextBlock _rightPreviewText;
-    private readonly Canvas _leftPreviewCanvas;
-    private readonly Canvas _rightPreviewCanvas;
+    private readonly TrackpadPreviewSurface _leftPreviewSurface;
+    private readonly TrackpadPreviewSurface _rightPreviewSurface;
     private readonly DispatcherTimer _replayTimer;
     private List<KeyActionChoice> _keyActionChoices = BuildKeyActionChoices();
     private readonly List<ShortcutKeyChoice> _shortcutKeyChoices = BuildShortcutKeyChoices();
@@ -263,8 +262,8 @@ public partial class MainWindow : Window
         _runtimeTypingStatusText = RequireControl<TextBlock>("RuntimeTypingStatusText");
         _leftPreviewText = RequireControl<TextBlock>("LeftPreviewText");
         _rightPreviewText = RequireControl<TextBlock>("RightPreviewText");
-        _leftPreviewCanvas = RequireControl<Canvas>("LeftPreviewCanvas");
-        _rightPreviewCanvas = RequireControl<Canvas>("RightPreviewCanvas");
+        _leftPreviewSurface = RequireControl<TrackpadPreviewSurface>("LeftPreviewSurface");
+        _rightPreviewSurface = RequireControl<TrackpadPreviewSurface>("RightPreviewSurface");
         _keymapPrimaryCombo.ItemTemplate = KeyActionChoiceTemplate;
         _keymapHoldCombo.ItemTemplate = KeyActionChoiceTemplate;
         _gestureShortcutKeyCombo.ItemTemplate = ShortcutKeyChoiceTemplate;
@@ -808,8 +807,8 @@ public partial class MainWindow : Window
         _columnEvenSpaceButton.Click += OnColumnEvenSpaceClick;
         _mxSpacingButton.Click += OnMxSpacingClick;
         _chocSpacingButton.Click += OnChocSpacingClick;
-        _leftPreviewCanvas.PointerPressed += OnLeftPreviewPointerPressed;
-        _rightPreviewCanvas.PointerPressed += OnRightPreviewPointerPressed;
+        _leftPreviewSurface.PointerPressed += OnLeftPreviewPointerPressed;
+        _rightPreviewSurface.PointerPressed += OnRightPreviewPointerPressed;
         _keymapLayerCombo.SelectionChanged += OnKeymapLayerSelectionChanged;
         _keymapPrimaryCombo.SelectionChanged += OnKeymapActionSelectionChanged;
         _keymapHoldCombo.SelectionChanged += OnKeymapActionSelectionChanged;
@@ -901,7 +900,7 @@ public partial class MainWindow : Window
         }
         else
         {
-            ApplyPreviewSnapshot(_previewSnapshot);
+            RefreshPreviewSurfaces();
         }
 
         _loadingScreen = false;
@@ -2129,7 +2128,7 @@ public partial class MainWindow : Window
         EnsureSelectedKeyStillValid();
         RefreshColumnLayoutEditor();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private bool TryCaptureAutoSplayTouches(out ColumnAutoSplayTouch[] touches, out string error)
@@ -2760,7 +2759,7 @@ public partial class MainWindow : Window
 
         EnsureSelectedKeyStillValid();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private void OnKeymapActionSelectionChanged(object? sender, SelectionChangedEventArgs e)
@@ -2776,15 +2775,15 @@ public partial class MainWindow : Window
 
     private void OnLeftPreviewPointerPressed(object? sender, PointerPressedEventArgs e)
     {
-        HandleSurfaceKeymapSelection(TrackpadSide.Left, _leftPreviewCanvas, _leftRenderedLayout, e);
+        HandleSurfaceKeymapSelection(TrackpadSide.Left, _leftPreviewSurface, _leftRenderedLayout, e);
     }
 
     private void OnRightPreviewPointerPressed(object? sender, PointerPressedEventArgs e)
     {
-        HandleSurfaceKeymapSelection(TrackpadSide.Right, _rightPreviewCanvas, _rightRenderedLayout, e);
+        HandleSurfaceKeymapSelection(TrackpadSide.Right, _rightPreviewSurface, _rightRenderedLayout, e);
     }
 
-    private void HandleSurfaceKeymapSelection(TrackpadSide side, Canvas surface, KeyLayout layout, PointerPressedEventArgs e)
+    private void HandleSurfaceKeymapSelection(TrackpadSide side, Control surface, KeyLayout layout, PointerPressedEventArgs e)
     {
         if (IsReplayMode || !e.GetCurrentPoint(surface).Properties.IsLeftButtonPressed)
         {
@@ -2797,7 +2796,7 @@ public partial class MainWindow : Window
         {
             ClearSelectionForEditing();
             RefreshKeymapEditor();
-            ApplyPreviewSnapshot(_previewSnapshot);
+            RefreshPreviewSurfaces();
             return;
         }
 
@@ -2895,7 +2894,7 @@ public partial class MainWindow : Window
         _selectedKeyRow = row;
         _selectedKeyColumn = column;
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
         RevealKeymapEditorAndFocusPrimaryAction();
     }
 
@@ -2908,7 +2907,7 @@ public partial class MainWindow : Window
         _selectedKeyRow = -1;
         _selectedKeyColumn = -1;
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
         RevealCustomButtonEditorAndFocusGeometry();
     }
 
@@ -3214,7 +3213,7 @@ public partial class MainWindow : Window
             }
 
             RefreshKeymapEditor();
-            ApplyPreviewSnapshot(_previewSnapshot);
+            RefreshPreviewSurfaces();
             return;
         }
 
@@ -3245,7 +3244,7 @@ public partial class MainWindow : Window
         }
 
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private void OnKeymapHoldForceCommitted(object? sender, RoutedEventArgs e)
@@ -3294,7 +3293,7 @@ public partial class MainWindow : Window
 
         RenderLayoutsFromCurrentKeymap();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private void OnCustomButtonAddLeftClicked(object? sender, RoutedEventArgs e)
@@ -3358,7 +3357,7 @@ public partial class MainWindow : Window
 
         ClearSelectionForEditing();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private void OnCustomButtonGeometryCommitted(object? sender, RoutedEventArgs e)
@@ -3391,7 +3390,7 @@ public partial class MainWindow : Window
 
         ClearSelectionForEditing();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
         e.Handled = true;
     }
 
@@ -3422,7 +3421,7 @@ public partial class MainWindow : Window
         }
 
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private bool TryPersistEditedKeymap(out string error)
@@ -3581,7 +3580,7 @@ public partial class MainWindow : Window
 
         ClearSelectionForEditing();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
 
         if (!TryImportSettings(localPath, out string message))
         {
@@ -4164,8 +4163,8 @@ public partial class MainWindow : Window
         LinuxAtpCapReplayVisualFrame? current = GetCurrentReplayFrame();
         if (current is null)
         {
-            _leftPreviewCanvas.Children.Clear();
-            _rightPreviewCanvas.Children.Clear();
+            _leftPreviewSurface.Clear();
+            _rightPreviewSurface.Clear();
             ApplyReplayStatus(null);
             UpdateReplayControls();
             return;
@@ -4540,8 +4539,8 @@ public partial class MainWindow : Window
         LinuxInputPreviewTrackpadState? right = GetPreviewState(snapshot, TrackpadSide.Right);
         _leftPreviewText.Text = BuildPreviewDetails(left, _leftRenderedLayout, _renderedKeymap, TrackpadSide.Left, activeLayer, ref _leftStickyTouchedKeys);
         _rightPreviewText.Text = BuildPreviewDetails(right, _rightRenderedLayout, _renderedKeymap, TrackpadSide.Right, activeLayer, ref _rightStickyTouchedKeys);
-        RenderPreviewCanvas(_leftPreviewCanvas, left, _leftRenderedLayout, _renderedKeymap, TrackpadSide.Left, activeLayer, "#D05A2A");
-        RenderPreviewCanvas(_rightPreviewCanvas, right, _rightRenderedLayout, _renderedKeymap, TrackpadSide.Right, activeLayer, "#246A73");
+        RenderPreviewSurface(_leftPreviewSurface, left, _leftRenderedLayout, _renderedKeymap, TrackpadSide.Left, activeLayer);
+        RenderPreviewSurface(_rightPreviewSurface, right, _rightRenderedLayout, _renderedKeymap, TrackpadSide.Right, activeLayer);
     }
 
     private int ResolveVisualizerLayer(LinuxInputPreviewSnapshot snapshot)
@@ -4723,98 +4722,35 @@ public partial class MainWindow : Window
         return stickyTouchedKeys;
     }
 
-    private void RenderPreviewCanvas(
-        Canvas canvas,
+    private void RenderPreviewSurface(
+        TrackpadPreviewSurface surface,
         LinuxInputPreviewTrackpadState? state,
         KeyLayout layout,
         KeymapStore keymap,
         TrackpadSide side,
-        int activeLayer,
-        string accentHex)
+        int activeLayer)
     {
-        canvas.Children.Clear();
-
-        double width = canvas.Width > 0 ? canvas.Width : 300;
-        double height = canvas.Height > 0 ? canvas.Height : 180;
-        canvas.Children.Add(new Rectangle
-        {
-            Width = width,
-            Height = height,
-            RadiusX = 14,
-            RadiusY = 14,
-            Stroke = new SolidColorBrush(Color.Parse("#D9C7B5")),
-            StrokeThickness = 1
-        });
-
-        RenderPreviewKeymapOverlay(canvas, layout, keymap, side, activeLayer, width, height, accentHex);
-        LinuxInputPreviewContact[] visibleContacts = state == null
-            ? Array.Empty<LinuxInputPreviewContact>()
-            : GetVisibleContacts(state);
-
+        surface.UpdateKeymap(layout, keymap, activeLayer, () => BuildPreviewKeyItems(layout, keymap, side, activeLayer));
         if (state == null)
         {
-            canvas.Children.Add(new TextBlock
-            {
-                Text = "No trackpad bound.",
-                Foreground = new SolidColorBrush(Color.Parse("#6A4533"))
-            });
-            Canvas.SetLeft(canvas.Children[^1], 12);
-            Canvas.SetTop(canvas.Children[^1], 12);
+            surface.UpdateContacts(Array.Empty<LinuxInputPreviewContact>(), 0, 0, "No trackpad bound.");
             return;
         }
 
-        if (visibleContacts.Length == 0)
-        {
-            if (state.BindingStatus == LinuxRuntimeBindingStatus.Streaming)
-            {
-                return;
-            }
-
-            canvas.Children.Add(new TextBlock
-            {
-                Text = state.BindingMessage,
-                Foreground = new SolidColorBrush(Color.Parse("#6A4533")),
-                Width = width - 24,
-                TextWrapping = TextWrapping.Wrap
-            });
-            Canvas.SetLeft(canvas.Children[^1], 12);
-            Canvas.SetTop(canvas.Children[^1], 12);
-            return;
-        }
-
-        Color accent = Color.Parse(accentHex);
-        for (int index = 0; index < visibleContacts.Length; index++)
-        {
-            LinuxInputPreviewContact contact = visibleContacts[index];
-            double xRatio = state.MaxX > 0 ? contact.X / (double)state.MaxX : 0.5;
-            double yRatio = state.MaxY > 0 ? contact.Y / (double)state.MaxY : 0.5;
-            double centerX = 12 + xRatio * (width - 24);
-            double centerY = 12 + yRatio * (height - 24);
-            double radius = 18 + Math.Min(24, contact.Pressure / 10.0);
-            bool activeTouch = contact.TipSwitch;
-
-            Ellipse ellipse = new()
-            {
-                Width = radius * 2,
-                Height = radius * 2,
-                Fill = new SolidColorBrush(accent, activeTouch ? 0.55 : 0.12),
-                Stroke = new SolidColorBrush(accent),
-                StrokeThickness = activeTouch ? 2.5 : 1
-            };
-            canvas.Children.Add(ellipse);
-            Canvas.SetLeft(ellipse, centerX - radius);
-            Canvas.SetTop(ellipse, centerY - radius);
+        LinuxInputPreviewContact[] visibleContacts = GetVisibleContacts(state);
+        string? status = visibleContacts.Length == 0 && state.BindingStatus != LinuxRuntimeBindingStatus.Streaming
+            ? state.BindingMessage
+            : null;
+        surface.UpdateContacts(visibleContacts, state.MaxX, state.MaxY, status);
+    }
 
-            TextBlock label = new()
-            {
-                Text = $"f:{contact.Pressure}",
-                Foreground = new SolidColorBrush(Color.Parse("#1E2328")),
-                FontWeight = FontWeight.SemiBold
-            };
-            canvas.Children.Add(label);
-            Canvas.SetLeft(label, centerX - 16);
-            Canvas.SetTop(label, centerY - 8);
-        }
+    // In-place keymap and selection edits keep the same layout and keymap instances, so the
+    // preview overlays are told to rebuild before the redraw.
+    private void RefreshPreviewSurfaces()
+    {
+        _leftPreviewSurface.InvalidateKeymap();
+        _rightPreviewSurface.InvalidateKeymap();
+        ApplyPreviewSnapshot(_previewSnapshot);
     }
 
     private static LinuxInputPreviewContact[] GetVisibleContacts(LinuxInputPreviewTrackpadState state)
@@ -4876,22 +4812,18 @@ public partial class MainWindow : Window
         _renderedKeymap.SetActiveLayout(configuration.LayoutPreset.Name);
     }
 
-    private void RenderPreviewKeymapOverlay(
-        Canvas canvas,
+    private List<TrackpadPreviewKeyItem> BuildPreviewKeyItems(
         KeyLayout layout,
         KeymapStore keymap,
         TrackpadSide side,
-        int activeLayer,
-        double width,
-        double height,
-        string accentHex)
+        int activeLayer)
     {
+        List<TrackpadPreviewKeyItem> items = [];
         if (layout.Rects.Length == 0)
         {
-            return;
+            return items;
         }
 
-        Color accent = Color.Parse(accentHex);
         for (int row = 0; row < layout.Rects.Length; row++)
         {
             for (int col = 0; col < layout.Rects[row].Length; col++)
@@ -4905,39 +4837,7 @@ public partial class MainWindow : Window
                                 _selectedKeySide == side &&
                                 _selectedKeyRow == row &&
                                 _selectedKeyColumn == col;
-
-                Border keyBorder = new()
-                {
-                    Width = Math.Max(22, rect.Width * width),
-                    Height = Math.Max(20, rect.Height * height),
-                    Background = new SolidColorBrush(accent, selected ? 0.22 : 0.08),
-                    BorderBrush = selected
-                        ? new SolidColorBrush(Color.Parse("#E07845"), 0.90)
-                        : new SolidColorBrush(accent, 0.25),
-                    BorderThickness = new Thickness(selected ? 2.5 : 1),
-                    CornerRadius = new CornerRadius(8),
-                    Child = new TextBlock
-                    {
-                        Text = label,
-                        Foreground = new SolidColorBrush(Color.Parse("#6A4533")),
-                        FontSize = 11,
-                        FontWeight = FontWeight.SemiBold,
-                        TextAlignment = TextAlignment.Center,
-                        TextWrapping = TextWrapping.Wrap,
-                        MaxWidth = Math.Max(18, rect.Width * width - 8),
-                        VerticalAlignment = Avalonia.Layout.VerticalAlignment.Center,
-                        HorizontalAlignment = Avalonia.Layout.HorizontalAlignment.Center
-                    },
-                    RenderTransformOrigin = RelativePoint.Center
-                };
-                if (Math.Abs(rect.RotationDegrees) >= 0.00001)
-                {
-                    keyBorder.RenderTransform = new RotateTransform(rect.RotationDegrees);
-                }
-
-                canvas.Children.Add(keyBorder);
-                Canvas.SetLeft(keyBorder, rect.X * width);
-                Canvas.SetTop(keyBorder, rect.Y * height);
+                items.Add(new TrackpadPreviewKeyItem(rect, rect.RotationDegrees, label, IsCustomButton: false, selected));
             }
         }
 
@@ -4948,32 +4848,15 @@ public partial class MainWindow : Window
             bool selected = _hasSelectedCustomButton &&
                             _selectedKeySide == side &&
                             string.Equals(_selectedCustomButtonId, button.Id, StringComparison.Ordinal);
-            Border customBorder = new()
-            {
-                Width = Math.Max(24, button.Rect.Width * width),
-                Height = Math.Max(20, button.Rect.Height * height),
-                Background = new SolidColorBrush(Color.Parse("#E07845"), selected ? 0.30 : 0.20),
-                BorderBrush = new SolidColorBrush(Color.Parse("#E07845"), selected ? 0.95 : 0.65),
-                BorderThickness = new Thickness(selected ? 3.0 : 1.5),
-                CornerRadius = new CornerRadius(10),
-                Child = new TextBlock
-                {
-                    Text = BuildCustomButtonDisplayLabel(button, separator: "\n"),
-                    Foreground = new SolidColorBrush(Color.Parse("#6A4533")),
-                    FontSize = 11,
-                    FontWeight = FontWeight.SemiBold,
-                    TextAlignment = TextAlignment.Center,
-                    TextWrapping = TextWrapping.Wrap,
-                    MaxWidth = Math.Max(18, button.Rect.Width * width - 8),
-                    VerticalAlignment = Avalonia.Layout.VerticalAlignment.Center,
-                    HorizontalAlignment = Avalonia.Layout.HorizontalAlignment.Center
-                }
-            };
-
-            canvas.Children.Add(customBorder);
-            Canvas.SetLeft(customBorder, button.Rect.X * width);
-            Canvas.SetTop(customBorder, button.Rect.Y * height);
+            items.Add(new TrackpadPreviewKeyItem(
+                button.Rect,
+                RotationDegrees: 0,
+                BuildCustomButtonDisplayLabel(button, separator: "\n"),
+                IsCustomButton: true,
+                selected));
         }
+
+        return items;
     }
 
     private static string[] ResolveTouchedLabels(
@@ -5171,7 +5054,7 @@ public partial class MainWindow : Window
         EnsureSelectedKeyStillValid();
         RefreshColumnLayoutEditor();
         RefreshKeymapEditor();
-        ApplyPreviewSnapshot(_previewSnapshot);
+        RefreshPreviewSurfaces();
     }
 
     private bool ClearKeySizePresetOverrides()
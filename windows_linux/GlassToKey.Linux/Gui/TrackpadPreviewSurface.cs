@@ -0,0 +1,423 @@
+using System.Globalization;
+using Avalonia;
+using Avalonia.Controls;
+using Avalonia.Media;
+using Avalonia.Media.Immutable;
+using Avalonia.Rendering;
+using GlassToKey.Linux.Runtime;
+
+namespace GlassToKey.Linux.Gui;
+
+public readonly record struct TrackpadPreviewKeyItem(
+    NormalizedRect Rect,
+    double RotationDegrees,
+    string Label,
+    bool IsCustomButton,
+    bool IsSelected);
+
+// Retained-mode trackpad preview. The keymap overlay is one layer whose key geometry, text and
+// brushes are built once per layout/layer/keymap change; each contact is its own small visual
+// moved by a transform, so a live frame only invalidates the regions the contacts cover.
+public sealed class TrackpadPreviewSurface : Control, ICustomHitTest
+{
+    public static readonly StyledProperty<Color> AccentColorProperty =
+        AvaloniaProperty.Register<TrackpadPreviewSurface, Color>(nameof(AccentColor), Color.Parse("#D05A2A"));
+
+    private const double ContactInset = 12;
+    private const double MaxContactRadius = 18 + 24;
+    private const double ContactExtent = (MaxContactRadius * 2) + 4;
+
+    private static readonly Typeface SemiBoldTypeface = new(FontFamily.Default, FontStyle.Normal, FontWeight.SemiBold);
+    private static readonly Typeface RegularTypeface = new(FontFamily.Default);
+    private static readonly IImmutableSolidColorBrush SurfaceBrush = new ImmutableSolidColorBrush(Color.Parse("#FFF9F1"));
+    private static readonly ImmutablePen OutlinePen = new(new ImmutableSolidColorBrush(Color.Parse("#D9C7B5")), 1);
+    private static readonly IImmutableSolidColorBrush LabelBrush = new ImmutableSolidColorBrush(Color.Parse("#6A4533"));
+    private static readonly IImmutableSolidColorBrush ContactLabelBrush = new ImmutableSolidColorBrush(Color.Parse("#1E2328"));
+    private static readonly Color CustomButtonColor = Color.Parse("#E07845");
+
+    private readonly KeymapLayer _keymapLayer;
+    private readonly List<ContactMarker> _markers = new();
+    private PreviewPalette _palette;
+    private KeyLayout? _layout;
+    private KeymapStore? _keymap;
+    private int _activeLayer = -1;
+    private bool _keymapDirty = true;
+
+    static TrackpadPreviewSurface()
+    {
+        ClipToBoundsProperty.OverrideDefaultValue<TrackpadPreviewSurface>(true);
+    }
+
+    public TrackpadPreviewSurface()
+    {
+        _palette = new PreviewPalette(AccentColor);
+        _keymapLayer = new KeymapLayer(this);
+        VisualChildren.Add(_keymapLayer);
+    }
+
+    public Color AccentColor
+    {
+        get => GetValue(AccentColorProperty);
+        set => SetValue(AccentColorProperty, value);
+    }
+
+    // Marks the overlay stale after an in-place keymap edit; the next UpdateKeymap rebuilds it.
+    public void InvalidateKeymap()
+    {
+        _keymapDirty = true;
+    }
+
+    public void UpdateKeymap(
+        KeyLayout layout,
+        KeymapStore keymap,
+        int activeLayer,
+        Func<IReadOnlyList<TrackpadPreviewKeyItem>> buildItems)
+    {
+        if (!_keymapDirty &&
+            ReferenceEquals(layout, _layout) &&
+            ReferenceEquals(keymap, _keymap) &&
+            activeLayer == _activeLayer)
+        {
+            return;
+        }
+
+        _layout = layout;
+        _keymap = keymap;
+        _activeLayer = activeLayer;
+        _keymapDirty = false;
+        _keymapLayer.SetItems(buildItems());
+    }
+
+    public void UpdateContacts(
+        IReadOnlyList<LinuxInputPreviewContact> contacts,
+        int maxX,
+        int maxY,
+        string? status)
+    {
+        _keymapLayer.SetStatus(status);
+        Size size = GetSurfaceSize();
+        for (int index = 0; index < contacts.Count; index++)
+        {
+            LinuxInputPreviewContact contact = contacts[index];
+            double xRatio = maxX > 0 ? contact.X / (double)maxX : 0.5;
+            double yRatio = maxY > 0 ? contact.Y / (double)maxY : 0.5;
+            Point center = new(
+                ContactInset + (xRatio * (size.Width - (ContactInset * 2))),
+                ContactInset + (yRatio * (size.Height - (ContactInset * 2))));
+            double radius = 18 + Math.Min(24, contact.Pressure / 10.0);
+            GetMarker(index).Show(center, radius, contact.Pressure, contact.TipSwitch);
+        }
+
+        for (int index = contacts.Count; index < _markers.Count; index++)
+        {
+            _markers[index].Hide();
+        }
+    }
+
+    public void Clear()
+    {
+        _keymapLayer.SetItems(Array.Empty<TrackpadPreviewKeyItem>());
+        _keymapLayer.SetStatus(null);
+        _keymapDirty = true;
+        for (int index = 0; index < _markers.Count; index++)
+        {
+            _markers[index].Hide();
+        }
+    }
+
+    public bool HitTest(Point point)
+    {
+        return new Rect(Bounds.Size).Contains(point);
+    }
+
+    protected override void OnPropertyChanged(AvaloniaPropertyChangedEventArgs change)
+    {
+        base.OnPropertyChanged(change);
+        if (change.Property == AccentColorProperty)
+        {
+            _palette = new PreviewPalette(AccentColor);
+            _keymapLayer.Rebuild();
+            for (int index = 0; index < _markers.Count; index++)
+            {
+                _markers[index].InvalidateVisual();
+            }
+        }
+    }
+
+    protected override Size MeasureOverride(Size availableSize)
+    {
+        _keymapLayer.Measure(availableSize);
+        for (int index = 0; index < _markers.Count; index++)
+        {
+            _markers[index].Measure(new Size(ContactExtent, ContactExtent));
+        }
+
+        return new Size(
+            double.IsFinite(Width) ? Width : 300,
+            double.IsFinite(Height) ? Height : 180);
+    }
+
+    protected override Size ArrangeOverride(Size finalSize)
+    {
+        _keymapLayer.Arrange(new Rect(finalSize));
+        for (int index = 0; index < _markers.Count; index++)
+        {
+            _markers[index].Arrange(new Rect(0, 0, ContactExtent, ContactExtent));
+        }
+
+        return finalSize;
+    }
+
+    private Size GetSurfaceSize()
+    {
+        double width = Bounds.Width > 0 ? Bounds.Width : double.IsFinite(Width) ? Width : 300;
+        double height = Bounds.Height > 0 ? Bounds.Height : double.IsFinite(Height) ? Height : 180;
+        return new Size(width, height);
+    }
+
+    private ContactMarker GetMarker(int index)
+    {
+        while (_markers.Count <= index)
+        {
+            ContactMarker marker = new(this);
+            _markers.Add(marker);
+            VisualChildren.Add(marker);
+            InvalidateMeasure();
+        }
+
+        return _markers[index];
+    }
+
+    // Brushes and pens for one accent color, shared by the overlay and every contact marker.
+    private sealed class PreviewPalette
+    {
+        public PreviewPalette(Color accent)
+        {
+            KeyFill = new ImmutableSolidColorBrush(accent, 0.08);
+            SelectedKeyFill = new ImmutableSolidColorBrush(accent, 0.22);
+            KeyPen = new ImmutablePen(new ImmutableSolidColorBrush(accent, 0.25), 1);
+            SelectedKeyPen = new ImmutablePen(new ImmutableSolidColorBrush(CustomButtonColor, 0.90), 2.5);
+            CustomFill = new ImmutableSolidColorBrush(CustomButtonColor, 0.20);
+            SelectedCustomFill = new ImmutableSolidColorBrush(CustomButtonColor, 0.30);
+            CustomPen = new ImmutablePen(new ImmutableSolidColorBrush(CustomButtonColor, 0.65), 1.5);
+            SelectedCustomPen = new ImmutablePen(new ImmutableSolidColorBrush(CustomButtonColor, 0.95), 3.0);
+            ContactFill = new ImmutableSolidColorBrush(accent, 0.12);
+            ActiveContactFill = new ImmutableSolidColorBrush(accent, 0.55);
+            ContactPen = new ImmutablePen(new ImmutableSolidColorBrush(accent), 1);
+            ActiveContactPen = new ImmutablePen(new ImmutableSolidColorBrush(accent), 2.5);
+        }
+
+        public IBrush KeyFill { get; }
+        public IBrush SelectedKeyFill { get; }
+        public IPen KeyPen { get; }
+        public IPen SelectedKeyPen { get; }
+        public IBrush CustomFill { get; }
+        public IBrush SelectedCustomFill { get; }
+        public IPen CustomPen { get; }
+        public IPen SelectedCustomPen { get; }
+        public IBrush ContactFill { get; }
+        public IBrush ActiveContactFill { get; }
+        public IPen ContactPen { get; }
+        public IPen ActiveContactPen { get; }
+    }
+
+    // Static layer: surface background, key and custom-button geometry, and the status line.
+    private sealed class KeymapLayer : Control
+    {
+        private readonly TrackpadPreviewSurface _owner;
+        private IReadOnlyList<TrackpadPreviewKeyItem> _items = Array.Empty<TrackpadPreviewKeyItem>();
+        private KeyVisual[] _visuals = Array.Empty<KeyVisual>();
+        private Size _builtSize;
+        private string? _status;
+        private FormattedText? _statusText;
+
+        public KeymapLayer(TrackpadPreviewSurface owner)
+        {
+            _owner = owner;
+            IsHitTestVisible = false;
+        }
+
+        public void SetItems(IReadOnlyList<TrackpadPreviewKeyItem> items)
+        {
+            _items = items;
+            Rebuild();
+        }
+
+        public void SetStatus(string? status)
+        {
+            if (string.Equals(status, _status, StringComparison.Ordinal))
+            {
+                return;
+            }
+
+            _status = status;
+            _statusText = null;
+            InvalidateVisual();
+        }
+
+        public void Rebuild()
+        {
+            _builtSize = default;
+            InvalidateVisual();
+        }
+
+        public override void Render(DrawingContext context)
+        {
+            Size size = _owner.GetSurfaceSize();
+            if (size != _builtSize)
+            {
+                BuildVisuals(size);
+            }
+
+            Rect surface = new(size);
+            context.DrawRectangle(SurfaceBrush, null, surface);
+            context.DrawRectangle(null, OutlinePen, surface.Deflate(0.5), 14, 14);
+            for (int index = 0; index < _visuals.Length; index++)
+            {
+                ref readonly KeyVisual visual = ref _visuals[index];
+                using (context.PushTransform(visual.Transform))
+                {
+                    context.DrawRectangle(visual.Fill, visual.Pen, visual.Bounds.Deflate(visual.Pen.Thickness / 2), visual.CornerRadius, visual.CornerRadius);
+                    context.DrawText(visual.Label, visual.LabelOrigin);
+                }
+            }
+
+            if (_status != null)
+            {
+                _statusText ??= new FormattedText(
+                    _status,
+                    CultureInfo.CurrentCulture,
+                    FlowDirection.LeftToRight,
+                    RegularTypeface,
+                    14,
+                    LabelBrush)
+                {
+                    MaxTextWidth = Math.Max(1, size.Width - (ContactInset * 2))
+                };
+                context.DrawText(_statusText, new Point(ContactInset, ContactInset));
+            }
+        }
+
+        private void BuildVisuals(Size size)
+        {
+            PreviewPalette palette = _owner._palette;
+            KeyVisual[] visuals = new KeyVisual[_items.Count];
+            for (int index = 0; index < _items.Count; index++)
+            {
+                TrackpadPreviewKeyItem item = _items[index];
+                Rect bounds = new(
+                    item.Rect.X * size.Width,
+                    item.Rect.Y * size.Height,
+                    Math.Max(item.IsCustomButton ? 24 : 22, item.Rect.Width * size.Width),
+                    Math.Max(20, item.Rect.Height * size.Height));
+                Matrix transform = Matrix.Identity;
+                if (Math.Abs(item.RotationDegrees) >= 0.00001)
+                {
+                    Point center = bounds.Center;
+                    transform = Matrix.CreateTranslation(-center.X, -center.Y) *
+                                Matrix.CreateRotation(Matrix.ToRadians(item.RotationDegrees)) *
+                                Matrix.CreateTranslation(center.X, center.Y);
+                }
+
+                FormattedText label = new(
+                    item.Label,
+                    CultureInfo.CurrentCulture,
+                    FlowDirection.LeftToRight,
+                    SemiBoldTypeface,
+                    11,
+                    LabelBrush)
+                {
+                    MaxTextWidth = Math.Max(18, (item.Rect.Width * size.Width) - 8),
+                    TextAlignment = TextAlignment.Center
+                };
+                Point labelOrigin = new(
+                    bounds.X + ((bounds.Width - label.MaxTextWidth) / 2),
+                    bounds.Y + ((bounds.Height - label.Height) / 2));
+
+                visuals[index] = item.IsCustomButton
+                    ? new KeyVisual(bounds, transform, item.IsSelected ? palette.SelectedCustomFill : palette.CustomFill, item.IsSelected ? palette.SelectedCustomPen : palette.CustomPen, 10, label, labelOrigin)
+                    : new KeyVisual(bounds, transform, item.IsSelected ? palette.SelectedKeyFill : palette.KeyFill, item.IsSelected ? palette.SelectedKeyPen : palette.KeyPen, 8, label, labelOrigin);
+            }
+
+            _visuals = visuals;
+            _statusText = null;
+            _builtSize = size;
+        }
+
+        private readonly record struct KeyVisual(
+            Rect Bounds,
+            Matrix Transform,
+            IBrush Fill,
+            IPen Pen,
+            double CornerRadius,
+            FormattedText Label,
+            Point LabelOrigin);
+    }
+
+    // One touch: a fixed-size visual positioned by a translate transform, so moving it only
+    // dirties its old and new bounds. It re-renders only when its radius, pressure or tip changes.
+    private sealed class ContactMarker : Control
+    {
+        private readonly TrackpadPreviewSurface _owner;
+        private readonly TranslateTransform _translate = new();
+        private double _radius = -1;
+        private int _pressure = -1;
+        private bool _active;
+        private FormattedText? _label;
+
+        public ContactMarker(TrackpadPreviewSurface owner)
+        {
+            _owner = owner;
+            IsHitTestVisible = false;
+            IsVisible = false;
+            RenderTransform = _translate;
+            RenderTransformOrigin = RelativePoint.TopLeft;
+        }
+
+        public void Show(Point center, double radius, int pressure, bool active)
+        {
+            _translate.X = center.X - (ContactExtent / 2);
+            _translate.Y = center.Y - (ContactExtent / 2);
+            IsVisible = true;
+            if (radius == _radius && pressure == _pressure && active == _active)
+            {
+                return;
+            }
+
+            if (pressure != _pressure)
+            {
+                _label = null;
+            }
+
+            _radius = radius;
+            _pressure = pressure;
+            _active = active;
+            InvalidateVisual();
+        }
+
+        public void Hide()
+        {
+            IsVisible = false;
+        }
+
+        public override void Render(DrawingContext context)
+        {
+            PreviewPalette palette = _owner._palette;
+            Point center = new(ContactExtent / 2, ContactExtent / 2);
+            context.DrawEllipse(
+                _active ? palette.ActiveContactFill : palette.ContactFill,
+                _active ? palette.ActiveContactPen : palette.ContactPen,
+                center,
+                _radius,
+                _radius);
+            _label ??= new FormattedText(
+                $"f:{_pressure}",
+                CultureInfo.InvariantCulture,
+                FlowDirection.LeftToRight,
+                SemiBoldTypeface,
+                14,
+                ContactLabelBrush);
+            context.DrawText(_label, new Point(center.X - 16, center.Y - 8));
+        }
+    }
+}
@@ -1,3 +1,4 @@
+using System.Globalization;
 using GlassToKey.Linux.Runtime;
 using GlassToKey.Platform.Linux.Evdev;
 using GlassToKey.Platform.Linux.Haptics;
@@ -167,6 +168,57 @@ public static class LinuxDoctorRunner
         return new LinuxDoctorResult(ok, writer.ToString());
     }
 
+    // Round-trips timed reports through a loopback uinput device and its evdev node.
+    public static LinuxDoctorResult RunUinputLoopback(LinuxUinputLoopbackOptions options)
+    {
+        StringWriter writer = new();
+        writer.WriteLine("GlassToKey Linux doctor: uinput loopback");
+        LinuxUinputAccessStatus uinput = new LinuxUinputPermissionProbe().Probe();
+        writer.WriteLine($"  Node: {uinput.DeviceNode}");
+        writer.WriteLine($"  ReadWriteAccess: {uinput.CanOpenReadWrite}");
+        if (!uinput.IsReady)
+        {
+            writer.WriteLine($"  Guidance: {uinput.Guidance}");
+            writer.WriteLine("Summary: issues detected in uinput");
+            return new LinuxDoctorResult(false, writer.ToString());
+        }
+
+        LinuxUinputLoopbackResult result;
+        try
+        {
+            result = LinuxUinputLoopbackProbe.Run(options);
+        }
+        catch (Exception ex)
+        {
+            writer.WriteLine($"  LoopbackError: {ex.Message}");
+            writer.WriteLine("  Guidance: the loopback evdev node must be readable (input group or a udev rule) to measure delivery.");
+            writer.WriteLine("Summary: issues detected in loopback");
+            return new LinuxDoctorResult(false, writer.ToString());
+        }
+
+        writer.WriteLine($"  EventNode: {result.EventNode}");
+        writer.WriteLine($"  Reports: sent={result.ReportsSent} delivered={result.ReportsDelivered} lost={result.ReportsLost} mismatched={result.ReportsMismatched} synDropped={result.SynDropped}");
+        WriteLatency(writer, "KeyDispatchToRead", result.KeyLatency);
+        WriteLatency(writer, "RelDispatchToRead", result.RelativeLatency);
+        WriteLatency(writer, "BurstDispatchToRead", result.BurstLatency);
+        WriteLatency(writer, "KernelToRead", result.KernelToReader);
+        writer.WriteLine(string.Create(
+            CultureInfo.InvariantCulture,
+            $"  BurstThroughput: dispatch={result.DispatchReportsPerSecond:0} reports/s delivered={result.DeliveredReportsPerSecond:0} reports/s"));
+        bool ok = result.ReportsLost == 0 && result.ReportsMismatched == 0;
+        writer.WriteLine(ok
+            ? "Summary: ok"
+            : "Summary: issues detected in loopback delivery (lower the burst size if SYN_DROPPED is non-zero)");
+        return new LinuxDoctorResult(ok, writer.ToString());
+    }
+
+    private static void WriteLatency(StringWriter writer, string label, LatencyHistogramSnapshot latency)
+    {
+        writer.WriteLine(string.Create(
+            CultureInfo.InvariantCulture,
+            $"  {label + ":",-21} count={latency.Count,6} p50={latency.P50Us,8:0.0}us p99={latency.P99Us,8:0.0}us p99.9={latency.P999Us,8:0.0}us max={latency.MaxUs,9:0.0}us"));
+    }
+
     private static bool CanWriteDirectory(string? directory, out string error)
     {
         error = string.Empty;
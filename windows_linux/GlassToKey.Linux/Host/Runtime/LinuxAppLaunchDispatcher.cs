@@ -8,7 +8,7 @@ using GlassToKey.Platform.Linux.Uinput;
 
 namespace GlassToKey.Linux.Runtime;
 
-internal sealed class LinuxAppLaunchDispatcher : IInputDispatcher, IInputDispatcherDiagnosticsProvider, IAutocorrectController, IThreeFingerDragSink
+internal sealed class LinuxAppLaunchDispatcher : IInputDispatcher, IInputDispatcherDiagnosticsProvider, IAutocorrectController, IThreeFingerDragSink, IPipelineLatencySink
 {
     private const int BrightnessRepeatCapacity = 16;
     private const string EmojiActionLabel = "EMOJI";
@@ -84,6 +84,32 @@ internal sealed class LinuxAppLaunchDispatcher : IInputDispatcher, IInputDispatc
         ProcessBrightnessRepeats(nowTicks);
     }
 
+    public long GetNextDeadlineTicks()
+    {
+        long deadlineTicks = _inner.GetNextDeadlineTicks();
+        lock (_brightnessRepeatGate)
+        {
+            long brightnessDeadlineTicks = long.MaxValue;
+            for (int index = 0; index < _brightnessRepeatEntries.Length; index++)
+            {
+                ref BrightnessRepeatEntry entry = ref _brightnessRepeatEntries[index];
+                if (entry.Active && entry.NextTick < brightnessDeadlineTicks)
+                {
+                    brightnessDeadlineTicks = entry.NextTick;
+                }
+            }
+
+            // Tick skips brightness repeats without the xrandr fallback, so they must not
+            // hold the pump awake either.
+            if (brightnessDeadlineTicks < deadlineTicks && LinuxBrightnessController.CanUseXrandrFallback())
+            {
+                deadlineTicks = brightnessDeadlineTicks;
+            }
+        }
+
+        return deadlineTicks;
+    }
+
     public void Dispose()
     {
         _inner.Dispose();
@@ -94,6 +120,11 @@ internal sealed class LinuxAppLaunchDispatcher : IInputDispatcher, IInputDispatc
         return _inner.TryGetDiagnostics(out diagnostics);
     }
 
+    public void AttachPipelineLatency(PipelineLatencyRecorder recorder)
+    {
+        _inner.AttachPipelineLatency(recorder);
+    }
+
     public void SetAutocorrectEnabled(bool enabled)
     {
         _inner.SetAutocorrectEnabled(enabled);
@@ -5,39 +5,104 @@ using GlassToKey.Platform.Linux.Models;
 
 namespace GlassToKey.Linux.Runtime;
 
+public enum LinuxAtpCapFsyncPolicy
+{
+    // Leave durability to the page cache; the file is complete after Dispose.
+    None,
+    OnClose,
+    Periodic
+}
+
+public sealed record LinuxAtpCapCaptureOptions
+{
+    public static LinuxAtpCapCaptureOptions Default { get; } = new();
+
+    // Bytes of encoded records the frame path can queue before records are dropped.
+    public int RingCapacityBytes { get; init; } = 4 * 1024 * 1024;
+
+    // The writer thread wakes early once this many bytes are pending.
+    public int FlushThresholdBytes { get; init; } = 256 * 1024;
+
+    public TimeSpan FlushInterval { get; init; } = TimeSpan.FromMilliseconds(100);
+
+    public LinuxAtpCapFsyncPolicy FsyncPolicy { get; init; } = LinuxAtpCapFsyncPolicy.OnClose;
+
+    public TimeSpan FsyncInterval { get; init; } = TimeSpan.FromSeconds(5);
+}
+
+// WriteFrame encodes each record straight into a preallocated byte ring and returns; a
+// background thread drains the ring in large sequential writes. When the disk falls behind
+// and the ring is full, whole records are dropped and counted instead of stalling input.
+// WriteFrame callers must be serialized (one producer).
 public sealed class LinuxAtpCapCaptureWriter : IDisposable
 {
     private const ushort UsagePageDigitizer = 0x0D;
     private const ushort UsageTouchpad = 0x05;
+    private const int MaxFrameRecordSize = InputCaptureFile.RecordHeaderSize + AtpCapV3Payload.FrameHeaderSize + (InputFrame.MaxContacts * AtpCapV3Payload.ContactSize);
 
-    private readonly FileStream _stream;
+    private readonly Stream _stream;
+    private readonly LinuxAtpCapCaptureOptions _options;
     private readonly Dictionary<string, DeviceCaptureIdentity> _devicesByStableId = new(StringComparer.OrdinalIgnoreCase);
     private readonly long _baseTimestampTicks;
+    private readonly byte[] _ring;
+    private readonly AutoResetEvent _drainSignal = new(false);
+    private readonly Thread _writerThread;
+    private long _producedBytes;
+    private long _consumedBytes;
+    private long _recordsWritten;
+    private long _recordsDropped;
+    private long _bytesWritten;
+    private string? _writeFailure;
+    private volatile bool _stopping;
     private bool _disposed;
 
     public LinuxAtpCapCaptureWriter(string path)
+        : this(path, LinuxAtpCapCaptureOptions.Default)
     {
-        Path = System.IO.Path.GetFullPath(path);
-        string? directory = System.IO.Path.GetDirectoryName(path);
-        if (!string.IsNullOrWhiteSpace(directory))
-        {
-            Directory.CreateDirectory(directory);
-        }
+    }
 
-        _stream = new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.Read, 64 * 1024, FileOptions.SequentialScan);
+    public LinuxAtpCapCaptureWriter(string path, LinuxAtpCapCaptureOptions options)
+        : this(CreateFileStream(path), System.IO.Path.GetFullPath(path), options)
+    {
+    }
+
+    // Takes ownership of the stream; path is only reported back to callers.
+    public LinuxAtpCapCaptureWriter(Stream stream, string path, LinuxAtpCapCaptureOptions options)
+    {
+        Path = path;
+        _stream = stream;
+        _options = options;
+        _ring = new byte[Math.Max(options.RingCapacityBytes, MaxFrameRecordSize * 4)];
         InputCaptureFile.WriteHeader(_stream, InputCaptureFile.Version3, System.Diagnostics.Stopwatch.Frequency);
         _baseTimestampTicks = System.Diagnostics.Stopwatch.GetTimestamp();
         WriteMetaRecord();
+        _writerThread = new Thread(RunWriter)
+        {
+            IsBackground = true,
+            Name = "GlassToKey.CaptureWriter"
+        };
+        _writerThread.Start();
     }
 
     public string Path { get; }
 
+    public long RecordsWritten => Interlocked.Read(ref _recordsWritten);
+
+    public long RecordsDropped => Interlocked.Read(ref _recordsDropped);
+
+    public long BytesWritten => Interlocked.Read(ref _bytesWritten);
+
+    // Set once a disk write fails; every later record is counted as dropped.
+    public string? WriteFailure => Volatile.Read(ref _writeFailure);
+
     public void WriteFrame(in LinuxRuntimeFrame frame)
     {
         ObjectDisposedException.ThrowIf(_disposed, this);
 
         DeviceCaptureIdentity identity = ResolveIdentity(frame.Binding.Device);
-        byte[] payload = BuildFramePayload(identity.NumericId, frame.Snapshot);
+        int contactCount = frame.Snapshot.Frame.GetClampedContactCount();
+        Span<byte> payload = stackalloc byte[AtpCapV3Payload.FrameHeaderSize + (contactCount * AtpCapV3Payload.ContactSize)];
+        BuildFramePayload(payload, identity.NumericId, frame.Snapshot, contactCount);
         WriteRecord(
             deviceIndex: identity.Index,
             deviceHash: identity.Hash32,
@@ -51,6 +116,7 @@ public sealed class LinuxAtpCapCaptureWriter : IDisposable
             payload: payload);
     }
 
+    // Drains everything queued so far, applies the fsync policy and closes the file.
     public void Dispose()
     {
         if (_disposed)
@@ -59,7 +125,138 @@ public sealed class LinuxAtpCapCaptureWriter : IDisposable
         }
 
         _disposed = true;
-        _stream.Dispose();
+        _stopping = true;
+        _drainSignal.Set();
+        _writerThread.Join();
+        try
+        {
+            if (_options.FsyncPolicy != LinuxAtpCapFsyncPolicy.None && _writeFailure == null)
+            {
+                FlushToDisk();
+            }
+        }
+        finally
+        {
+            _stream.Dispose();
+            _drainSignal.Dispose();
+        }
+    }
+
+    private static FileStream CreateFileStream(string path)
+    {
+        string? directory = System.IO.Path.GetDirectoryName(System.IO.Path.GetFullPath(path));
+        if (!string.IsNullOrWhiteSpace(directory))
+        {
+            Directory.CreateDirectory(directory);
+        }
+
+        // Unbuffered: the ring already batches records into large writes.
+        return new FileStream(path, FileMode.Create, FileAccess.Write, FileShare.Read, bufferSize: 0, FileOptions.SequentialScan);
+    }
+
+    private void RunWriter()
+    {
+        int waitMs = (int)Math.Clamp(_options.FlushInterval.TotalMilliseconds, 1, int.MaxValue);
+        long fsyncIntervalTicks = (long)(_options.FsyncInterval.TotalSeconds * System.Diagnostics.Stopwatch.Frequency);
+        long lastFsyncTicks = System.Diagnostics.Stopwatch.GetTimestamp();
+        while (true)
+        {
+            bool stopping = _stopping;
+            DrainRing();
+            if (stopping)
+            {
+                return;
+            }
+
+            if (_options.FsyncPolicy == LinuxAtpCapFsyncPolicy.Periodic &&
+                System.Diagnostics.Stopwatch.GetTimestamp() - lastFsyncTicks >= fsyncIntervalTicks)
+            {
+                FlushToDisk();
+                lastFsyncTicks = System.Diagnostics.Stopwatch.GetTimestamp();
+            }
+
+            _drainSignal.WaitOne(waitMs);
+        }
+    }
+
+    private void DrainRing()
+    {
+        long produced = Volatile.Read(ref _producedBytes);
+        long consumed = _consumedBytes;
+        if (produced == consumed)
+        {
+            return;
+        }
+
+        // Counted from the drained bytes themselves, so a record is reported written only
+        // once its bytes are in the range handed to the file.
+        long records = CountRecords(consumed, produced);
+
+        if (_writeFailure == null)
+        {
+            try
+            {
+                int start = (int)(consumed % _ring.Length);
+                int length = (int)(produced - consumed);
+                int firstLength = Math.Min(length, _ring.Length - start);
+                _stream.Write(_ring, start, firstLength);
+                if (firstLength < length)
+                {
+                    _stream.Write(_ring, 0, length - firstLength);
+                }
+
+                Interlocked.Add(ref _bytesWritten, length);
+                Interlocked.Add(ref _recordsWritten, records);
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+            {
+                Volatile.Write(ref _writeFailure, ex.Message);
+                Interlocked.Add(ref _recordsDropped, records);
+            }
+        }
+        else
+        {
+            Interlocked.Add(ref _recordsDropped, records);
+        }
+
+        Volatile.Write(ref _consumedBytes, produced);
+    }
+
+    private long CountRecords(long position, long end)
+    {
+        Span<byte> lengthBytes = stackalloc byte[4];
+        long records = 0;
+        while (position < end)
+        {
+            for (int index = 0; index < lengthBytes.Length; index++)
+            {
+                lengthBytes[index] = _ring[(position + index) % _ring.Length];
+            }
+
+            position += InputCaptureFile.RecordHeaderSize + BinaryPrimitives.ReadInt32LittleEndian(lengthBytes);
+            records++;
+        }
+
+        return records;
+    }
+
+    private void FlushToDisk()
+    {
+        try
+        {
+            if (_stream is FileStream fileStream)
+            {
+                fileStream.Flush(flushToDisk: true);
+            }
+            else
+            {
+                _stream.Flush();
+            }
+        }
+        catch (IOException ex)
+        {
+            Volatile.Write(ref _writeFailure, ex.Message);
+        }
     }
 
     private void WriteMetaRecord()
@@ -101,12 +298,8 @@ public sealed class LinuxAtpCapCaptureWriter : IDisposable
         return identity;
     }
 
-    private byte[] BuildFramePayload(ulong deviceNumericId, LinuxEvdevFrameSnapshot snapshot)
+    private void BuildFramePayload(Span<byte> span, ulong deviceNumericId, LinuxEvdevFrameSnapshot snapshot, int contactCount)
     {
-        int contactCount = snapshot.Frame.GetClampedContactCount();
-        byte[] payload = new byte[AtpCapV3Payload.FrameHeaderSize + (contactCount * AtpCapV3Payload.ContactSize)];
-        Span<byte> span = payload.AsSpan();
-
         BinaryPrimitives.WriteUInt32LittleEndian(span.Slice(0, 4), AtpCapV3Payload.FrameMagic);
         BinaryPrimitives.WriteUInt64LittleEndian(span.Slice(4, 8), (ulong)Math.Max(0, snapshot.FrameSequence));
 
@@ -124,8 +317,6 @@ public sealed class LinuxAtpCapCaptureWriter : IDisposable
             WriteContact(span.Slice(offset, AtpCapV3Payload.ContactSize), contact, snapshot.MaxX, snapshot.MaxY);
             offset += AtpCapV3Payload.ContactSize;
         }
-
-        return payload;
     }
 
     private static void WriteContact(Span<byte> destination, ContactFrame contact, ushort maxX, ushort maxY)
@@ -166,8 +357,32 @@ public sealed class LinuxAtpCapCaptureWriter : IDisposable
         BinaryPrimitives.WriteUInt16LittleEndian(header.Slice(30, 2), usage);
         header[32] = (byte)sideHint;
         header[33] = (byte)decoderProfile;
-        _stream.Write(header);
-        _stream.Write(payload);
+
+        int recordLength = header.Length + payload.Length;
+        long produced = _producedBytes;
+        if (Volatile.Read(ref _writeFailure) != null ||
+            recordLength > _ring.Length - (produced - Volatile.Read(ref _consumedBytes)))
+        {
+            Interlocked.Increment(ref _recordsDropped);
+            return;
+        }
+
+        CopyToRing(header, produced);
+        CopyToRing(payload, produced + header.Length);
+        long pending = produced + recordLength - Volatile.Read(ref _consumedBytes);
+        Volatile.Write(ref _producedBytes, produced + recordLength);
+        if (pending >= _options.FlushThresholdBytes && pending - recordLength < _options.FlushThresholdBytes)
+        {
+            _drainSignal.Set();
+        }
+    }
+
+    private void CopyToRing(ReadOnlySpan<byte> source, long position)
+    {
+        int start = (int)(position % _ring.Length);
+        int firstLength = Math.Min(source.Length, _ring.Length - start);
+        source.Slice(0, firstLength).CopyTo(_ring.AsSpan(start));
+        source.Slice(firstLength).CopyTo(_ring);
     }
 
     private static CaptureSideHint ToSideHint(TrackpadSide side)
@@ -178,6 +178,11 @@ public static class LinuxAtpCapReplayVisualLoader
         {
         }
 
+        public long GetNextDeadlineTicks()
+        {
+            return long.MaxValue;
+        }
+
         public void Dispose()
         {
         }
@@ -268,6 +268,11 @@ public static class LinuxAtpCapTools
         {
         }
 
+        public long GetNextDeadlineTicks()
+        {
+            return long.MaxValue;
+        }
+
         public DispatchEvent[] Snapshot()
         {
             lock (_gate)
@@ -3,6 +3,7 @@ using GlassToKey;
 using GlassToKey.Linux.Config;
 using GlassToKey.Platform.Linux;
 using GlassToKey.Platform.Linux.Contracts;
+using GlassToKey.Platform.Linux.Devices;
 using GlassToKey.Platform.Linux.Models;
 using GlassToKey.Platform.Linux.Uinput;
 
@@ -10,7 +11,10 @@ namespace GlassToKey.Linux.Runtime;
 
 public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFrameSink, ILinuxRuntimeObserver
 {
+    // Only used when inotify is unavailable and to retry a reload deferred by active contacts.
     private static readonly TimeSpan SettingsPollInterval = TimeSpan.FromMilliseconds(250);
+    private static readonly TimeSpan ConfigurationChangeDebounce = TimeSpan.FromMilliseconds(10);
+    private const string InputDeviceDirectory = "/dev/input";
     private static readonly TimeSpan SessionRestartDelay = TimeSpan.FromMilliseconds(500);
     private static readonly TimeSpan PreviewPublishInterval = TimeSpan.FromMilliseconds(33);
     private static readonly TimeSpan AutocorrectStatusRefreshInterval = TimeSpan.FromMilliseconds(150);
@@ -30,6 +34,7 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
     private Task? _ownerTask;
     private TaskCompletionSource<LinuxDesktopAtpCapCaptureResult>? _captureCompletion;
     private RuntimeSession? _session;
+    private PreviewChannelWriter? _previewChannel;
     private long _lastPreviewPublishTicks;
     private long _lastAutocorrectStatusRefreshTicks;
     private int _captureFrameCount;
@@ -244,7 +249,8 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
             frame.Snapshot.Frame,
             frame.Snapshot.MaxX,
             frame.Snapshot.MaxY,
-            frame.Snapshot.Frame.ArrivalQpcTicks);
+            frame.Snapshot.Frame.ArrivalQpcTicks,
+            frame.Snapshot.Timestamps);
 
         bool publishPreviewImmediately;
         lock (_gate)
@@ -377,10 +383,16 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
 
     private async Task RunOwnerAsync(CancellationToken cancellationToken)
     {
+        LinuxFileChangeWatcher? watcher = CreateConfigurationWatcher();
+        long observedChanges = watcher?.ChangeSequence ?? 0;
         LinuxRuntimeConfiguration configuration = _appRuntime.LoadConfiguration();
-        string settingsSignature = BuildSettingsSignature(configuration.Settings);
+        bool watching = WatchConfiguration(watcher, configuration);
+        string settingsSignature = BuildConfigurationSignature(configuration.Settings);
         RuntimeSession? localSession = null;
         bool waitingForBindings = false;
+        bool reloadDeferred = false;
+        // Outlives individual sessions so viewers keep their mapping across restarts.
+        _previewChannel = LinuxPreviewChannel.TryCreateWriter();
 
         try
         {
@@ -425,7 +437,10 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
                     }
                 }
 
-                Task pollTask = Task.Delay(SettingsPollInterval, cancellationToken);
+                Task pollTask = watching && !reloadDeferred
+                    ? watcher!.WaitForChangeAsync(observedChanges, cancellationToken)
+                    : Task.Delay(SettingsPollInterval, cancellationToken);
+                reloadDeferred = false;
                 if (localSession != null)
                 {
                     Task completed = await Task.WhenAny(localSession.RunTask, pollTask).ConfigureAwait(false);
@@ -489,8 +504,10 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
                     await pollTask.ConfigureAwait(false);
                 }
 
+                observedChanges = watcher?.ChangeSequence ?? 0;
                 LinuxRuntimeConfiguration updated = _appRuntime.LoadConfiguration();
-                string updatedSignature = BuildSettingsSignature(updated.Settings);
+                watching = WatchConfiguration(watcher, updated);
+                string updatedSignature = BuildConfigurationSignature(updated.Settings);
                 if (updatedSignature == settingsSignature)
                 {
                     configuration = updated;
@@ -518,6 +535,7 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
 
                 if (HasActiveTrackpadContacts())
                 {
+                    reloadDeferred = true;
                     continue;
                 }
 
@@ -556,12 +574,15 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
         }
         finally
         {
+            watcher?.Dispose();
             if (localSession != null)
             {
                 await localSession.StopAsync().ConfigureAwait(false);
                 localSession.Dispose();
             }
 
+            _previewChannel?.Dispose();
+            _previewChannel = null;
             lock (_gate)
             {
                 _session = null;
@@ -591,7 +612,12 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
         uinputDispatcher.ConfigureHaptics(configuration.SharedProfile);
         uinputDispatcher.WarmupHaptics();
         LinuxAppLaunchDispatcher dispatcher = new(uinputDispatcher);
-        TouchProcessorRuntimeHost engine = new(dispatcher, configuration.Keymap, configuration.LayoutPreset, configuration.SharedProfile);
+        TouchProcessorRuntimeHost engine = new(
+            dispatcher,
+            configuration.Keymap,
+            configuration.LayoutPreset,
+            configuration.SharedProfile,
+            previewChannel: _previewChannel);
         RuntimeSession? session = null;
         ResetTrackpads(configuration.Bindings);
         LinuxInputRuntimeOptions options = new()
@@ -809,6 +835,54 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
         return false;
     }
 
+    private static LinuxFileChangeWatcher? CreateConfigurationWatcher()
+    {
+        try
+        {
+            return new LinuxFileChangeWatcher(ConfigurationChangeDebounce);
+        }
+        catch (IOException)
+        {
+            return null;
+        }
+    }
+
+    // Settings, keymap and (through the settings file) the shared profile. /dev/input is only
+    // watched while no trackpad is bound, so a hotplugged one starts the session; a running
+    // session rebinds its own devices through the input runtime's uevent path, and watching the
+    // directory then would reload on every input node, including our own uinput device. False
+    // means something could not be watched; the owner loop then falls back to polling.
+    private static bool WatchConfiguration(LinuxFileChangeWatcher? watcher, LinuxRuntimeConfiguration configuration)
+    {
+        if (watcher == null)
+        {
+            return false;
+        }
+
+        List<string> files = [configuration.SettingsPath];
+        if (!string.IsNullOrWhiteSpace(configuration.Settings.KeymapPath))
+        {
+            files.Add(configuration.Settings.KeymapPath);
+        }
+
+        return configuration.Bindings.Count == 0
+            ? watcher.Watch(files, [InputDeviceDirectory])
+            : watcher.Watch(files, []);
+    }
+
+    // The keymap file's write stamp is included so an edit to it reapplies like a settings change.
+    private static string BuildConfigurationSignature(LinuxHostSettings settings)
+    {
+        string signature = BuildSettingsSignature(settings);
+        if (string.IsNullOrWhiteSpace(settings.KeymapPath))
+        {
+            return signature;
+        }
+
+        FileInfo keymap = new(settings.KeymapPath);
+        return keymap.Exists ? $"{signature}|{keymap.LastWriteTimeUtc.Ticks}:{keymap.Length}" : signature;
+    }
+
     private static string BuildSettingsSignature(LinuxHostSettings settings)
     {
         LinuxHostSettings normalized = new()
@@ -919,10 +993,17 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
             captureCts?.Dispose();
         }
 
+        long droppedRecords = writer?.RecordsDropped ?? 0;
+        string? writeFailure = writer?.WriteFailure;
         string summary = success
-            ? $"Capture written: {resolvedPath} ({frameCount} frames)"
+            ? droppedRecords == 0
+                ? $"Capture written: {resolvedPath} ({frameCount} frames)"
+                : $"Capture written: {resolvedPath} ({frameCount} frames, {droppedRecords} dropped{(writeFailure == null ? " while the disk fell behind" : $": {writeFailure}")})"
             : failure ?? "Capture did not complete.";
-        completion.TrySetResult(new LinuxDesktopAtpCapCaptureResult(success, resolvedPath, frameCount, summary));
+        completion.TrySetResult(new LinuxDesktopAtpCapCaptureResult(success, resolvedPath, frameCount, summary)
+        {
+            DroppedRecords = droppedRecords
+        });
     }
 
     private sealed class RuntimeSession : IDisposable
@@ -930,6 +1011,7 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
         private readonly CancellationTokenSource _cts;
         private readonly LinuxAppLaunchDispatcher _dispatcher;
         private readonly LinuxUinputDispatcher _uinputDispatcher;
+        private readonly LinuxRuntimeStatsPublisher _statsPublisher;
         private bool _disposed;
 
         public RuntimeSession(
@@ -943,6 +1025,7 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
             _dispatcher = dispatcher;
             _uinputDispatcher = uinputDispatcher;
             Engine = engine;
+            _statsPublisher = new LinuxRuntimeStatsPublisher(engine);
             RunTask = runTask;
         }
 
@@ -990,6 +1073,7 @@ public sealed class LinuxDesktopRuntimeController : IDisposable, ILinuxInputFram
             }
 
             _disposed = true;
+            _statsPublisher.Dispose();
             Engine.Dispose();
             _dispatcher.Dispose();
             _cts.Dispose();
@@ -1001,4 +1085,8 @@ public readonly record struct LinuxDesktopAtpCapCaptureResult(
     bool Success,
     string OutputPath,
     int FrameCount,
-    string Summary);
+    string Summary)
+{
+    // Records the background writer could not queue or persist.
+    public long DroppedRecords { get; init; }
+}
@@ -0,0 +1,31 @@
+using GlassToKey;
+
+namespace GlassToKey.Linux.Runtime;
+
+// Location of the shared-memory preview ring the tray runtime publishes. It lives on tmpfs
+// ($XDG_RUNTIME_DIR, else /dev/shm) so the mapping never causes disk writeback.
+public static class LinuxPreviewChannel
+{
+    private const string FileName = "preview.shm";
+
+    public static string GetPath()
+    {
+        string? runtimeDirectory = Environment.GetEnvironmentVariable("XDG_RUNTIME_DIR");
+        return string.IsNullOrWhiteSpace(runtimeDirectory)
+            ? Path.Combine("/dev/shm", $"GlassToKey.Linux-{Environment.UserName}", FileName)
+            : Path.Combine(runtimeDirectory, "GlassToKey.Linux", FileName);
+    }
+
+    // Null when the channel cannot be created; the runtime then simply has no live viewers.
+    public static PreviewChannelWriter? TryCreateWriter()
+    {
+        try
+        {
+            return PreviewChannelWriter.Create(GetPath());
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+        {
+            return null;
+        }
+    }
+}
@@ -270,6 +270,7 @@ public sealed class LinuxRuntimeOwner
         private readonly LinuxAppLaunchDispatcher _dispatcher;
         private readonly LinuxUinputDispatcher _uinputDispatcher;
         private readonly TouchProcessorRuntimeHost _engine;
+        private readonly LinuxRuntimeStatsPublisher _statsPublisher;
         private bool _disposed;
 
         public RuntimeSession(
@@ -283,6 +284,7 @@ public sealed class LinuxRuntimeOwner
             _dispatcher = dispatcher;
             _uinputDispatcher = uinputDispatcher;
             _engine = engine;
+            _statsPublisher = new LinuxRuntimeStatsPublisher(engine);
             RunTask = runTask;
         }
 
@@ -323,6 +325,7 @@ public sealed class LinuxRuntimeOwner
             }
 
             _disposed = true;
+            _statsPublisher.Dispose();
             _engine.Dispose();
             _dispatcher.Dispose();
             _cts.Dispose();
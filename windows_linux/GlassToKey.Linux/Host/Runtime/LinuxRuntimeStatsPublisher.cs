@@ -0,0 +1,67 @@
+using GlassToKey;
+
+namespace GlassToKey.Linux.Runtime;
+
+// Periodically writes a session's pipeline latency to the stats store, off the input path.
+internal sealed class LinuxRuntimeStatsPublisher : IDisposable
+{
+    public static readonly TimeSpan DefaultInterval = TimeSpan.FromSeconds(1);
+
+    private readonly TouchProcessorRuntimeHost _engine;
+    private readonly LinuxRuntimeStatsStore _store;
+    private readonly Timer _timer;
+    private readonly object _gate = new();
+    private long _lastFrameCount = -1;
+    private bool _disposed;
+
+    public LinuxRuntimeStatsPublisher(TouchProcessorRuntimeHost engine, LinuxRuntimeStatsStore? store = null, TimeSpan? interval = null)
+    {
+        _engine = engine;
+        _store = store ?? new LinuxRuntimeStatsStore();
+        TimeSpan period = interval ?? DefaultInterval;
+        _timer = new Timer(_ => Publish(), null, period, period);
+    }
+
+    public void Dispose()
+    {
+        lock (_gate)
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            _disposed = true;
+        }
+
+        _timer.Dispose();
+    }
+
+    private void Publish()
+    {
+        lock (_gate)
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            PipelineLatencySnapshot latency = _engine.GetPipelineLatency();
+            long frameCount = latency[PipelineLatencyStage.EngineProcess].Count;
+            if (frameCount == _lastFrameCount)
+            {
+                return;
+            }
+
+            try
+            {
+                _store.Save(LinuxRuntimeStatsSnapshot.FromPipelineLatency(latency));
+                _lastFrameCount = frameCount;
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException)
+            {
+                // Stats are best effort; the next tick retries.
+            }
+        }
+    }
+}
@@ -0,0 +1,40 @@
+using GlassToKey;
+
+namespace GlassToKey.Linux.Runtime;
+
+public sealed record LinuxRuntimeStageLatency(
+    string Stage,
+    long Count,
+    double P50Us,
+    double P99Us,
+    double P999Us,
+    double MaxUs);
+
+public sealed record LinuxRuntimeStatsSnapshot(
+    int ProcessId,
+    DateTimeOffset UpdatedUtc,
+    double RunSeconds,
+    IReadOnlyList<LinuxRuntimeStageLatency> Stages)
+{
+    public static LinuxRuntimeStatsSnapshot FromPipelineLatency(PipelineLatencySnapshot latency)
+    {
+        LinuxRuntimeStageLatency[] stages = new LinuxRuntimeStageLatency[latency.Stages.Length];
+        for (int index = 0; index < stages.Length; index++)
+        {
+            LatencyHistogramSnapshot stage = latency.Stages[index];
+            stages[index] = new LinuxRuntimeStageLatency(
+                ((PipelineLatencyStage)index).ToString(),
+                stage.Count,
+                stage.P50Us,
+                stage.P99Us,
+                stage.P999Us,
+                stage.MaxUs);
+        }
+
+        return new LinuxRuntimeStatsSnapshot(
+            Environment.ProcessId,
+            DateTimeOffset.UtcNow,
+            latency.RunTicks / (double)latency.StopwatchFrequency,
+            stages);
+    }
+}
@@ -0,0 +1,61 @@
+using System.Text.Json;
+
+namespace GlassToKey.Linux.Runtime;
+
+// Per-stage latency of the running runtime, published for `glasstokey stats`.
+public sealed class LinuxRuntimeStatsStore
+{
+    private static readonly JsonSerializerOptions SerializerOptions = new()
+    {
+        PropertyNamingPolicy = JsonNamingPolicy.CamelCase,
+        WriteIndented = true
+    };
+
+    public string GetStatsPath()
+    {
+        string? runtimeDirectory = Environment.GetEnvironmentVariable("XDG_RUNTIME_DIR");
+        string root = string.IsNullOrWhiteSpace(runtimeDirectory)
+            ? Path.Combine(
+                Environment.GetFolderPath(Environment.SpecialFolder.UserProfile),
+                ".local",
+                "state")
+            : runtimeDirectory;
+        return Path.Combine(root, "GlassToKey.Linux", "runtime-stats.json");
+    }
+
+    public LinuxRuntimeStatsSnapshot? Load()
+    {
+        string path = GetStatsPath();
+        if (!File.Exists(path))
+        {
+            return null;
+        }
+
+        try
+        {
+            string json = File.ReadAllText(path);
+            return JsonSerializer.Deserialize<LinuxRuntimeStatsSnapshot>(json, SerializerOptions);
+        }
+        catch
+        {
+            return null;
+        }
+    }
+
+    // Written to a sibling file and renamed, so a reader never sees a partial document.
+    public void Save(LinuxRuntimeStatsSnapshot snapshot)
+    {
+        ArgumentNullException.ThrowIfNull(snapshot);
+
+        string path = GetStatsPath();
+        string? directory = Path.GetDirectoryName(path);
+        if (!string.IsNullOrWhiteSpace(directory))
+        {
+            Directory.CreateDirectory(directory);
+        }
+
+        string temporaryPath = $"{path}.{Environment.ProcessId}.tmp";
+        File.WriteAllText(temporaryPath, JsonSerializer.Serialize(snapshot, SerializerOptions));
+        File.Move(temporaryPath, path, overwrite: true);
+    }
+}
@@ -0,0 +1,137 @@
+using System.Diagnostics;
+using System.Globalization;
+using System.Text;
+using System.Text.Json;
+using GlassToKey.Linux.Runtime;
+
+namespace GlassToKey.Linux;
+
+internal sealed record LinuxAtpCapBatchReplayReport(
+    string Directory,
+    int Parallelism,
+    long ElapsedTicks,
+    ulong AggregateFingerprint,
+    IReadOnlyList<LinuxAtpCapReplayResult> Results)
+{
+    public int FailedCount => Results.Count(result => !result.Success);
+
+    public long TotalFrames => Results.Sum(result => result.Metrics.FramesParsed);
+
+    public double FramesPerSecond => ElapsedTicks <= 0 ? 0 : TotalFrames * (double)Stopwatch.Frequency / ElapsedTicks;
+}
+
+// Replays every capture under a directory synchronously (no actor thread) with one engine per
+// worker, so regression sweeps scale with cores instead of waiting on per-file idle polling.
+internal static class LinuxAtpCapBatchReplayRunner
+{
+    public static LinuxAtpCapBatchReplayReport Run(
+        string directory,
+        int parallelism,
+        Func<LinuxRuntimeConfiguration> loadConfiguration)
+    {
+        string fullDirectory = Path.GetFullPath(directory);
+        string[] capturePaths = Directory.GetFiles(fullDirectory, "*.atpcap", SearchOption.AllDirectories);
+        Array.Sort(capturePaths, StringComparer.Ordinal);
+        LinuxAtpCapReplayResult[] results = new LinuxAtpCapReplayResult[capturePaths.Length];
+        int workers = Math.Clamp(parallelism, 1, Math.Max(1, capturePaths.Length));
+
+        long startTicks = Stopwatch.GetTimestamp();
+        // The keymap is mutated while engines are built, so each worker loads its own copy.
+        Parallel.For(
+            0,
+            capturePaths.Length,
+            new ParallelOptions { MaxDegreeOfParallelism = workers },
+            loadConfiguration,
+            (index, _, configuration) =>
+            {
+                results[index] = ReplayOne(capturePaths[index], configuration);
+                return configuration;
+            },
+            _ => { });
+        long elapsedTicks = Stopwatch.GetTimestamp() - startTicks;
+
+        ulong aggregate = 14695981039346656037UL;
+        for (int index = 0; index < results.Length; index++)
+        {
+            aggregate = LinuxAtpCapReplayRunner.Mix(aggregate, results[index].CaptureFingerprint);
+            aggregate = LinuxAtpCapReplayRunner.Mix(aggregate, results[index].DispatchFingerprint);
+        }
+
+        return new LinuxAtpCapBatchReplayReport(fullDirectory, workers, elapsedTicks, aggregate, results);
+    }
+
+    public static string FormatReport(LinuxAtpCapBatchReplayReport report)
+    {
+        StringBuilder builder = new();
+        foreach (LinuxAtpCapReplayResult result in report.Results)
+        {
+            string name = Path.GetRelativePath(report.Directory, result.CapturePath);
+            builder.AppendLine(result.Success
+                ? string.Create(
+                    CultureInfo.InvariantCulture,
+                    $"OK   {name}: frames={result.Metrics.FramesParsed}, captureTrace=0x{result.CaptureFingerprint:X16}, dispatchTrace=0x{result.DispatchFingerprint:X16}, dispatchEvents={result.DispatchEventCount}, intentTransitions={result.IntentTransitionCount}, fps={result.FramesPerSecond:0}")
+                : $"FAIL {name}: {result.Summary}");
+        }
+
+        double seconds = report.ElapsedTicks / (double)Stopwatch.Frequency;
+        builder.Append(string.Create(
+            CultureInfo.InvariantCulture,
+            $"Batch replay '{report.Directory}': files={report.Results.Count}, failed={report.FailedCount}, frames={report.TotalFrames}, parallelism={report.Parallelism}, elapsed_s={seconds:F3}, fps={report.FramesPerSecond:0}, aggregateTrace=0x{report.AggregateFingerprint:X16}"));
+        return builder.ToString();
+    }
+
+    public static void WriteJsonReport(string outputPath, LinuxAtpCapBatchReplayReport report)
+    {
+        string? directory = Path.GetDirectoryName(outputPath);
+        if (!string.IsNullOrWhiteSpace(directory))
+        {
+            Directory.CreateDirectory(directory);
+        }
+
+        var payload = new
+        {
+            report.Directory,
+            GeneratedUtc = DateTime.UtcNow,
+            report.Parallelism,
+            ElapsedSeconds = report.ElapsedTicks / (double)Stopwatch.Frequency,
+            Files = report.Results.Count,
+            Failed = report.FailedCount,
+            report.TotalFrames,
+            report.FramesPerSecond,
+            AggregateTrace = $"0x{report.AggregateFingerprint:X16}",
+            Captures = report.Results.Select(result => new
+            {
+                Path = Path.GetRelativePath(report.Directory, result.CapturePath),
+                result.Success,
+                Frames = result.Metrics.FramesParsed,
+                DroppedFrames = result.Metrics.FramesDropped,
+                CaptureTrace = $"0x{result.CaptureFingerprint:X16}",
+                DispatchTrace = $"0x{result.DispatchFingerprint:X16}",
+                DispatchEvents = result.DispatchEventCount,
+                IntentTransitions = result.IntentTransitionCount,
+                ElapsedSeconds = result.ElapsedTicks / (double)Stopwatch.Frequency,
+                result.FramesPerSecond,
+                Error = result.Success ? null : result.Summary
+            }).ToArray()
+        };
+
+        File.WriteAllText(outputPath, JsonSerializer.Serialize(payload, new JsonSerializerOptions { WriteIndented = true }));
+    }
+
+    // Whatever a corrupt capture throws fails that entry only; letting it escape Parallel.For
+    // would abort the whole report.
+    private static LinuxAtpCapReplayResult ReplayOne(string capturePath, LinuxRuntimeConfiguration configuration)
+    {
+        try
+        {
+            return LinuxAtpCapReplayRunner.Replay(capturePath, configuration, traceOutputPath: null, synchronous: true);
+        }
+        catch (Exception ex) when (ex is not OutOfMemoryException)
+        {
+            string message = ex is IOException or InvalidDataException or UnauthorizedAccessException
+                ? ex.Message
+                : $"{ex.GetType().Name}: {ex.Message}";
+            return new LinuxAtpCapReplayResult(false, capturePath, new FrameMetrics("linux-replay").CreateSnapshot(), 0, 0, 0, 0, $"Replay '{capturePath}': {message}");
+        }
+    }
+}
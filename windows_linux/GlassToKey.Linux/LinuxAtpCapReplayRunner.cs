@@ -1,9 +1,11 @@
 using System.Diagnostics;
 using System.Globalization;
+using System.Text;
 using System.Text.Json;
 using System.Text.Json.Serialization;
 using GlassToKey;
 using GlassToKey.Linux.Runtime;
+using GlassToKey.Platform.Linux.Uinput;
 
 namespace GlassToKey.Linux;
 
@@ -15,7 +17,41 @@ internal readonly record struct LinuxAtpCapReplayResult(
     ulong DispatchFingerprint,
     int DispatchEventCount,
     int IntentTransitionCount,
-    string Summary);
+    string Summary)
+{
+    // Wall time spent reading, parsing and processing the capture.
+    public long ElapsedTicks { get; init; }
+
+    public double FramesPerSecond => ElapsedTicks <= 0 ? 0 : Metrics.FramesParsed * (double)Stopwatch.Frequency / ElapsedTicks;
+}
+
+internal readonly record struct LinuxAtpCapAllocationResult(
+    bool Success,
+    string CapturePath,
+    int Frames,
+    long AllocatedBytes,
+    long MaxFrameAllocatedBytes,
+    string Summary)
+{
+    public double AllocatedBytesPerFrame => Frames == 0 ? 0 : AllocatedBytes / (double)Frames;
+}
+
+internal readonly record struct LinuxAtpCapVirtualReplayResult(
+    bool Success,
+    string CapturePath,
+    int Frames,
+    int DispatchEventCount,
+    int DispatcherTicks,
+    long OutputWrites,
+    long OutputEvents,
+    ulong OutputFingerprint,
+    long VirtualTicks,
+    long ElapsedTicks,
+    string Summary)
+{
+    // Simulated time covered per unit of wall time.
+    public double Speedup => ElapsedTicks <= 0 ? 0 : VirtualTicks / (double)ElapsedTicks;
+}
 
 internal readonly record struct LinuxAtpCapSummaryResult(
     bool Success,
@@ -25,12 +61,28 @@ internal static class LinuxAtpCapReplayRunner
 {
     private const ushort DefaultMaxX = 7612;
     private const ushort DefaultMaxY = 5065;
+    // Virtual time starts away from zero, which the engine and dispatcher treat as "unset".
+    private static readonly long VirtualStartTicks = Stopwatch.Frequency;
+    // Long enough for tap releases, deferred autocorrect and a few repeats after the last frame.
+    private static readonly long VirtualTailTicks = Stopwatch.Frequency;
 
     public static LinuxAtpCapReplayResult Replay(
         string capturePath,
         LinuxRuntimeConfiguration configuration,
         string? traceOutputPath)
     {
+        return Replay(capturePath, configuration, traceOutputPath, synchronous: false);
+    }
+
+    // Synchronous replays call ProcessFrame on the calling thread and drain after every
+    // frame, exactly as the actor loop does, without the actor thread or idle polling.
+    public static LinuxAtpCapReplayResult Replay(
+        string capturePath,
+        LinuxRuntimeConfiguration configuration,
+        string? traceOutputPath,
+        bool synchronous)
+    {
+        long startTicks = Stopwatch.GetTimestamp();
         string fullPath = Path.GetFullPath(capturePath);
         FrameMetrics metrics = new("linux-replay");
         using InputCaptureReader reader = new(fullPath);
@@ -40,87 +92,267 @@ internal static class LinuxAtpCapReplayRunner
         }
 
         TouchProcessorCore core = TouchProcessorFactory.CreateConfigured(configuration.Keymap, configuration.SharedProfile, configuration.LayoutPreset);
-        using DispatchEventQueue dispatchQueue = new(capacity: 131072);
-        using TouchProcessorActor actor = new(core, dispatchQueue: dispatchQueue);
-
-        long baseQpcTicks = 0;
-        bool hasBaseQpc = false;
-        AtpCapV3Compatibility compatibility = AtpCapV3Compatibility.None;
-        LinuxReplaySideMapper sideMapper = new();
+        using DispatchEventQueue? dispatchQueue = synchronous ? null : new DispatchEventQueue(capacity: 131072);
+        using TouchProcessorActor? actor = synchronous ? null : new TouchProcessorActor(core, dispatchQueue: dispatchQueue);
+        DispatchEvent[] drainBuffer = new DispatchEvent[64];
+        TouchProcessorCore.PointerDragEffect[] effectBuffer = new TouchProcessorCore.PointerDragEffect[16];
+        List<DispatchEvent>? dispatchEvents = !string.IsNullOrWhiteSpace(traceOutputPath) ? [] : null;
+        ulong dispatchFingerprint = 14695981039346656037UL;
+        int dispatchCount = 0;
         ulong captureFingerprint = 14695981039346656037UL;
 
-        while (reader.TryReadNext(out CaptureRecord record))
+        foreach (LinuxReplayFrame replayFrame in ReadReplayFrames(reader, metrics))
         {
-            metrics.RecordSeen();
-            ReadOnlySpan<byte> payload = record.Payload.Span;
-            if (payload.Length == 0)
+            InputFrame mapped = replayFrame.Frame;
+            TrackpadSide side = replayFrame.Side;
+            long engineTicks = replayFrame.TimestampTicks;
+            captureFingerprint = Fingerprint(captureFingerprint, replayFrame.DeviceIndex, replayFrame.DeviceHash, in mapped, side);
+            long started = Stopwatch.GetTimestamp();
+            if (actor != null)
             {
-                metrics.RecordDropped(FrameDropReason.InvalidReportSize);
-                continue;
+                actor.Post(side, in mapped, DefaultMaxX, DefaultMaxY, engineTicks);
             }
-
-            if (record.DeviceIndex == -1)
+            else
             {
-                if (AtpCapV3Payload.TryParseMeta(payload, out AtpCapV3Meta meta))
+                core.ProcessFrame(side, in mapped, DefaultMaxX, DefaultMaxY, engineTicks);
+                while (core.DrainPointerDragEffects(effectBuffer) > 0)
                 {
-                    compatibility = AtpCapV3Payload.ResolveCompatibility(meta);
                 }
 
-                continue;
+                int drained;
+                while ((drained = core.DrainDispatchEvents(drainBuffer)) > 0)
+                {
+                    for (int index = 0; index < drained; index++)
+                    {
+                        dispatchFingerprint = MixDispatch(dispatchFingerprint, in drainBuffer[index]);
+                        dispatchEvents?.Add(drainBuffer[index]);
+                    }
+
+                    dispatchCount += drained;
+                }
             }
 
-            if (!AtpCapV3Payload.TryParseFrame(payload, out AtpCapV3Frame frame))
+            metrics.RecordDispatched(started);
+        }
+
+        if (actor != null)
+        {
+            actor.WaitForIdle(5000);
+            while (dispatchQueue!.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
             {
-                metrics.RecordDropped(FrameDropReason.ParseFailed);
-                continue;
+                dispatchCount++;
+                dispatchEvents?.Add(dispatchEvent);
+                dispatchFingerprint = MixDispatch(dispatchFingerprint, in dispatchEvent);
             }
+        }
+
+        IntentTransition[] transitions = new IntentTransition[512];
+        int transitionCount = actor != null ? actor.CopyIntentTransitions(transitions) : core.CopyIntentTransitions(transitions);
+        long elapsedTicks = Stopwatch.GetTimestamp() - startTicks;
+        FrameMetricsSnapshot snapshot = metrics.CreateSnapshot();
+        if (!string.IsNullOrWhiteSpace(traceOutputPath))
+        {
+            WriteTrace(traceOutputPath!, fullPath, snapshot, dispatchEvents?.ToArray() ?? Array.Empty<DispatchEvent>(), transitions.AsSpan(0, transitionCount).ToArray());
+        }
 
-            InputFrame mapped = AtpCapV3Payload.ToInputFrame(frame, record.ArrivalQpcTicks, DefaultMaxX, DefaultMaxY, compatibility.FlipY);
-            metrics.RecordParsed();
+        string summary = string.Create(
+            CultureInfo.InvariantCulture,
+            $"Replay '{fullPath}': captureTrace=0x{captureFingerprint:X16}, dispatchTrace=0x{dispatchFingerprint:X16}, dispatchEvents={dispatchCount}, intentTransitions={transitionCount}, metrics={snapshot.ToSummary()}");
+        return new LinuxAtpCapReplayResult(true, fullPath, snapshot, captureFingerprint, dispatchFingerprint, dispatchCount, transitionCount, summary)
+        {
+            ElapsedTicks = elapsedTicks
+        };
+    }
 
-            if (!hasBaseQpc)
+    // Runs the capture through the engine and a LinuxUinputDispatcher sharing one
+    // VirtualTimeProvider: each frame is processed at its capture time, and key repeats, tap
+    // releases and deferred autocorrect fire when the simulated clock reaches their deadlines.
+    // The output matches a real-time run through the pump, but takes only as long as the
+    // processing. The dispatcher gets the live runtime's default repeat profile and the
+    // profile's autocorrect settings; deferred lookups are awaited before the clock advances,
+    // so they resolve instantly in simulated time. Haptic requests are flagged as at runtime
+    // but the actuators stay off, since they never reach uinput and a replay must not pulse
+    // real hardware. uinput reports go to outputPath (or a scratch file) instead of
+    // /dev/uinput; the output trace hashes the write count at each simulated step and the
+    // written bytes.
+    public static LinuxAtpCapVirtualReplayResult ReplayVirtualPipeline(
+        string capturePath,
+        LinuxRuntimeConfiguration configuration,
+        string? outputPath)
+    {
+        long startTicks = Stopwatch.GetTimestamp();
+        string fullPath = Path.GetFullPath(capturePath);
+        List<LinuxReplayFrame> frames;
+        using (InputCaptureReader reader = new(fullPath))
+        {
+            if (reader.HeaderVersion != InputCaptureFile.Version3)
             {
-                baseQpcTicks = record.ArrivalQpcTicks;
-                hasBaseQpc = true;
+                return new LinuxAtpCapVirtualReplayResult(false, fullPath, 0, 0, 0, 0, 0, 0, 0, 0, $"Replay '{fullPath}': only capture version 3 is supported on Linux right now.");
             }
 
-            TrackpadSide side = sideMapper.Resolve(record.DeviceIndex, record.DeviceHash, AtpCapV3Payload.NormalizeSideHint(record.SideHint, compatibility));
-            captureFingerprint = Fingerprint(captureFingerprint, record, in mapped, side);
-            long relativeQpc = record.ArrivalQpcTicks - baseQpcTicks;
-            long engineTicks = (long)Math.Round(relativeQpc * (double)Stopwatch.Frequency / reader.HeaderQpcFrequency);
-            long started = Stopwatch.GetTimestamp();
-            actor.Post(side, in mapped, DefaultMaxX, DefaultMaxY, engineTicks);
-            metrics.RecordDispatched(started);
+            frames = ReadReplayFrames(reader);
         }
 
-        actor.WaitForIdle(5000);
-        ulong dispatchFingerprint = 14695981039346656037UL;
+        VirtualTimeProvider clock = new(VirtualStartTicks);
+        TouchProcessorCore core = TouchProcessorFactory.CreateConfigured(configuration.Keymap, configuration.SharedProfile, configuration.LayoutPreset, clock);
+        core.SetHapticsOnKeyDispatchEnabled(configuration.SharedProfile.HapticsEnabled);
+        AutocorrectSession autocorrect = new();
+        DispatchEvent[] drainBuffer = new DispatchEvent[64];
+        TouchProcessorCore.PointerDragEffect[] effectBuffer = new TouchProcessorCore.PointerDragEffect[16];
+        string writePath = outputPath ?? Path.Combine(Path.GetTempPath(), $"glasstokey-virtual-replay-{Guid.NewGuid():N}.uinput");
+        ulong outputFingerprint = 14695981039346656037UL;
         int dispatchCount = 0;
-        List<DispatchEvent>? dispatchEvents = !string.IsNullOrWhiteSpace(traceOutputPath) ? [] : null;
-        while (dispatchQueue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
+        int tickCalls = 0;
+        long outputWrites;
+        long outputEvents;
+        try
         {
-            dispatchCount++;
-            dispatchEvents?.Add(dispatchEvent);
-            dispatchFingerprint = Mix(dispatchFingerprint, (ulong)dispatchEvent.Kind);
-            dispatchFingerprint = Mix(dispatchFingerprint, dispatchEvent.VirtualKey);
-            dispatchFingerprint = Mix(dispatchFingerprint, (ulong)dispatchEvent.MouseButton);
-            dispatchFingerprint = Mix(dispatchFingerprint, dispatchEvent.RepeatToken);
-            dispatchFingerprint = Mix(dispatchFingerprint, (ulong)dispatchEvent.Flags);
-            dispatchFingerprint = Mix(dispatchFingerprint, (ulong)dispatchEvent.Side);
+            LinuxUinputDevice device = new(File.OpenHandle(writePath, FileMode.Create, FileAccess.ReadWrite));
+            using (LinuxUinputDispatcher dispatcher = new(device, DispatchRepeatProfile.Default, autocorrect, clock))
+            {
+                dispatcher.ConfigureAutocorrectOptions(AutocorrectOptions.FromSettings(configuration.SharedProfile));
+                dispatcher.SetAutocorrectEnabled(configuration.SharedProfile.AutocorrectEnabled);
+                if (autocorrect.IsEnabled)
+                {
+                    autocorrect.EnsureLexiconLoaded();
+                }
+
+                long lastWrites = 0;
+                for (int index = 0; index < frames.Count; index++)
+                {
+                    LinuxReplayFrame replayFrame = frames[index];
+                    long frameTicks = VirtualStartTicks + replayFrame.TimestampTicks;
+                    tickCalls += DispatchEventPump.RunDueTicks(dispatcher, clock, frameTicks);
+                    outputFingerprint = MixOutput(outputFingerprint, device, clock, ref lastWrites);
+
+                    InputFrame frame = replayFrame.Frame;
+                    core.ProcessFrame(replayFrame.Side, in frame, DefaultMaxX, DefaultMaxY, frameTicks);
+                    while (core.DrainPointerDragEffects(effectBuffer) > 0)
+                    {
+                    }
+
+                    int drained;
+                    while ((drained = core.DrainDispatchEvents(drainBuffer)) > 0)
+                    {
+                        for (int eventIndex = 0; eventIndex < drained; eventIndex++)
+                        {
+                            dispatcher.Dispatch(in drainBuffer[eventIndex]);
+                        }
+
+                        dispatchCount += drained;
+                    }
+
+                    AwaitDeferredAutocorrect(autocorrect);
+                    outputFingerprint = MixOutput(outputFingerprint, device, clock, ref lastWrites);
+                }
+
+                tickCalls += DispatchEventPump.RunDueTicks(dispatcher, clock, clock.GetTimestamp() + VirtualTailTicks);
+                outputFingerprint = MixOutput(outputFingerprint, device, clock, ref lastWrites);
+                outputWrites = device.WriteCalls;
+                outputEvents = device.EventsWritten;
+            }
+
+            byte[] written = File.ReadAllBytes(writePath);
+            for (int index = 0; index < written.Length; index++)
+            {
+                outputFingerprint = Mix(outputFingerprint, written[index]);
+            }
+        }
+        finally
+        {
+            if (outputPath == null)
+            {
+                File.Delete(writePath);
+            }
         }
 
-        IntentTransition[] transitions = new IntentTransition[512];
-        int transitionCount = actor.CopyIntentTransitions(transitions);
-        FrameMetricsSnapshot snapshot = metrics.CreateSnapshot();
-        if (!string.IsNullOrWhiteSpace(traceOutputPath))
+        long virtualTicks = clock.GetTimestamp() - VirtualStartTicks;
+        long elapsedTicks = Stopwatch.GetTimestamp() - startTicks;
+        LinuxAtpCapVirtualReplayResult result = new(true, fullPath, frames.Count, dispatchCount, tickCalls, outputWrites, outputEvents, outputFingerprint, virtualTicks, elapsedTicks, string.Empty);
+        string summary = string.Create(
+            CultureInfo.InvariantCulture,
+            $"Virtual replay '{fullPath}': outputTrace=0x{outputFingerprint:X16}, frames={frames.Count}, dispatchEvents={dispatchCount}, dispatcherTicks={tickCalls}, outputWrites={outputWrites}, outputEvents={outputEvents}, simulated={virtualTicks / (double)Stopwatch.Frequency:F3}s, wall={elapsedTicks * 1000.0 / Stopwatch.Frequency:F1}ms ({result.Speedup:F0}x)");
+        return result with { Summary = summary };
+    }
+
+    // Replays the capture synchronously on the calling thread, the way the engine actor runs
+    // it, and counts managed bytes allocated by ProcessFrame plus dispatch/effect draining.
+    // A full warm-up pass runs first so JIT, binding indexes and first-use caches are excluded.
+    public static LinuxAtpCapAllocationResult MeasureAllocations(
+        string capturePath,
+        LinuxRuntimeConfiguration configuration,
+        bool diagnosticsEnabled)
+    {
+        string fullPath = Path.GetFullPath(capturePath);
+        List<LinuxReplayFrame> frames;
+        using (InputCaptureReader reader = new(fullPath))
         {
-            WriteTrace(traceOutputPath!, fullPath, snapshot, dispatchEvents?.ToArray() ?? Array.Empty<DispatchEvent>(), transitions.AsSpan(0, transitionCount).ToArray());
+            if (reader.HeaderVersion != InputCaptureFile.Version3)
+            {
+                return new LinuxAtpCapAllocationResult(false, fullPath, 0, 0, 0, $"Replay '{fullPath}': only capture version 3 is supported on Linux right now.");
+            }
+
+            frames = ReadReplayFrames(reader);
         }
 
+        TouchProcessorCore core = TouchProcessorFactory.CreateConfigured(configuration.Keymap, configuration.SharedProfile, configuration.LayoutPreset);
+        core.SetDiagnosticsEnabled(diagnosticsEnabled);
+        DispatchEvent[] dispatchBuffer = new DispatchEvent[256];
+        TouchProcessorCore.PointerDragEffect[] effectBuffer = new TouchProcessorCore.PointerDragEffect[64];
+        EngineDiagnosticEvent[] diagnosticBuffer = new EngineDiagnosticEvent[256];
+
+        RunAllocationPass(core, frames, dispatchBuffer, effectBuffer, diagnosticBuffer, out _, out _);
+        core.ResetState();
+        RunAllocationPass(core, frames, dispatchBuffer, effectBuffer, diagnosticBuffer, out long allocatedBytes, out long maxFrameBytes);
+
+        LinuxAtpCapAllocationResult result = new(true, fullPath, frames.Count, allocatedBytes, maxFrameBytes, string.Empty);
         string summary = string.Create(
             CultureInfo.InvariantCulture,
-            $"Replay '{fullPath}': captureTrace=0x{captureFingerprint:X16}, dispatchTrace=0x{dispatchFingerprint:X16}, dispatchEvents={dispatchCount}, intentTransitions={transitionCount}, metrics={snapshot.ToSummary()}");
-        return new LinuxAtpCapReplayResult(true, fullPath, snapshot, captureFingerprint, dispatchFingerprint, dispatchCount, transitionCount, summary);
+            $"Allocations '{fullPath}': frames={frames.Count}, diagnostics={(diagnosticsEnabled ? "on" : "off")}, allocatedBytes={allocatedBytes}, bytesPerFrame={result.AllocatedBytesPerFrame:F2}, maxFrameBytes={maxFrameBytes}");
+        return result with { Summary = summary };
+    }
+
+    // Seeks straight to startRecord through the reader's record index instead of scanning.
+    public static LinuxAtpCapSummaryResult DescribeRecords(string capturePath, int startRecord, int count)
+    {
+        string fullPath = Path.GetFullPath(capturePath);
+        using InputCaptureReader reader = new(fullPath);
+        int recordCount = reader.RecordCount;
+        if (startRecord >= recordCount)
+        {
+            return new LinuxAtpCapSummaryResult(false, $"Capture '{fullPath}': record {startRecord} is out of range (records={recordCount}).");
+        }
+
+        // Offsets are relative to the first frame record; meta records carry no arrival time.
+        long firstArrival = 0;
+        for (int index = 0; index < recordCount && reader.TryReadRecord(index, out CaptureRecord candidate); index++)
+        {
+            if (candidate.DeviceIndex != -1)
+            {
+                firstArrival = candidate.ArrivalQpcTicks;
+                break;
+            }
+        }
+
+        reader.TrySeekToRecord(startRecord);
+
+        StringBuilder builder = new();
+        builder.Append(CultureInfo.InvariantCulture, $"Capture '{fullPath}': records={recordCount}, showing {startRecord}..{Math.Min(recordCount, startRecord + count) - 1}");
+        for (int index = 0; index < count && reader.TryReadNext(out CaptureRecord record); index++)
+        {
+            string offset = record.DeviceIndex == -1
+                ? "-"
+                : string.Create(CultureInfo.InvariantCulture, $"{(record.ArrivalQpcTicks - firstArrival) / (double)reader.HeaderQpcFrequency:F6}s");
+            string detail = record.DeviceIndex == -1
+                ? "meta"
+                : reader.HeaderVersion == InputCaptureFile.Version3 && AtpCapV3Payload.TryParseFrame(record.Payload.Span, out AtpCapV3Frame frame)
+                    ? string.Create(CultureInfo.InvariantCulture, $"contacts={frame.ContactCount}, button={((frame.Flags & AtpCapV3Payload.FrameFlagButtonClicked) != 0 ? 1 : 0)}")
+                    : "unparsed";
+            builder.AppendLine();
+            builder.Append(CultureInfo.InvariantCulture, $"  #{startRecord + index} t={offset} device={record.DeviceIndex}:{record.DeviceHash:X8} side={record.SideHint} payload={record.Payload.Length}B {detail}");
+        }
+
+        return new LinuxAtpCapSummaryResult(true, builder.ToString());
     }
 
     public static LinuxAtpCapSummaryResult Summarize(string capturePath)
@@ -228,17 +460,145 @@ internal static class LinuxAtpCapReplayRunner
         File.WriteAllText(outputPath, JsonSerializer.Serialize(dump, options));
     }
 
-    private static ulong Mix(ulong hash, ulong value)
+    // The one place capture records become engine frames; metrics, when given, count every
+    // record seen, parsed or dropped.
+    private static List<LinuxReplayFrame> ReadReplayFrames(InputCaptureReader reader, FrameMetrics? metrics = null)
+    {
+        List<LinuxReplayFrame> frames = [];
+        long baseQpcTicks = 0;
+        bool hasBaseQpc = false;
+        AtpCapV3Compatibility compatibility = AtpCapV3Compatibility.None;
+        LinuxReplaySideMapper sideMapper = new();
+        while (reader.TryReadNext(out CaptureRecord record))
+        {
+            metrics?.RecordSeen();
+            ReadOnlySpan<byte> payload = record.Payload.Span;
+            if (payload.Length == 0)
+            {
+                metrics?.RecordDropped(FrameDropReason.InvalidReportSize);
+                continue;
+            }
+
+            if (record.DeviceIndex == -1)
+            {
+                if (AtpCapV3Payload.TryParseMeta(payload, out AtpCapV3Meta meta))
+                {
+                    compatibility = AtpCapV3Payload.ResolveCompatibility(meta);
+                }
+
+                continue;
+            }
+
+            if (!AtpCapV3Payload.TryParseFrame(payload, out AtpCapV3Frame frame))
+            {
+                metrics?.RecordDropped(FrameDropReason.ParseFailed);
+                continue;
+            }
+
+            metrics?.RecordParsed();
+            if (!hasBaseQpc)
+            {
+                baseQpcTicks = record.ArrivalQpcTicks;
+                hasBaseQpc = true;
+            }
+
+            TrackpadSide side = sideMapper.Resolve(record.DeviceIndex, record.DeviceHash, AtpCapV3Payload.NormalizeSideHint(record.SideHint, compatibility));
+            long relativeQpc = record.ArrivalQpcTicks - baseQpcTicks;
+            frames.Add(new LinuxReplayFrame(
+                side,
+                AtpCapV3Payload.ToInputFrame(frame, record.ArrivalQpcTicks, DefaultMaxX, DefaultMaxY, compatibility.FlipY),
+                (long)Math.Round(relativeQpc * (double)Stopwatch.Frequency / reader.HeaderQpcFrequency),
+                record.DeviceIndex,
+                record.DeviceHash));
+        }
+
+        return frames;
+    }
+
+    private static void RunAllocationPass(
+        TouchProcessorCore core,
+        List<LinuxReplayFrame> frames,
+        DispatchEvent[] dispatchBuffer,
+        TouchProcessorCore.PointerDragEffect[] effectBuffer,
+        EngineDiagnosticEvent[] diagnosticBuffer,
+        out long allocatedBytes,
+        out long maxFrameBytes)
+    {
+        allocatedBytes = 0;
+        maxFrameBytes = 0;
+        for (int index = 0; index < frames.Count; index++)
+        {
+            LinuxReplayFrame replayFrame = frames[index];
+            InputFrame frame = replayFrame.Frame;
+            long before = GC.GetAllocatedBytesForCurrentThread();
+            core.ProcessFrame(replayFrame.Side, in frame, DefaultMaxX, DefaultMaxY, replayFrame.TimestampTicks);
+            while (core.DrainDispatchEvents(dispatchBuffer) == dispatchBuffer.Length)
+            {
+            }
+
+            while (core.DrainPointerDragEffects(effectBuffer) == effectBuffer.Length)
+            {
+            }
+
+            while (core.DrainDiagnostics(diagnosticBuffer) == diagnosticBuffer.Length)
+            {
+            }
+
+            long frameBytes = GC.GetAllocatedBytesForCurrentThread() - before;
+            allocatedBytes += frameBytes;
+            maxFrameBytes = Math.Max(maxFrameBytes, frameBytes);
+        }
+    }
+
+    // The lookup worker runs in real time; waiting for its answer here, bounded so a stuck
+    // worker only costs the word, keeps the replay independent of how fast it answers.
+    private static void AwaitDeferredAutocorrect(AutocorrectSession autocorrect)
+    {
+        long deadlineTicks = Stopwatch.GetTimestamp() + (Stopwatch.Frequency * 5);
+        SpinWait spinner = default;
+        while (autocorrect.HasDeferredLookup &&
+               !autocorrect.PollDeferredLookup() &&
+               Stopwatch.GetTimestamp() < deadlineTicks)
+        {
+            spinner.SpinOnce();
+        }
+    }
+
+    private static ulong MixOutput(ulong hash, LinuxUinputDevice device, VirtualTimeProvider clock, ref long lastWrites)
+    {
+        long writes = device.WriteCalls;
+        if (writes == lastWrites)
+        {
+            return hash;
+        }
+
+        lastWrites = writes;
+        hash = Mix(hash, (ulong)(clock.GetTimestamp() - VirtualStartTicks));
+        return Mix(hash, (ulong)device.EventsWritten);
+    }
+
+    private static ulong MixDispatch(ulong hash, in DispatchEvent dispatchEvent)
+    {
+        hash = Mix(hash, (ulong)dispatchEvent.Kind);
+        hash = Mix(hash, dispatchEvent.VirtualKey);
+        hash = Mix(hash, (ulong)dispatchEvent.MouseButton);
+        hash = Mix(hash, dispatchEvent.RepeatToken);
+        hash = Mix(hash, (ulong)dispatchEvent.Flags);
+        hash = Mix(hash, (ulong)dispatchEvent.Side);
+        return hash;
+    }
+
+    internal static ulong Mix(ulong hash, ulong value)
     {
         hash ^= value;
         hash *= 1099511628211UL;
         return hash;
     }
 
-    private static ulong Fingerprint(ulong seed, CaptureRecord record, in InputFrame frame, TrackpadSide side)
+    private static ulong Fingerprint(ulong seed, int deviceIndex, uint deviceHash, in InputFrame frame, TrackpadSide side)
     {
-        seed = Mix(seed, (ulong)record.DeviceHash);
-        seed = Mix(seed, (ulong)record.DeviceIndex);
+        seed = Mix(seed, (ulong)deviceHash);
+        seed = Mix(seed, (ulong)deviceIndex);
         seed = Mix(seed, (ulong)side);
         seed = Mix(seed, frame.ReportId);
         seed = Mix(seed, frame.ScanTime);
@@ -257,6 +617,8 @@ internal static class LinuxAtpCapReplayRunner
         return seed;
     }
 
+    private readonly record struct LinuxReplayFrame(TrackpadSide Side, InputFrame Frame, long TimestampTicks, int DeviceIndex, uint DeviceHash);
+
     private sealed class LinuxReplaySideMapper
     {
         private readonly Dictionary<(int DeviceIndex, uint DeviceHash), TrackpadSide> _sides = new();
@@ -0,0 +1,194 @@
+using System.Diagnostics;
+using GlassToKey;
+
+namespace GlassToKey.Linux;
+
+internal readonly record struct LinuxAutocorrectBenchmarkResult(
+    string Name,
+    int Words,
+    double WordsPerSecond,
+    double BytesPerWord,
+    int Corrections);
+
+// Times top-1 autocorrect resolution over a stream of common words with occasional typos:
+// the list-returning SymSpell lookup, the span lookup over the mapped index, and whole
+// AutocorrectSession word completions through its LRU, cold and warm.
+internal static class LinuxAutocorrectBenchmark
+{
+    private const int VocabularySize = 5000;
+    private const double TypoRate = 0.15;
+
+    public static IReadOnlyList<LinuxAutocorrectBenchmarkResult> Run(
+        MappedSymSpellIndex index,
+        SymSpell? symSpell,
+        int words,
+        int maxEditDistance)
+    {
+        string[] stream = BuildWordStream(words, seed: 41);
+        List<LinuxAutocorrectBenchmarkResult> results = new();
+        if (symSpell != null)
+        {
+            results.Add(Measure("symspell-lookup", stream, word =>
+                symSpell.Lookup(word, SymSpell.Verbosity.Top, maxEditDistance) is { Count: > 0 } suggestions &&
+                suggestions[0].distance > 0));
+        }
+
+        results.Add(Measure("mapped-span-lookup", stream, word =>
+            index.LookupTop(word.AsSpan(), maxEditDistance, out int distance) != null && distance > 0));
+
+        // Warm-up session so the cold run measures the LRU filling, not the JIT.
+        RunSession(index, BuildWordStream(Math.Min(words, 2000), seed: 7), maxEditDistance);
+        using AutocorrectSession session = CreateSession(index, maxEditDistance);
+        results.Add(MeasureSession("session-cold", session, stream));
+        results.Add(MeasureSession("session-warm", session, stream));
+        return results;
+    }
+
+    private static LinuxAutocorrectBenchmarkResult Measure(string name, string[] stream, Func<string, bool> resolve)
+    {
+        for (int index = 0; index < Math.Min(stream.Length, 2000); index++)
+        {
+            resolve(stream[index]);
+        }
+
+        int corrections = 0;
+        long startBytes = GC.GetAllocatedBytesForCurrentThread();
+        long startTicks = Stopwatch.GetTimestamp();
+        for (int index = 0; index < stream.Length; index++)
+        {
+            if (resolve(stream[index]))
+            {
+                corrections++;
+            }
+        }
+
+        return Summarize(name, stream.Length, Stopwatch.GetTimestamp() - startTicks, GC.GetAllocatedBytesForCurrentThread() - startBytes, corrections);
+    }
+
+    private static LinuxAutocorrectBenchmarkResult MeasureSession(string name, AutocorrectSession session, string[] stream)
+    {
+        long startBytes = GC.GetAllocatedBytesForCurrentThread();
+        long startTicks = Stopwatch.GetTimestamp();
+        int corrections = TypeWords(session, stream);
+        return Summarize(name, stream.Length, Stopwatch.GetTimestamp() - startTicks, GC.GetAllocatedBytesForCurrentThread() - startBytes, corrections);
+    }
+
+    private static void RunSession(MappedSymSpellIndex index, string[] stream, int maxEditDistance)
+    {
+        using AutocorrectSession session = CreateSession(index, maxEditDistance);
+        TypeWords(session, stream);
+    }
+
+    private static AutocorrectSession CreateSession(MappedSymSpellIndex index, int maxEditDistance)
+    {
+        AutocorrectSession session = new(new MappedIndexLexicon(index));
+        session.Configure(new AutocorrectOptions(
+            MaxEditDistance: maxEditDistance,
+            DryRunEnabled: false,
+            BlacklistCsv: string.Empty,
+            OverridesCsv: string.Empty));
+        session.SetEnabled(true);
+        return session;
+    }
+
+    private static int TypeWords(AutocorrectSession session, string[] stream)
+    {
+        int corrections = 0;
+        foreach (string word in stream)
+        {
+            foreach (char letter in word)
+            {
+                session.TrackLetter(letter);
+            }
+
+            if (session.TryCompleteWord(out _))
+            {
+                corrections++;
+            }
+        }
+
+        return corrections;
+    }
+
+    private static LinuxAutocorrectBenchmarkResult Summarize(string name, int words, long elapsedTicks, long allocatedBytes, int corrections)
+    {
+        double seconds = Math.Max(1, elapsedTicks) / (double)Stopwatch.Frequency;
+        return new LinuxAutocorrectBenchmarkResult(name, words, words / seconds, allocatedBytes / (double)Math.Max(1, words), corrections);
+    }
+
+    // Common dictionary words in frequency order, drawn with a skew toward the top and with
+    // a single random edit applied to a fraction of them.
+    private static string[] BuildWordStream(int count, int seed)
+    {
+        List<string> vocabulary = new(VocabularySize);
+        using (Stream? dictionary = BundledSymSpellIndex.OpenDictionary())
+        {
+            using StreamReader reader = new(dictionary ?? Stream.Null);
+            while (vocabulary.Count < VocabularySize && reader.ReadLine() is { } line)
+            {
+                int separator = line.IndexOf(' ');
+                string word = separator > 0 ? line[..separator] : line;
+                if (word.Length >= 3 && word.All(char.IsAsciiLetterLower))
+                {
+                    vocabulary.Add(word);
+                }
+            }
+        }
+
+        if (vocabulary.Count == 0)
+        {
+            throw new InvalidDataException("The bundled autocorrect dictionary could not be read.");
+        }
+
+        Random random = new(seed);
+        string[] stream = new string[count];
+        for (int index = 0; index < count; index++)
+        {
+            double skew = random.NextDouble();
+            string word = vocabulary[(int)(skew * skew * vocabulary.Count)];
+            stream[index] = random.NextDouble() < TypoRate ? ApplyTypo(word, random) : word;
+        }
+
+        return stream;
+    }
+
+    private static string ApplyTypo(string word, Random random)
+    {
+        int position = random.Next(word.Length - 1);
+        char letter = (char)('a' + random.Next(26));
+        return random.Next(4) switch
+        {
+            0 => word.Remove(position, 1),
+            1 => word.Insert(position, letter.ToString()),
+            2 => string.Concat(word.AsSpan(0, position), word.AsSpan(position + 1, 1), word.AsSpan(position, 1), word.AsSpan(position + 2)),
+            _ => string.Concat(word.AsSpan(0, position), letter.ToString(), word.AsSpan(position + 1))
+        };
+    }
+
+    // Same filtering as the shipped lexicon, over an index the benchmark already mapped.
+    private sealed class MappedIndexLexicon(MappedSymSpellIndex index) : AutocorrectSession.IAutocorrectLexicon
+    {
+        public bool IsLoaded => true;
+
+        public bool IsLoading => false;
+
+        public void BeginLoad()
+        {
+        }
+
+        public bool EnsureLoaded()
+        {
+            return true;
+        }
+
+        public string? ResolveCorrection(ReadOnlySpan<char> typedLower, int maxEditDistance)
+        {
+            string? term = index.LookupTop(typedLower, maxEditDistance, out int distance);
+            return term != null && distance > 0 ? term : null;
+        }
+
+        public void Unload()
+        {
+        }
+    }
+}
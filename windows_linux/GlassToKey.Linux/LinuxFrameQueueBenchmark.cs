@@ -0,0 +1,209 @@
+using System.Diagnostics;
+using GlassToKey;
+
+namespace GlassToKey.Linux;
+
+internal readonly record struct LinuxFrameQueueBenchmarkResult(
+    string Name,
+    int Frames,
+    double P50Us,
+    double P99Us,
+    double P999Us,
+    double MaxUs,
+    double FramesPerSecond);
+
+// Compares post->process latency of the engine frame queue against the previous
+// lock + AutoResetEvent queue. Each sample is stamped on post and measured on dequeue.
+internal static class LinuxFrameQueueBenchmark
+{
+    private const int QueueCapacity = 2048;
+
+    public static IReadOnlyList<LinuxFrameQueueBenchmarkResult> Run(int frames, double pacedIntervalMs)
+    {
+        long intervalTicks = (long)(pacedIntervalMs * Stopwatch.Frequency / 1000.0);
+        return
+        [
+            RunLocked("locked-queue paced", frames, intervalTicks),
+            RunRing("mpsc-ring paced", frames, intervalTicks),
+            RunLocked("locked-queue burst", frames, intervalTicks: 0),
+            RunRing("mpsc-ring burst", frames, intervalTicks: 0)
+        ];
+    }
+
+    private static LinuxFrameQueueBenchmarkResult RunRing(string name, int frames, long intervalTicks)
+    {
+        using BoundedMpscRing<TrackpadFrameEnvelope> ring = new(QueueCapacity);
+        long[] latencies = new long[frames];
+        Thread consumer = new(() =>
+        {
+            int received = 0;
+            while (received < frames)
+            {
+                if (!ring.TryDequeue(out TrackpadFrameEnvelope envelope))
+                {
+                    ring.WaitForItem();
+                    continue;
+                }
+
+                latencies[received++] = Stopwatch.GetTimestamp() - envelope.TimestampTicks;
+            }
+        })
+        {
+            IsBackground = true,
+            Name = "GlassToKey.FrameQueueBenchmark"
+        };
+
+        consumer.Start();
+        long startTicks = Produce(frames, intervalTicks, envelope =>
+        {
+            while (!ring.TryEnqueue(in envelope))
+            {
+                Thread.SpinWait(16);
+            }
+        });
+        consumer.Join();
+        return Summarize(name, latencies, Stopwatch.GetTimestamp() - startTicks);
+    }
+
+    private static LinuxFrameQueueBenchmarkResult RunLocked(string name, int frames, long intervalTicks)
+    {
+        using LockedFrameQueue queue = new(QueueCapacity);
+        long[] latencies = new long[frames];
+        Thread consumer = new(() =>
+        {
+            int received = 0;
+            while (received < frames)
+            {
+                if (!queue.TryDequeue(out TrackpadFrameEnvelope envelope))
+                {
+                    queue.Wait();
+                    continue;
+                }
+
+                latencies[received++] = Stopwatch.GetTimestamp() - envelope.TimestampTicks;
+            }
+        })
+        {
+            IsBackground = true,
+            Name = "GlassToKey.FrameQueueBenchmark"
+        };
+
+        consumer.Start();
+        long startTicks = Produce(frames, intervalTicks, envelope =>
+        {
+            while (!queue.TryEnqueue(in envelope))
+            {
+                Thread.SpinWait(16);
+            }
+        });
+        consumer.Join();
+        return Summarize(name, latencies, Stopwatch.GetTimestamp() - startTicks);
+    }
+
+    // Returns the start timestamp. Paced runs busy-wait between posts so the consumer has
+    // time to go idle, which is the live-input case the wake path has to handle.
+    private static long Produce(int frames, long intervalTicks, Action<TrackpadFrameEnvelope> post)
+    {
+        InputFrame frame = new() { ContactCount = 1, Contact0 = new ContactFrame(1, 100, 100, 0x03) };
+        long startTicks = Stopwatch.GetTimestamp();
+        long nextPostTicks = startTicks;
+        for (int index = 0; index < frames; index++)
+        {
+            if (intervalTicks > 0)
+            {
+                while (Stopwatch.GetTimestamp() < nextPostTicks)
+                {
+                    Thread.SpinWait(8);
+                }
+
+                nextPostTicks += intervalTicks;
+            }
+
+            post(new TrackpadFrameEnvelope(TrackpadSide.Left, frame, 7612, 5065, Stopwatch.GetTimestamp()));
+        }
+
+        return startTicks;
+    }
+
+    private static LinuxFrameQueueBenchmarkResult Summarize(string name, long[] latencyTicks, long elapsedTicks)
+    {
+        Array.Sort(latencyTicks);
+        double ticksToUs = 1_000_000.0 / Stopwatch.Frequency;
+        double seconds = Math.Max(1, elapsedTicks) / (double)Stopwatch.Frequency;
+        return new LinuxFrameQueueBenchmarkResult(
+            name,
+            latencyTicks.Length,
+            Percentile(latencyTicks, 0.50) * ticksToUs,
+            Percentile(latencyTicks, 0.99) * ticksToUs,
+            Percentile(latencyTicks, 0.999) * ticksToUs,
+            latencyTicks[^1] * ticksToUs,
+            latencyTicks.Length / seconds);
+    }
+
+    private static long Percentile(long[] sorted, double percentile)
+    {
+        int index = Math.Clamp((int)Math.Ceiling(percentile * sorted.Length) - 1, 0, sorted.Length - 1);
+        return sorted[index];
+    }
+
+    // Mirror of the previous TouchProcessorActor queue: one lock for post and dequeue, an
+    // AutoResetEvent set on every post, and a 4 ms wait when empty.
+    private sealed class LockedFrameQueue : IDisposable
+    {
+        private readonly TrackpadFrameEnvelope[] _queue;
+        private readonly object _gate = new();
+        private readonly AutoResetEvent _signal = new(false);
+        private int _head;
+        private int _tail;
+        private int _count;
+
+        public LockedFrameQueue(int capacity)
+        {
+            _queue = new TrackpadFrameEnvelope[capacity];
+        }
+
+        public bool TryEnqueue(in TrackpadFrameEnvelope envelope)
+        {
+            lock (_gate)
+            {
+                if (_count >= _queue.Length)
+                {
+                    return false;
+                }
+
+                _queue[_tail] = envelope;
+                _tail = (_tail + 1) % _queue.Length;
+                _count++;
+                _signal.Set();
+                return true;
+            }
+        }
+
+        public bool TryDequeue(out TrackpadFrameEnvelope envelope)
+        {
+            lock (_gate)
+            {
+                if (_count == 0)
+                {
+                    envelope = default;
+                    return false;
+                }
+
+                envelope = _queue[_head];
+                _head = (_head + 1) % _queue.Length;
+                _count--;
+                return true;
+            }
+        }
+
+        public void Wait()
+        {
+            _signal.WaitOne(4);
+        }
+
+        public void Dispose()
+        {
+            _signal.Dispose();
+        }
+    }
+}
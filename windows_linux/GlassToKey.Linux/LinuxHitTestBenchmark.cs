@@ -0,0 +1,265 @@
+using System.Diagnostics;
+using GlassToKey;
+
+namespace GlassToKey.Linux;
+
+internal readonly record struct LinuxHitTestBenchmarkResult(
+    string Name,
+    int Keys,
+    int Slots,
+    double ReferenceNsPerHit,
+    double ScalarNsPerHit,
+    double VectorNsPerHit,
+    int Mismatches);
+
+// Compares the structure-of-arrays BindingIndex against the previous per-binding scalar
+// hit test on every layout preset, flat and with per-key rotations applied through the keymap.
+internal static class LinuxHitTestBenchmark
+{
+    // Points this close to a key edge may legitimately resolve differently in float and double.
+    private const double EdgeTolerance = 1e-4;
+
+    public static IReadOnlyList<LinuxHitTestBenchmarkResult> Run(int points, int passes)
+    {
+        double[] xs = new double[points];
+        double[] ys = new double[points];
+        Random random = new(17);
+        for (int index = 0; index < points; index++)
+        {
+            xs[index] = random.NextDouble();
+            ys[index] = random.NextDouble();
+        }
+
+        List<LinuxHitTestBenchmarkResult> results = new();
+        foreach (LinuxHitTestCase testCase in BuildCases())
+        {
+            ReferenceHitTester reference = new(testCase.Index);
+            int mismatches = CountMismatches(testCase.Index, reference, xs, ys);
+            double referenceNs = Measure(xs, ys, passes, new ReferenceProbe(reference));
+            double scalarNs = Measure(xs, ys, passes, new IndexProbe(testCase.Index, allowVectorized: false));
+            double vectorNs = Measure(xs, ys, passes, new IndexProbe(testCase.Index, allowVectorized: true));
+            results.Add(new LinuxHitTestBenchmarkResult(
+                testCase.Name,
+                testCase.Index.Bindings.Length,
+                testCase.Index.SlotCount,
+                referenceNs,
+                scalarNs,
+                vectorNs,
+                mismatches));
+        }
+
+        return results;
+    }
+
+    internal static IReadOnlyList<LinuxHitTestCase> BuildCases()
+    {
+        List<LinuxHitTestCase> cases = new();
+        foreach (TrackpadLayoutPreset preset in TrackpadLayoutPreset.All)
+        {
+            KeymapStore keymap = KeymapStore.LoadBundledDefault();
+            keymap.SetActiveLayout(preset.Name);
+            AddCases(cases, preset, keymap, preset.Name);
+
+            // Rotations in both directions; SetKeyGeometry only accepts 0..360.
+            KeyLayout flatRight = BuildLayout(preset, keymap, mirrored: false);
+            KeyLayout flatLeft = BuildLayout(preset, keymap, mirrored: true);
+            ApplyRotations(keymap, TrackpadSide.Right, flatRight);
+            ApplyRotations(keymap, TrackpadSide.Left, flatLeft);
+            AddCases(cases, preset, keymap, preset.Name + " rotated");
+        }
+
+        return cases;
+    }
+
+    // Reference and candidate must agree exactly away from key edges and depth ties.
+    internal static int CountMismatches(BindingIndex index, ReferenceHitTester reference, double[] xs, double[] ys)
+    {
+        int mismatches = 0;
+        for (int point = 0; point < xs.Length; point++)
+        {
+            double x = xs[point];
+            double y = ys[point];
+            int expected = reference.HitTest(x, y).BindingIndex;
+            int vector = index.HitTest(x, y).BindingIndex;
+            int scalar = index.HitTest(x, y, allowVectorized: false).BindingIndex;
+            if (vector != scalar)
+            {
+                mismatches++;
+                continue;
+            }
+
+            if (vector != expected && !reference.IsAmbiguous(expected, vector, x, y, EdgeTolerance))
+            {
+                mismatches++;
+            }
+        }
+
+        return mismatches;
+    }
+
+    private static void AddCases(List<LinuxHitTestCase> cases, TrackpadLayoutPreset preset, KeymapStore keymap, string name)
+    {
+        KeyLayout right = BuildLayout(preset, keymap, mirrored: false);
+        cases.Add(new LinuxHitTestCase($"{name} right", BindingIndex.Build(right, TrackpadSide.Right, 0, keymap)));
+        if (!preset.BlankLeftSide)
+        {
+            KeyLayout left = BuildLayout(preset, keymap, mirrored: true);
+            cases.Add(new LinuxHitTestCase($"{name} left", BindingIndex.Build(left, TrackpadSide.Left, 0, keymap)));
+        }
+    }
+
+    private static KeyLayout BuildLayout(TrackpadLayoutPreset preset, KeymapStore keymap, bool mirrored)
+    {
+        return LayoutBuilder.BuildLayout(
+            preset,
+            RuntimeConfigurationFactory.TrackpadWidthMm,
+            RuntimeConfigurationFactory.TrackpadHeightMm,
+            RuntimeConfigurationFactory.KeyWidthMm,
+            RuntimeConfigurationFactory.KeyHeightMm,
+            ColumnLayoutDefaults.DefaultSettings(preset.Columns),
+            keymap,
+            mirrored);
+    }
+
+    private static void ApplyRotations(KeymapStore keymap, TrackpadSide side, KeyLayout layout)
+    {
+        for (int row = 0; row < layout.Rects.Length; row++)
+        {
+            for (int col = 0; col < layout.Rects[row].Length; col++)
+            {
+                int step = ((row * 5) + (col * 3)) % 7;
+                double rotation = step == 0 ? 0.0 : step <= 3 ? step * 6.0 : 360.0 - ((step - 3) * 6.0);
+                keymap.SetKeyGeometry(GridKeyPosition.StorageKey(side, row, col), rotation);
+            }
+        }
+    }
+
+    // Probes are structs so each Measure instantiation calls its hit test directly instead of
+    // paying a delegate call that would dominate the sub-100ns timings.
+    private static double Measure<TProbe>(double[] xs, double[] ys, int passes, TProbe probe)
+        where TProbe : struct, IHitTestProbe
+    {
+        // One untimed pass so tiering and caches settle before the timed passes.
+        int checksum = 0;
+        for (int point = 0; point < xs.Length; point++)
+        {
+            checksum += probe.HitTest(xs[point], ys[point]);
+        }
+
+        long startTicks = Stopwatch.GetTimestamp();
+        for (int pass = 0; pass < passes; pass++)
+        {
+            for (int point = 0; point < xs.Length; point++)
+            {
+                checksum += probe.HitTest(xs[point], ys[point]);
+            }
+        }
+
+        long elapsedTicks = Stopwatch.GetTimestamp() - startTicks;
+        GC.KeepAlive(checksum);
+        return elapsedTicks * 1_000_000_000.0 / Stopwatch.Frequency / Math.Max(1L, (long)xs.Length * passes);
+    }
+
+    internal readonly record struct LinuxHitTestCase(string Name, BindingIndex Index);
+
+    private interface IHitTestProbe
+    {
+        int HitTest(double x, double y);
+    }
+
+    private readonly struct ReferenceProbe(ReferenceHitTester reference) : IHitTestProbe
+    {
+        public int HitTest(double x, double y) => reference.HitTest(x, y).BindingIndex;
+    }
+
+    private readonly struct IndexProbe(BindingIndex index, bool allowVectorized) : IHitTestProbe
+    {
+        public int HitTest(double x, double y) => index.HitTest(x, y, allowVectorized).BindingIndex;
+    }
+
+    // The hit test BindingIndex used before the structure-of-arrays layout: jagged bucket
+    // lists over per-binding double-precision KeyHitGeometry records.
+    internal sealed class ReferenceHitTester
+    {
+        private readonly KeyHitGeometry[] _geometries;
+        private readonly int[][] _buckets;
+        private readonly int _bucketRows;
+        private readonly int _bucketColumns;
+
+        public ReferenceHitTester(BindingIndex index)
+        {
+            _bucketRows = index.BucketRows;
+            _bucketColumns = index.BucketColumns;
+            _geometries = new KeyHitGeometry[index.Bindings.Length];
+            List<int>[] bucketLists = new List<int>[_bucketRows * _bucketColumns];
+            for (int bucket = 0; bucket < bucketLists.Length; bucket++)
+            {
+                bucketLists[bucket] = new List<int>(4);
+            }
+
+            for (int binding = 0; binding < _geometries.Length; binding++)
+            {
+                KeyHitGeometry geometry = KeyHitGeometry.FromRect(index.Bindings[binding].Rect);
+                _geometries[binding] = geometry;
+                for (int row = BucketIndex(geometry.MinY, _bucketRows); row <= BucketIndex(geometry.MaxY, _bucketRows); row++)
+                {
+                    for (int col = BucketIndex(geometry.MinX, _bucketColumns); col <= BucketIndex(geometry.MaxX, _bucketColumns); col++)
+                    {
+                        bucketLists[(row * _bucketColumns) + col].Add(binding);
+                    }
+                }
+            }
+
+            _buckets = new int[bucketLists.Length][];
+            for (int bucket = 0; bucket < bucketLists.Length; bucket++)
+            {
+                _buckets[bucket] = bucketLists[bucket].ToArray();
+            }
+        }
+
+        public EngineBindingHit HitTest(double normalizedX, double normalizedY)
+        {
+            int[] candidates = _buckets[(BucketIndex(normalizedY, _bucketRows) * _bucketColumns) + BucketIndex(normalizedX, _bucketColumns)];
+            int best = -1;
+            double bestScore = double.NegativeInfinity;
+            double bestArea = double.PositiveInfinity;
+            for (int i = 0; i < candidates.Length; i++)
+            {
+                int index = candidates[i];
+                KeyHitGeometry geometry = _geometries[index];
+                if (!geometry.Contains(normalizedX, normalizedY))
+                {
+                    continue;
+                }
+
+                double score = geometry.DistanceToEdge(normalizedX, normalizedY);
+                double area = geometry.Area;
+                if (score > bestScore || (Math.Abs(score - bestScore) < 1e-9 && area < bestArea))
+                {
+                    best = index;
+                    bestScore = score;
+                    bestArea = area;
+                }
+            }
+
+            return best >= 0 ? new EngineBindingHit(true, best) : EngineBindingHit.Miss;
+        }
+
+        // True when either winner sits on a key edge or both keys are equally deep: cases where
+        // float rounding can legitimately pick the other key.
+        public bool IsAmbiguous(int expected, int actual, double x, double y, double tolerance)
+        {
+            double expectedDepth = expected >= 0 ? _geometries[expected].DistanceToEdge(x, y) : double.NaN;
+            double actualDepth = actual >= 0 ? _geometries[actual].DistanceToEdge(x, y) : double.NaN;
+            return Math.Abs(expectedDepth) <= tolerance ||
+                   Math.Abs(actualDepth) <= tolerance ||
+                   Math.Abs(expectedDepth - actualDepth) <= tolerance;
+        }
+
+        private static int BucketIndex(double value, int bucketCount)
+        {
+            int index = (int)(Math.Clamp(value, 0.0, 0.999999) * bucketCount);
+            return Math.Clamp(index, 0, bucketCount - 1);
+        }
+    }
+}
@@ -1,8 +1,15 @@
+using System.Buffers.Binary;
 using System.Diagnostics;
+using System.Diagnostics.Tracing;
+using System.IO.Pipes;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using System.Text;
 using System.Text.Json;
 using GlassToKey.Linux.Config;
 using GlassToKey.Linux.Runtime;
 using GlassToKey.Platform.Linux;
+using GlassToKey.Platform.Linux.Contracts;
 using GlassToKey.Platform.Linux.Devices;
 using GlassToKey.Platform.Linux.Evdev;
 using GlassToKey.Platform.Linux.Haptics;
@@ -51,6 +58,66 @@ internal static class LinuxSelfTestRunner
             return new LinuxSelfTestResult(false, failure);
         }
 
+        if (!ValidateDeferredAutocorrectDispatch(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateMappedSymSpellIndex(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateAutocorrectLookupCache(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateFileChangeWatcher(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateUeventParsing(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateTrackpadDeviceCache(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateHotplugRebind(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidatePreviewChannel(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidatePipelineLatency(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateEngineEventSource(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateEngineQueueDropEvent(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateSyntheticTouchStream(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
         if (!ValidateBundledSettingsDefaults(out failure))
         {
             return new LinuxSelfTestResult(false, failure);
@@ -71,6 +138,11 @@ internal static class LinuxSelfTestRunner
             return new LinuxSelfTestResult(false, failure);
         }
 
+        if (!ValidateGestureRecognizerPipeline(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
         if (!ValidateLinuxHeldModifierSequencing(out failure))
         {
             return new LinuxSelfTestResult(false, failure);
@@ -101,6 +173,16 @@ internal static class LinuxSelfTestRunner
             return new LinuxSelfTestResult(false, failure);
         }
 
+        if (!ValidateCaptureWriterDropsWhenDiskStalls(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateCaptureReaderRecordIndex(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
         if (!ValidateLinuxForceThresholdDispatch(out failure))
         {
             return new LinuxSelfTestResult(false, failure);
@@ -111,6 +193,51 @@ internal static class LinuxSelfTestRunner
             return new LinuxSelfTestResult(false, failure);
         }
 
+        if (!ValidateEvdevReactorEpollSet(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateEngineFrameRing(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateBindingIndexHitTesting(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateUinputBatchedWrites(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateUinputLoopback(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateVirtualClockPipeline(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateDispatchPumpDeadlineScheduling(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateReplayAllocationBudget(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
+        if (!ValidateBatchReplayMatchesActorReplay(out failure))
+        {
+            return new LinuxSelfTestResult(false, failure);
+        }
+
         if (!ValidateMagicTrackpadSelectionHeuristic(out failure))
         {
             return new LinuxSelfTestResult(false, failure);
@@ -361,98 +488,332 @@ internal static class LinuxSelfTestRunner
         return true;
     }
 
-    private static bool ValidateBundledSettingsDefaults(out string failure)
+    // The mapped index must return the same top suggestion and distance as SymSpell itself.
+    private static bool ValidateMappedSymSpellIndex(out string failure)
     {
+        const int WordLimit = 5000;
+        StringBuilder dictionary = new();
+        using (Stream? stream = BundledSymSpellIndex.OpenDictionary())
+        {
+            if (stream == null)
+            {
+                failure = "Bundled autocorrect dictionary resource is missing.";
+                return false;
+            }
+
+            using StreamReader reader = new(stream);
+            for (int line = 0; line < WordLimit && reader.ReadLine() is { } text; line++)
+            {
+                dictionary.AppendLine(text);
+            }
+        }
+
+        SymSpell symSpell = new(WordLimit, BundledSymSpellIndex.MaxEditDistance, BundledSymSpellIndex.PrefixLength);
+        using (MemoryStream source = new(Encoding.UTF8.GetBytes(dictionary.ToString())))
+        {
+            symSpell.LoadDictionary(source, termIndex: 0, countIndex: 1);
+        }
+
+        string path = Path.Combine(Path.GetTempPath(), $"glasstokey-selftest-{Environment.ProcessId}.idx");
+        try
+        {
+            SymSpellIndexFile.WriteFile(symSpell, 0x5EEDUL, path);
+            if (MappedSymSpellIndex.TryOpen(path, 0xBADUL, BundledSymSpellIndex.MaxEditDistance, BundledSymSpellIndex.PrefixLength, out _))
+            {
+                failure = "Mapped SymSpell index accepted a file built from a different dictionary.";
+                return false;
+            }
+
+            if (!MappedSymSpellIndex.TryOpen(path, 0x5EEDUL, BundledSymSpellIndex.MaxEditDistance, BundledSymSpellIndex.PrefixLength, out MappedSymSpellIndex? index))
+            {
+                failure = "Mapped SymSpell index could not open the file it just wrote.";
+                return false;
+            }
+
+            using (index)
+            {
+                if (index!.WordCount != symSpell.WordCount)
+                {
+                    failure = $"Mapped SymSpell index word count mismatch: expected={symSpell.WordCount}, actual={index.WordCount}.";
+                    return false;
+                }
+
+                string[] words = symSpell.Words.Keys.ToArray();
+                Random random = new(29);
+                List<string> probes = new();
+                for (int query = 0; query < 3000; query++)
+                {
+                    string input = MutateWord(words[random.Next(words.Length)], random.Next(4), random);
+                    if (probes.Count < 200)
+                    {
+                        probes.Add(input);
+                    }
+
+                    for (int maxEditDistance = 1; maxEditDistance <= BundledSymSpellIndex.MaxEditDistance; maxEditDistance++)
+                    {
+                        List<SymSpell.SuggestItem> expected = symSpell.Lookup(input, SymSpell.Verbosity.Top, maxEditDistance);
+                        string? actual = index.LookupTop(input, maxEditDistance, out int distance);
+                        string? expectedTerm = expected.Count == 0 ? null : expected[0].term;
+                        int expectedDistance = expected.Count == 0 ? -1 : expected[0].distance;
+                        if (!string.Equals(expectedTerm, actual, StringComparison.Ordinal) || expectedDistance != distance)
+                        {
+                            failure = $"Mapped SymSpell lookup for '{input}' (max {maxEditDistance}) returned '{actual}'/{distance}, SymSpell returned '{expectedTerm}'/{expectedDistance}.";
+                            return false;
+                        }
+                    }
+                }
+
+                // Steady state reuses the thread's scratch and the interned terms.
+                long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+                foreach (string probe in probes)
+                {
+                    index.LookupTop(probe, BundledSymSpellIndex.MaxEditDistance, out _);
+                }
+
+                long allocated = GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+                if (allocated != 0)
+                {
+                    failure = $"Mapped SymSpell span lookups allocated {allocated} bytes after warm-up.";
+                    return false;
+                }
+            }
+
+            // A corrupt file can pass the header checks with no free delete slot; lookups must
+            // still terminate.
+            byte[] image = File.ReadAllBytes(path);
+            SymSpellIndexHeader header = MemoryMarshal.Read<SymSpellIndexHeader>(image);
+            SymSpellIndexLayout layout = SymSpellIndexFile.ComputeLayout(
+                header.WordCount,
+                header.WordSlotCount,
+                header.DeleteSlotCount,
+                header.SuggestionCount,
+                header.CharCount);
+            Span<SymSpellIndexDeleteSlot> deleteSlots = MemoryMarshal.Cast<byte, SymSpellIndexDeleteSlot>(
+                image.AsSpan((int)layout.DeleteSlotsOffset, (int)(layout.SuggestionsOffset - layout.DeleteSlotsOffset)));
+            deleteSlots.Fill(new SymSpellIndexDeleteSlot(hash: 0, start: 0, count: 1));
+            File.WriteAllBytes(path, image);
+            if (!MappedSymSpellIndex.TryOpen(path, 0x5EEDUL, BundledSymSpellIndex.MaxEditDistance, BundledSymSpellIndex.PrefixLength, out MappedSymSpellIndex? fullIndex))
+            {
+                failure = "Mapped SymSpell index rejected a file whose only damage is a full delete table.";
+                return false;
+            }
+
+            using (fullIndex)
+            {
+                Task lookup = Task.Run(() => fullIndex!.LookupTop("qzxv", BundledSymSpellIndex.MaxEditDistance, out _));
+                if (!lookup.Wait(TimeSpan.FromSeconds(10)))
+                {
+                    failure = "Mapped SymSpell lookup did not terminate on an index with a full delete table.";
+                    return false;
+                }
+            }
+        }
+        finally
+        {
+            File.Delete(path);
+        }
+
         failure = string.Empty;
+        return true;
+    }
 
-        string path = Path.Combine(AppContext.BaseDirectory, "GLASSTOKEY_DEFAULT_KEYMAP.json");
-        if (!File.Exists(path))
+    private static bool ValidateAutocorrectLookupCache(out string failure)
+    {
+        AutocorrectLookupCache cache = new(3);
+        cache.Set("one", 2, AutocorrectCacheOutcome.Lookup, "uno");
+        cache.Set("two", 2, AutocorrectCacheOutcome.Lookup, null);
+        cache.Set("three", 2, AutocorrectCacheOutcome.Blacklisted, null);
+        char[] probe = "one".ToCharArray();
+        if (!cache.TryGet(probe, 2, out AutocorrectCacheOutcome outcome, out string? value) ||
+            outcome != AutocorrectCacheOutcome.Lookup ||
+            !string.Equals(value, "uno", StringComparison.Ordinal))
+        {
+            failure = "Autocorrect lookup cache did not return an entry for an equal span key.";
+            return false;
+        }
+
+        if (cache.TryGet(probe, 1, out _, out _))
         {
-            failure = $"Bundled Linux keymap is missing: {path}";
+            failure = "Autocorrect lookup cache ignored the edit distance in its key.";
+            return false;
+        }
+
+        // "one" was just used, so "two" is the least recently used entry.
+        cache.Set("four", 2, AutocorrectCacheOutcome.Override, "4");
+        if (cache.Count != 3 ||
+            cache.TryGet("two", 2, out _, out _) ||
+            !cache.TryGet("one", 2, out _, out _) ||
+            !cache.TryGet("three", 2, out _, out _) ||
+            !cache.TryGet("four", 2, out _, out _))
+        {
+            failure = "Autocorrect lookup cache did not evict the least recently used entry.";
             return false;
         }
 
+        using AutocorrectSession session = new(new FakeAutocorrectLexicon(("teh", "the")));
+        session.SetEnabled(true);
+        for (int pass = 0; pass < 2; pass++)
+        {
+            long allocatedBefore = GC.GetAllocatedBytesForCurrentThread();
+            foreach (char letter in "Hello")
+            {
+                session.TrackLetter(letter);
+            }
+
+            session.TryCompleteWord(out _);
+            long allocated = GC.GetAllocatedBytesForCurrentThread() - allocatedBefore;
+            if (pass == 1 && allocated != 0)
+            {
+                failure = $"Completing a cached word allocated {allocated} bytes.";
+                return false;
+            }
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateFileChangeWatcher(out string failure)
+    {
+        string root = Path.Combine(Path.GetTempPath(), $"glasstokey-selftest-{Guid.NewGuid():N}");
+        string devices = Path.Combine(root, "input");
+        string settingsPath = Path.Combine(root, "settings.json");
+        string keymapPath = Path.Combine(root, "keymap.json");
+        Directory.CreateDirectory(devices);
+        File.WriteAllText(settingsPath, "{}");
+        File.WriteAllText(keymapPath, "{}");
         try
         {
-            using JsonDocument document = JsonDocument.Parse(File.ReadAllText(path));
-            if (!TryGetPropertyIgnoreCase(document.RootElement, "settings", out JsonElement settingsElement) ||
-                settingsElement.ValueKind != JsonValueKind.Object)
+            using LinuxFileChangeWatcher watcher = new(TimeSpan.FromMilliseconds(25));
+            if (!watcher.Watch([settingsPath, keymapPath], [devices]))
             {
-                failure = "Bundled Linux defaults are missing the settings payload.";
+                failure = "File change watcher could not watch existing paths.";
                 return false;
             }
 
-            UserSettings? expected = JsonSerializer.Deserialize<UserSettings>(
-                settingsElement.GetRawText(),
-                new JsonSerializerOptions { PropertyNameCaseInsensitive = true });
-            if (expected == null)
+            long observed = watcher.ChangeSequence;
+            File.WriteAllText(Path.Combine(root, "unrelated.json"), "{}");
+            if (WaitForFileChange(watcher, observed, 100))
             {
-                failure = "Bundled Linux settings payload did not deserialize.";
+                failure = "File change watcher reported a change to an unwatched file.";
                 return false;
             }
 
-            expected.NormalizeRanges();
+            Stopwatch stopwatch = Stopwatch.StartNew();
+            for (int write = 0; write < 5; write++)
+            {
+                File.WriteAllText(settingsPath, $"{{\"revision\":{write}}}");
+            }
 
-            UserSettings actual = UserSettings.LoadBundledDefaultsOrDefault();
-            if (!string.Equals(actual.TwoFingerHoldAction, expected.TwoFingerHoldAction, StringComparison.Ordinal) ||
-                !string.Equals(actual.ThreeFingerHoldAction, expected.ThreeFingerHoldAction, StringComparison.Ordinal))
+            if (!WaitForFileChange(watcher, observed, 2000))
             {
-                failure = "Bundled Linux settings did not load expected gesture defaults from the settings payload.";
+                failure = "File change watcher missed a settings write.";
                 return false;
             }
 
-            if (actual.ForceMin != expected.ForceMin || actual.ForceCap != expected.ForceCap)
+            double latencyMs = stopwatch.Elapsed.TotalMilliseconds;
+            if (latencyMs >= 250)
             {
-                failure = "Bundled Linux settings did not load expected force thresholds from the settings payload.";
+                failure = $"File change watcher took {latencyMs:F1} ms to report a settings write.";
                 return false;
             }
 
-            if (actual.ThreeFingerDragEnabled != expected.ThreeFingerDragEnabled)
+            Thread.Sleep(75);
+            if (watcher.ChangeSequence != observed + 1)
             {
-                failure = "Bundled Linux settings did not load the expected 3-finger drag toggle from the settings payload.";
+                failure = $"File change watcher reported {watcher.ChangeSequence - observed} changes for one burst of writes.";
                 return false;
             }
 
-            if (!string.Equals(actual.LayoutPresetName, expected.LayoutPresetName, StringComparison.OrdinalIgnoreCase))
+            // Editors commonly save by writing a sibling and renaming it over the original.
+            observed = watcher.ChangeSequence;
+            string replacement = keymapPath + ".tmp";
+            File.WriteAllText(replacement, "{\"layers\":[]}");
+            File.Move(replacement, keymapPath, overwrite: true);
+            if (!WaitForFileChange(watcher, observed, 2000))
             {
-                failure = "Bundled Linux settings did not load the expected layout preset from the settings payload.";
+                failure = "File change watcher missed a keymap replaced by rename.";
                 return false;
             }
 
-            return true;
+            observed = watcher.ChangeSequence;
+            File.WriteAllText(Path.Combine(devices, "event42"), string.Empty);
+            if (!WaitForFileChange(watcher, observed, 2000))
+            {
+                failure = "File change watcher missed a new entry in a watched directory.";
+                return false;
+            }
+
+            // Attribute changes on device nodes (udev chmod, our own uinput node) are not hotplug.
+            Thread.Sleep(50);
+            observed = watcher.ChangeSequence;
+            if (OperatingSystem.IsLinux())
+            {
+                File.SetUnixFileMode(Path.Combine(devices, "event42"), UnixFileMode.UserRead | UnixFileMode.UserWrite | UnixFileMode.GroupRead);
+            }
+
+            if (WaitForFileChange(watcher, observed, 100))
+            {
+                failure = "File change watcher reported an attribute change in a watched directory.";
+                return false;
+            }
+
+            watcher.Watch([settingsPath], []);
+            Thread.Sleep(50);
+            observed = watcher.ChangeSequence;
+            File.WriteAllText(keymapPath, "{}");
+            if (WaitForFileChange(watcher, observed, 100))
+            {
+                failure = "File change watcher still reported a file removed from its watch set.";
+                return false;
+            }
         }
-        catch (Exception ex)
+        finally
         {
-            failure = $"Bundled Linux settings validation failed: {ex.Message}";
-            return false;
+            Directory.Delete(root, recursive: true);
         }
+
+        failure = string.Empty;
+        return true;
     }
 
-    private static bool ValidateConfiguredRuntimeStartupState(out string failure)
+    private static bool WaitForFileChange(LinuxFileChangeWatcher watcher, long observed, int timeoutMs)
     {
-        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
-        UserSettings settings = new()
+        return watcher.WaitForChangeAsync(observed, CancellationToken.None).Wait(timeoutMs);
+    }
+
+    private static bool ValidateUeventParsing(out string failure)
+    {
+        byte[] kernel = Encoding.ASCII.GetBytes(
+            "add@/devices/virtual/input/input20/event5\0ACTION=add\0DEVPATH=/devices/virtual/input/input20/event5\0" +
+            "SUBSYSTEM=input\0MAJOR=13\0MINOR=69\0DEVNAME=input/event5\0SEQNUM=4242\0");
+        if (!LinuxUevent.TryParse(kernel, out LinuxUevent parsed) ||
+            parsed != new LinuxUevent("add", "input", "input/event5", "/devices/virtual/input/input20/event5"))
         {
-            LayoutPresetName = preset.Name,
-            ActiveLayer = 2,
-            TypingEnabled = false,
-            KeyboardModeEnabled = true
-        };
-        settings.NormalizeRanges();
+            failure = "Kernel uevent message did not parse into its action, subsystem and device name.";
+            return false;
+        }
 
-        using RecordingDispatcher dispatcher = new();
-        using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
-        if (!host.TryGetSnapshot(out TouchProcessorRuntimeSnapshot snapshot))
+        byte[] properties = Encoding.ASCII.GetBytes("ACTION=remove\0SUBSYSTEM=input\0DEVNAME=/dev/input/event5\0");
+        byte[] udev = new byte[40 + properties.Length];
+        "libudev\0"u8.CopyTo(udev);
+        BinaryPrimitives.WriteUInt32BigEndian(udev.AsSpan(8), 0xfeedcafe);
+        BinaryPrimitives.WriteInt32LittleEndian(udev.AsSpan(12), 40);
+        BinaryPrimitives.WriteInt32LittleEndian(udev.AsSpan(16), 40);
+        BinaryPrimitives.WriteInt32LittleEndian(udev.AsSpan(20), properties.Length);
+        properties.CopyTo(udev, 40);
+        if (!LinuxUevent.TryParse(udev, out parsed) ||
+            parsed != new LinuxUevent("remove", "input", "/dev/input/event5", null))
         {
-            failure = "Configured runtime host did not produce an initial snapshot.";
+            failure = "udevd uevent message did not parse past its libudev header.";
             return false;
         }
 
-        if (snapshot.ActiveLayer != settings.ActiveLayer ||
-            snapshot.TypingEnabled != settings.TypingEnabled ||
-            snapshot.KeyboardModeEnabled != settings.KeyboardModeEnabled)
+        BinaryPrimitives.WriteInt32LittleEndian(udev.AsSpan(20), properties.Length + 1);
+        if (LinuxUevent.TryParse(udev, out _) ||
+            LinuxUevent.TryParse(Encoding.ASCII.GetBytes("ACTION=add\0SUBSYSTEM=input\0"), out _))
         {
-            failure = $"Configured runtime host did not restore startup mode state (layer={snapshot.ActiveLayer}, typing={snapshot.TypingEnabled}, keyboard={snapshot.KeyboardModeEnabled}).";
+            failure = "Malformed uevent messages were accepted.";
             return false;
         }
 
@@ -460,78 +821,58 @@ internal static class LinuxSelfTestRunner
         return true;
     }
 
-    private static bool ValidateConfiguredMouseTakeoverStartupState(out string failure)
+    private static bool ValidateTrackpadDeviceCache(out string failure)
     {
-        const ushort maxX = 7612;
-        const ushort maxY = 5065;
-        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
-        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
-        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
-        NormalizedRect keyRect = rightLayout.Rects[0][0];
-        ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
-        ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
-        ushort offKeyX = (ushort)Math.Clamp(maxX - 64, 1, maxX - 1);
-        ushort offKeyY = (ushort)Math.Clamp(maxY - 64, 1, maxY - 1);
-
-        UserSettings settings = new()
-        {
-            LayoutPresetName = preset.Name,
-            TypingEnabled = true,
-            KeyboardModeEnabled = false,
-            KeyBufferMs = 1.0,
-            IntentMoveMm = 1.0,
-            DragCancelMm = 1.0
-        };
-        settings.NormalizeRanges();
+        FakeTrackpadBackend backend = new();
+        FakeUeventSource source = new();
+        using (LinuxTrackpadDeviceCache cache = new(backend, source, TimeSpan.FromHours(1)))
+        {
+            cache.EnumerateDevices();
+            cache.EnumerateDevices();
+            cache.EnumerateDevices();
+            if (backend.EnumerationCount != 1)
+            {
+                failure = $"Trackpad device cache enumerated {backend.EnumerationCount} times without a uevent.";
+                return false;
+            }
 
-        using RecordingDispatcher dispatcher = new();
-        using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
+            long generation = cache.Generation;
+            source.Raise(new LinuxUevent("add", "hidraw", "hidraw3", null));
+            cache.EnumerateDevices();
+            if (backend.EnumerationCount != 1 || cache.Generation != generation)
+            {
+                failure = "Trackpad device cache was invalidated by a non-input uevent.";
+                return false;
+            }
 
-        long now = Stopwatch.Frequency / 100;
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 200);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
+            Task change = cache.WaitForChangeAsync(generation);
+            backend.Devices = [CreateFakeTrackpad("selftest")];
+            source.Raise(new LinuxUevent("add", "input", "input/event7", null));
+            if (!change.IsCompleted ||
+                cache.EnumerateDevices().Count != 1 ||
+                backend.EnumerationCount != 2)
+            {
+                failure = "Trackpad device cache did not re-enumerate after an input uevent.";
+                return false;
+            }
+        }
 
-        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out TouchProcessorRuntimeSnapshot snapshot))
+        if (!source.Disposed)
         {
-            failure = "Configured runtime host did not produce a synchronized snapshot for mouse takeover validation.";
+            failure = "Trackpad device cache did not dispose its uevent source.";
             return false;
         }
 
-        if (!string.Equals(snapshot.IntentMode, "MouseActive", StringComparison.Ordinal))
+        FakeTrackpadBackend uncachedBackend = new();
+        using (LinuxTrackpadDeviceCache uncached = new(uncachedBackend, source: null, TimeSpan.FromHours(1)))
         {
-            failure = $"Configured runtime host did not restore mouse takeover on startup (intent={snapshot.IntentMode}).";
+            uncached.EnumerateDevices();
+            uncached.EnumerateDevices();
+        }
+
+        if (uncachedBackend.EnumerationCount != 2)
+        {
+            failure = "Trackpad device cache without a uevent source served stale enumerations.";
             return false;
         }
 
@@ -539,249 +880,2120 @@ internal static class LinuxSelfTestRunner
         return true;
     }
 
-    private static bool ValidateLinuxChordShiftDispatchSequence(out string failure)
+    // A missing trackpad must be picked up as soon as its add uevent arrives, not after the
+    // reconnect delay, in both read modes.
+    private static bool ValidateHotplugRebind(out string failure)
     {
-        const ushort maxX = 7612;
-        const ushort maxY = 5065;
+        foreach (LinuxEvdevReadMode readMode in new[] { LinuxEvdevReadMode.Readiness, LinuxEvdevReadMode.Polling })
+        {
+            FakeTrackpadBackend backend = new();
+            FakeUeventSource source = new();
+            RecordingRuntimeObserver observer = new();
+            LinuxInputDeviceDescriptor trackpad = CreateFakeTrackpad("selftest-hotplug");
+            LinuxInputRuntimeService service = new(trackpadBackend: backend);
+            LinuxInputRuntimeOptions options = new()
+            {
+                Observer = observer,
+                ReadMode = readMode,
+                ReconnectDelay = TimeSpan.FromSeconds(30),
+                UeventSourceFactory = () => source
+            };
+
+            using CancellationTokenSource cts = new();
+            Task run = service.RunAsync([new LinuxTrackpadBinding(TrackpadSide.Left, trackpad)], new NullFrameSink(), options, cts.Token);
+            try
+            {
+                if (!observer.WaitFor(state => state.Message == "Waiting for trackpad to reappear.", 2000))
+                {
+                    failure = $"Hotplug runtime ({readMode}) never reported waiting for the missing trackpad.";
+                    return false;
+                }
 
-        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
-        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
-        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
-        NormalizedRect rightKeyRect = rightLayout.Rects[0][2];
-        ushort rightKeyX = (ushort)Math.Clamp((int)Math.Round((rightKeyRect.X + (rightKeyRect.Width * 0.5)) * maxX), 1, maxX - 1);
-        ushort rightKeyY = (ushort)Math.Clamp((int)Math.Round((rightKeyRect.Y + (rightKeyRect.Height * 0.5)) * maxY), 1, maxY - 1);
+                backend.Devices = [trackpad];
+                Stopwatch stopwatch = Stopwatch.StartNew();
+                source.Raise(new LinuxUevent("add", "input", "input/event9", null));
+                if (!observer.WaitFor(state => state.Message == trackpad.AccessError, 2000))
+                {
+                    failure = $"Hotplug runtime ({readMode}) did not re-resolve the trackpad after its add uevent.";
+                    return false;
+                }
 
-        KeymapStore keymap = KeymapStore.LoadBundledDefault();
-        string rightStorageKey = GridKeyPosition.StorageKey(TrackpadSide.Right, 0, 2);
-        keymap.Mappings[0][rightStorageKey] = new KeyMapping
+                if (stopwatch.ElapsedMilliseconds >= 1000)
+                {
+                    failure = $"Hotplug runtime ({readMode}) took {stopwatch.ElapsedMilliseconds} ms to react to an add uevent.";
+                    return false;
+                }
+            }
+            finally
+            {
+                cts.Cancel();
+                run.Wait(5000);
+            }
+
+            if (!source.Disposed)
+            {
+                failure = $"Hotplug runtime ({readMode}) did not dispose its uevent source on shutdown.";
+                return false;
+            }
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    // Never openable, so the runtime reports its AccessError instead of touching a device node.
+    private static LinuxInputDeviceDescriptor CreateFakeTrackpad(string stableId)
+    {
+        return new LinuxInputDeviceDescriptor(
+            DeviceNode: "/dev/input/event-selftest",
+            StableId: stableId,
+            UniqueId: string.Empty,
+            PhysicalPath: string.Empty,
+            DisplayName: "Selftest Magic Trackpad",
+            VendorId: 0x05ac,
+            ProductId: 0x0265,
+            SupportsMultitouch: true,
+            SupportsPressure: true,
+            SupportsButtonClick: true,
+            IsPreferredInterface: true,
+            CanOpenEventStream: false,
+            AccessError: "selftest: trackpad reappeared");
+    }
+
+    private static string MutateWord(string word, int edits, Random random)
+    {
+        StringBuilder builder = new(word);
+        for (int edit = 0; edit < edits; edit++)
         {
-            Primary = new KeyAction { Label = "a" },
-            Hold = null
-        };
+            int position = random.Next(builder.Length + 1);
+            char letter = (char)('a' + random.Next(26));
+            switch (random.Next(4))
+            {
+                case 0 when builder.Length > 1 && position < builder.Length:
+                    builder.Remove(position, 1);
+                    break;
+                case 1 when position < builder.Length:
+                    builder[position] = letter;
+                    break;
+                case 2 when position + 1 < builder.Length:
+                    (builder[position], builder[position + 1]) = (builder[position + 1], builder[position]);
+                    break;
+                default:
+                    builder.Insert(position, letter);
+                    break;
+            }
+        }
 
-        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(keymap);
-        core.Configure(core.CurrentConfig with
+        return builder.ToString();
+    }
+
+    // A blocked SymSpell lookup must not hold up key output; the correction lands afterwards
+    // and retypes the boundary and the letters typed in the meantime.
+    private static bool ValidateDeferredAutocorrectDispatch(out string failure)
+    {
+        string outputPath = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}.uinput");
+        using ManualResetEventSlim lookupGate = new(false);
+        try
         {
-            ThreeFingerHoldAction = "Shift",
-            FourFingerHoldAction = "None"
-        });
+            FakeAutocorrectLexicon lexicon = new(("teh", "the")) { LookupGate = lookupGate };
+            AutocorrectSession session = new(lexicon);
+            session.Configure(new AutocorrectOptions(
+                MaxEditDistance: 2,
+                DryRunEnabled: false,
+                BlacklistCsv: string.Empty,
+                OverridesCsv: string.Empty));
+            LinuxUinputDevice device = new(File.OpenHandle(outputPath, FileMode.Create, FileAccess.ReadWrite));
+            using (LinuxUinputDispatcher dispatcher = new(device, DispatchRepeatProfile.Default, session))
+            {
+                dispatcher.SetAutocorrectEnabled(true);
+                DispatchTaps(dispatcher, 0x54, 0x45, 0x48, 0x20, 0x58);
+                if (!session.HasDeferredLookup || device.EventsWritten != 10)
+                {
+                    failure = $"Deferred autocorrect expected 5 key downs written while the lookup is blocked, got {device.EventsWritten} events (deferred={session.HasDeferredLookup}).";
+                    return false;
+                }
 
-        using DispatchEventQueue queue = new();
-        using TouchProcessorActor actor = new(core, dispatchQueue: queue);
+                lookupGate.Set();
+                Stopwatch wait = Stopwatch.StartNew();
+                while (dispatcher.GetAutocorrectStatus().CorrectedCount == 0 && wait.ElapsedMilliseconds < 2000)
+                {
+                    Thread.Sleep(1);
+                    dispatcher.Tick(Stopwatch.GetTimestamp());
+                }
+            }
 
-        long now = 0;
-        InputFrame leftChordHold = MakeMultiContactFrame(
-            (60, 800, 900),
-            (61, 1200, 1100),
-            (62, 1600, 1300));
-        InputFrame leftChordHoldMoved = MakeMultiContactFrame(
-            (60, 1200, 900),
-            (61, 1600, 1100),
-            (62, 2000, 1300));
-        InputFrame rightKeyDown = MakeFrame(contactCount: 1, x: rightKeyX, y: rightKeyY);
-        InputFrame allUp = MakeFrame(contactCount: 0);
+            string typed = DecodeTypedText(File.ReadAllBytes(outputPath));
+            if (!string.Equals(typed, "the x", StringComparison.Ordinal))
+            {
+                failure = $"Deferred autocorrect produced '{typed}', expected 'the x'.";
+                return false;
+            }
 
-        actor.Post(TrackpadSide.Left, in leftChordHold, maxX, maxY, now);
-        now += MsToTicks(10);
-        actor.Post(TrackpadSide.Left, in leftChordHoldMoved, maxX, maxY, now);
-        now += MsToTicks(10);
-        actor.Post(TrackpadSide.Right, in rightKeyDown, maxX, maxY, now);
-        now += MsToTicks(10);
-        actor.Post(TrackpadSide.Right, in allUp, maxX, maxY, now);
+            // Blacklisting the word while its lookup is on the worker drops the stale answer,
+            // and the word is not corrected later through the cache either.
+            lookupGate.Reset();
+            session = new AutocorrectSession(lexicon);
+            session.Configure(new AutocorrectOptions(
+                MaxEditDistance: 2,
+                DryRunEnabled: false,
+                BlacklistCsv: string.Empty,
+                OverridesCsv: string.Empty));
+            device = new LinuxUinputDevice(File.OpenHandle(outputPath, FileMode.Create, FileAccess.ReadWrite));
+            using (LinuxUinputDispatcher dispatcher = new(device, DispatchRepeatProfile.Default, session))
+            {
+                dispatcher.SetAutocorrectEnabled(true);
+                DispatchTaps(dispatcher, 0x54, 0x45, 0x48, 0x20, 0x58);
+                if (!session.HasDeferredLookup)
+                {
+                    failure = "Deferred autocorrect did not defer the blocked lookup before the blacklist change.";
+                    return false;
+                }
 
-        now += MsToTicks(320);
-        actor.Post(TrackpadSide.Right, in allUp, maxX, maxY, now);
-        now += MsToTicks(10);
-        actor.Post(TrackpadSide.Right, in allUp, maxX, maxY, now);
-        actor.WaitForIdle();
+                session.Configure(new AutocorrectOptions(
+                    MaxEditDistance: 2,
+                    DryRunEnabled: false,
+                    BlacklistCsv: "teh",
+                    OverridesCsv: string.Empty));
+                lookupGate.Set();
+                Stopwatch wait = Stopwatch.StartNew();
+                while (wait.ElapsedMilliseconds < 100)
+                {
+                    Thread.Sleep(1);
+                    dispatcher.Tick(Stopwatch.GetTimestamp());
+                }
 
-        TouchProcessorSnapshot snapshot = actor.Snapshot();
-        bool sawShiftDown = false;
-        bool sawShiftedTap = false;
-        bool sawShiftUp = false;
-        int shiftDownCount = 0;
+                DispatchTaps(dispatcher, 0x20, 0x54, 0x45, 0x48, 0x20);
+            }
 
-        while (queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
+            typed = DecodeTypedText(File.ReadAllBytes(outputPath));
+            if (!string.Equals(typed, "teh x teh ", StringComparison.Ordinal))
+            {
+                failure = $"Deferred autocorrect after blacklisting produced '{typed}', expected 'teh x teh '.";
+                return false;
+            }
+
+            failure = string.Empty;
+            return true;
+        }
+        finally
         {
-            if (!sawShiftDown &&
-                dispatchEvent.Kind == DispatchEventKind.ModifierDown &&
-                dispatchEvent.VirtualKey == 0x10)
+            File.Delete(outputPath);
+        }
+    }
+
+    private static void DispatchTaps(LinuxUinputDispatcher dispatcher, params ushort[] virtualKeys)
+    {
+        foreach (ushort virtualKey in virtualKeys)
+        {
+            dispatcher.Dispatch(new DispatchEvent(
+                TimestampTicks: Stopwatch.GetTimestamp(),
+                Kind: DispatchEventKind.KeyTap,
+                VirtualKey: virtualKey,
+                MouseButton: DispatchMouseButton.None,
+                RepeatToken: 0,
+                Flags: DispatchEventFlags.None,
+                Side: TrackpadSide.Right,
+                DispatchLabel: "selftest"));
+        }
+    }
+
+    // Replays the key-down events of a uinput capture as text (letters, space, backspace).
+    private static string DecodeTypedText(byte[] events)
+    {
+        const int EventSize = 24;
+        System.Text.StringBuilder text = new();
+        for (int offset = 0; offset + EventSize <= events.Length; offset += EventSize)
+        {
+            ushort type = BinaryPrimitives.ReadUInt16LittleEndian(events.AsSpan(offset + 16, 2));
+            ushort code = BinaryPrimitives.ReadUInt16LittleEndian(events.AsSpan(offset + 18, 2));
+            int value = BinaryPrimitives.ReadInt32LittleEndian(events.AsSpan(offset + 20, 4));
+            if (type != LinuxEvdevCodes.EventKey || value != 1)
             {
-                sawShiftDown = true;
-                shiftDownCount++;
                 continue;
             }
 
-            if (dispatchEvent.Kind == DispatchEventKind.ModifierDown &&
-                dispatchEvent.VirtualKey == 0x10)
+            if (code == LinuxEvdevCodes.KeyBackspace)
             {
-                shiftDownCount++;
+                if (text.Length > 0)
+                {
+                    text.Length--;
+                }
+
+                continue;
             }
 
-            if (sawShiftDown &&
-                !sawShiftedTap &&
-                dispatchEvent.Kind == DispatchEventKind.KeyTap &&
-                dispatchEvent.VirtualKey == 0x41)
+            for (ushort virtualKey = 0x41; virtualKey <= 0x5A; virtualKey++)
             {
-                sawShiftedTap = true;
-                continue;
+                if (LinuxKeyCodeMapper.TryMapKey(virtualKey, out ushort letterCode) && letterCode == code)
+                {
+                    text.Append((char)('a' + (virtualKey - 0x41)));
+                    break;
+                }
             }
 
-            if (sawShiftDown &&
-                sawShiftedTap &&
-                dispatchEvent.Kind == DispatchEventKind.ModifierUp &&
-                dispatchEvent.VirtualKey == 0x10)
+            if (code == LinuxEvdevCodes.KeySpace)
             {
-                sawShiftUp = true;
-                break;
+                text.Append(' ');
             }
         }
 
-        if (!sawShiftDown || !sawShiftedTap || !sawShiftUp)
-        {
-            failure = "Linux chord-shift self-test did not observe the expected Shift down/key tap/up sequence.";
-            return false;
-        }
+        return text.ToString();
+    }
 
-        if (shiftDownCount != 1)
+    // A reader on its own mapping must never see a torn slot while the writer laps a small
+    // ring, the write path must not allocate, and the engine must publish what it processed.
+    private static bool ValidatePreviewChannel(out string failure)
+    {
+        const int frames = 200_000;
+        string path = Path.Combine(Path.GetTempPath(), $"glasstokey-selftest-{Guid.NewGuid():N}", "preview.shm");
+        string directory = Path.GetDirectoryName(path)!;
+        // A stale directory left readable by others must come back private to the user.
+        Directory.CreateDirectory(directory);
+        if (OperatingSystem.IsLinux())
         {
-            failure = $"Linux chord-shift self-test saw an unexpected number of Shift-down events ({shiftDownCount}).";
-            return false;
+            File.SetUnixFileMode(
+                directory,
+                UnixFileMode.UserRead | UnixFileMode.UserWrite | UnixFileMode.UserExecute |
+                UnixFileMode.GroupRead | UnixFileMode.GroupExecute | UnixFileMode.OtherRead | UnixFileMode.OtherExecute);
         }
 
-        if (snapshot.ChordShiftRight)
+        using (PreviewChannelWriter writer = PreviewChannelWriter.Create(path, slotCount: 4))
         {
-            failure = "Linux chord-shift self-test left the right-side chord shift latched after stale-source timeout.";
-            return false;
-        }
+            if (OperatingSystem.IsLinux())
+            {
+                UnixFileMode directoryMode = File.GetUnixFileMode(directory);
+                UnixFileMode fileMode = File.GetUnixFileMode(path);
+                if (directoryMode != (UnixFileMode.UserRead | UnixFileMode.UserWrite | UnixFileMode.UserExecute) ||
+                    fileMode != (UnixFileMode.UserRead | UnixFileMode.UserWrite))
+                {
+                    failure = $"Preview channel is not private to the user: directory {directoryMode}, file {fileMode}.";
+                    return false;
+                }
+            }
 
-        failure = string.Empty;
-        return true;
-    }
+            if (!PreviewChannelReader.TryOpen(path, out PreviewChannelReader? reader))
+            {
+                failure = "Preview channel reader could not open the writer's file.";
+                return false;
+            }
 
-    private static bool ValidateLinuxHeldModifierSequencing(out string failure)
-    {
-        const ushort maxX = 7612;
-        const ushort maxY = 5065;
+            using (reader)
+            {
+                long allocated = -1;
+                Thread writerThread = new(() =>
+                {
+                    PreviewChannelFrame frame = default;
+                    for (int index = 0; index < frames; index++)
+                    {
+                        if (index == 1000)
+                        {
+                            allocated = GC.GetAllocatedBytesForCurrentThread();
+                        }
 
-        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
-        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
-        KeyLayout leftLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: true);
+                        FillPreviewChannelTestFrame(ref frame, writer.Sequence + 1);
+                        writer.Publish(ref frame);
+                    }
 
-        KeymapStore keymap = KeymapStore.LoadBundledDefault();
-        string shiftStorageKey = GridKeyPosition.StorageKey(TrackpadSide.Left, 0, 2);
-        string tapStorageKey = GridKeyPosition.StorageKey(TrackpadSide.Left, 0, 3);
-        keymap.Mappings[0][shiftStorageKey] = new KeyMapping
+                    allocated = GC.GetAllocatedBytesForCurrentThread() - allocated;
+                })
+                {
+                    IsBackground = true,
+                    Name = "GlassToKey.SelfTest.PreviewWriter"
+                };
+
+                int reads = 0;
+                long lastSequence = 0;
+                writerThread.Start();
+                while (writerThread.IsAlive || reads == 0)
+                {
+                    if (!reader!.TryReadLatest(out PreviewChannelFrame frame))
+                    {
+                        continue;
+                    }
+
+                    PreviewChannelFrame expected = default;
+                    FillPreviewChannelTestFrame(ref expected, frame.Sequence);
+                    expected.Sequence = frame.Sequence;
+                    if (!frame.Equals(expected))
+                    {
+                        failure = $"Preview channel reader saw a torn frame at sequence {frame.Sequence}.";
+                        return false;
+                    }
+
+                    if (frame.Sequence < lastSequence)
+                    {
+                        failure = $"Preview channel latest frame went backwards ({lastSequence} -> {frame.Sequence}).";
+                        return false;
+                    }
+
+                    lastSequence = frame.Sequence;
+                    reads++;
+                }
+
+                writerThread.Join();
+                if (allocated != 0)
+                {
+                    failure = $"Preview channel writer allocated {allocated} bytes over {frames - 1000} frames.";
+                    return false;
+                }
+
+                if (reader!.LatestSequence != frames || !reader.TryReadLatest(out PreviewChannelFrame last) || last.Sequence != frames)
+                {
+                    failure = $"Preview channel reader did not see the final frame (latest={reader.LatestSequence}).";
+                    return false;
+                }
+
+                if (reader.TryRead(1, out _))
+                {
+                    failure = "Preview channel returned a frame the ring had already overwritten.";
+                    return false;
+                }
+            }
+        }
+
+        if (File.Exists(path))
         {
-            Primary = new KeyAction { Label = "Shift" },
-            Hold = null
+            failure = "Preview channel writer left its file behind after Dispose.";
+            return false;
+        }
+
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        UserSettings settings = new()
+        {
+            LayoutPresetName = preset.Name,
+            ActiveLayer = 1,
+            TypingEnabled = true
         };
-        keymap.Mappings[0][tapStorageKey] = new KeyMapping
+        settings.NormalizeRanges();
+        using (PreviewChannelWriter writer = PreviewChannelWriter.Create(path))
+        {
+            using RecordingDispatcher dispatcher = new();
+            using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings, previewChannel: writer);
+            host.Post(new TrackpadFrameEnvelope(
+                TrackpadSide.Left,
+                MakeFrame(contactCount: 1, x: 1234, y: 2345, pressure: 64),
+                7612,
+                5065,
+                Stopwatch.Frequency));
+            host.TryGetSynchronizedSnapshot(timeoutMs: 500, out _);
+            if (!PreviewChannelReader.TryOpen(path, out PreviewChannelReader? reader) ||
+                !reader!.TryReadLatest(out PreviewChannelFrame frame))
+            {
+                failure = "Engine did not publish a processed frame to the preview channel.";
+                return false;
+            }
+
+            using (reader)
+            {
+                PreviewChannelContact contact = frame.GetContact(0);
+                if (frame.TrackpadSide != TrackpadSide.Left ||
+                    frame.ContactCount != 1 ||
+                    contact.X != 1234 ||
+                    contact.Y != 2345 ||
+                    !contact.TipSwitch ||
+                    frame.ActiveLayer != settings.ActiveLayer ||
+                    !frame.TypingEnabled ||
+                    frame.FramesProcessed != 1)
+                {
+                    failure = $"Engine preview frame did not match the posted frame (side={frame.TrackpadSide}, contacts={frame.ContactCount}, x={contact.X}, layer={frame.ActiveLayer}, processed={frame.FramesProcessed}).";
+                    return false;
+                }
+            }
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    // Every field is a function of the sequence, so any mix of two writes is detectable.
+    private static void FillPreviewChannelTestFrame(ref PreviewChannelFrame frame, long sequence)
+    {
+        int count = (int)(sequence % (InputFrame.MaxContacts + 1));
+        frame.TimestampTicks = sequence * 7;
+        frame.FramesProcessed = sequence * 3;
+        frame.MaxX = (ushort)sequence;
+        frame.MaxY = (ushort)(sequence >> 16);
+        frame.Side = (byte)(sequence & 1);
+        frame.ContactCount = (byte)count;
+        frame.IntentMode = (byte)(sequence % 6);
+        frame.ActiveLayer = (byte)(sequence % 8);
+        frame.StateFlags = (byte)(sequence & 0x07);
+        for (int index = 0; index < InputFrame.MaxContacts; index++)
+        {
+            frame.SetContact(index, new PreviewChannelContact
+            {
+                Id = (uint)(sequence + index),
+                X = (ushort)((sequence * 3) + index),
+                Y = (ushort)((sequence * 5) + index),
+                Pressure = (byte)(sequence + index),
+                Flags = (byte)(index < count ? 0x03 : 0)
+            });
+        }
+    }
+
+    private static bool ValidatePipelineLatency(out string failure)
+    {
+        long previousBound = -1;
+        for (long value = 0; value < 1L << 20; value = (value * 9 / 8) + 1)
+        {
+            int bucket = LatencyHistogram.ResolveBucket(value);
+            long upper = LatencyHistogram.BucketUpperBound(bucket);
+            if (upper < value || upper - value > Math.Max(1, value / 16) || upper < previousBound)
+            {
+                failure = $"Latency histogram bucket {bucket} for {value} ns has upper bound {upper}.";
+                return false;
+            }
+
+            previousBound = upper;
+        }
+
+        LatencyHistogram histogram = new();
+        for (long microseconds = 1; microseconds <= 1000; microseconds++)
+        {
+            histogram.RecordNanoseconds(microseconds * 1000);
+        }
+
+        LatencyHistogramSnapshot summary = histogram.Snapshot();
+        if (summary.Count != 1000 ||
+            summary.MaxNanoseconds != 1_000_000 ||
+            Math.Abs(summary.P50Us - 500) > 500 / 16.0 ||
+            Math.Abs(summary.P99Us - 990) > 990 / 16.0 ||
+            summary.P999Nanoseconds > summary.MaxNanoseconds)
+        {
+            failure = $"Latency histogram percentiles were off (count={summary.Count}, p50={summary.P50Us}us, p99={summary.P99Us}us, max={summary.MaxUs}us).";
+            return false;
+        }
+
+        // Present-day epoch microseconds overflow a long once scaled by a 1 GHz Stopwatch.
+        long nowMicroseconds = LinuxEvdevReader.GetEventClockMicroseconds();
+        long nowTicks = LinuxEvdevReader.MicrosecondsToTicks(nowMicroseconds);
+        PipelineTimestamps stamped = LinuxEvdevReader.StampCommit(nowMicroseconds - 2000);
+        long stampedAgeUs = (stamped.CommitTicks - stamped.KernelTicks) * 1_000_000 / Stopwatch.Frequency;
+        if (nowTicks != (long)((Int128)nowMicroseconds * Stopwatch.Frequency / 1_000_000) ||
+            stampedAgeUs < 2000 ||
+            stampedAgeUs > 1_002_000)
+        {
+            failure = $"Event clock conversion overflowed ({nowMicroseconds}us -> {nowTicks} ticks, 2 ms event aged {stampedAgeUs}us at commit).";
+            return false;
+        }
+
+        using RecordingDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(
+            dispatcher,
+            KeymapStore.LoadBundledDefault(),
+            TrackpadLayoutPreset.SixByThree,
+            new UserSettings());
+        const int frames = 8;
+        for (int index = 0; index < frames; index++)
+        {
+            long commitTicks = Stopwatch.GetTimestamp();
+            host.Post(new TrackpadFrameEnvelope(
+                TrackpadSide.Right,
+                MakeFrame(contactCount: index % 2 == 0 ? 1 : 0, x: 1200, y: 1200, pressure: 64),
+                7612,
+                5065,
+                commitTicks,
+                new PipelineTimestamps(commitTicks - (Stopwatch.Frequency / 1000), commitTicks)));
+        }
+
+        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 250, out _))
+        {
+            failure = "Pipeline latency test could not synchronize with the engine actor.";
+            return false;
+        }
+
+        PipelineLatencySnapshot latency = host.GetPipelineLatency();
+        LatencyHistogramSnapshot kernel = latency[PipelineLatencyStage.KernelToReader];
+        if (kernel.Count != frames ||
+            latency[PipelineLatencyStage.EngineQueue].Count != frames ||
+            latency[PipelineLatencyStage.EngineProcess].Count != frames ||
+            Math.Abs(kernel.P50Us - 1000) > 1000 / 16.0)
+        {
+            failure = $"Pipeline latency did not record every frame stage (kernel={kernel.Count}/{kernel.P50Us}us, queue={latency[PipelineLatencyStage.EngineQueue].Count}, process={latency[PipelineLatencyStage.EngineProcess].Count}).";
+            return false;
+        }
+
+        LinuxRuntimeStatsSnapshot stats = LinuxRuntimeStatsSnapshot.FromPipelineLatency(latency);
+        if (stats.Stages.Count != PipelineLatencyRecorder.StageCount ||
+            stats.Stages[(int)PipelineLatencyStage.KernelToReader].Count != frames ||
+            !string.Equals(stats.Stages[(int)PipelineLatencyStage.EndToEnd].Stage, nameof(PipelineLatencyStage.EndToEnd), StringComparison.Ordinal))
+        {
+            failure = "Runtime stats snapshot did not carry the pipeline latency stages.";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateEngineEventSource(out string failure)
+    {
+        try
+        {
+            EventSource.GenerateManifest(typeof(EngineEventSource), string.Empty, EventManifestOptions.Strict);
+        }
+        catch (ArgumentException ex)
+        {
+            failure = $"Engine event source manifest is invalid: {ex.Message}";
+            return false;
+        }
+
+        using EngineEventRecorder listener = new();
+        using RecordingDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(
+            dispatcher,
+            KeymapStore.LoadBundledDefault(),
+            TrackpadLayoutPreset.SixByThree,
+            new UserSettings());
+        long now = Stopwatch.Frequency;
+        host.Post(new TrackpadFrameEnvelope(TrackpadSide.Right, MakeFrame(contactCount: 1, x: 1200, y: 1200, pressure: 64), 7612, 5065, now));
+        now += Stopwatch.Frequency / 50;
+        host.Post(new TrackpadFrameEnvelope(TrackpadSide.Right, MakeFrame(contactCount: 0), 7612, 5065, now));
+        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 250, out _))
+        {
+            failure = "Engine event source test could not synchronize with the engine actor.";
+            return false;
+        }
+
+        EventWrittenEventArgs[] events = listener.Snapshot();
+        EventWrittenEventArgs? begin = Array.Find(events, e => e.EventId == EngineEventSource.TouchBeginEventId);
+        EventWrittenEventArgs? end = Array.Find(events, e => e.EventId == EngineEventSource.TouchEndEventId);
+        int frames = Array.FindAll(events, e => e.EventId == EngineEventSource.FrameProcessedEventId).Length;
+        if (frames != 2 || begin == null || end == null)
+        {
+            failure = $"Engine event source did not report the frame and touch lifecycle (frames={frames}, begin={begin != null}, end={end != null}).";
+            return false;
+        }
+
+        if (begin.Payload is not { Count: 3 } ||
+            (int)begin.Payload[0]! != (int)TrackpadSide.Right ||
+            end.Payload is not { Count: 4 } ||
+            (bool)end.Payload[2]! ||
+            (long)end.Payload[3]! <= 0)
+        {
+            failure = "Engine event source touch payloads did not decode to the posted contact.";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    // A session collecting only warnings must still receive queue drops.
+    private static bool ValidateEngineQueueDropEvent(out string failure)
+    {
+        using EngineEventRecorder listener = new(EventLevel.Warning);
+        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(KeymapStore.LoadBundledDefault());
+        core.RecordQueueDrop();
+        core.RecordDispatchDrop();
+
+        EventWrittenEventArgs[] events = listener.Snapshot();
+        EventWrittenEventArgs[] drops = Array.FindAll(events, e => e.EventId == EngineEventSource.QueueDropEventId);
+        if (drops.Length != 2 ||
+            drops[0].Payload is not { Count: 1 } ||
+            (int)drops[0].Payload![0]! != 0 ||
+            (int)drops[1].Payload![0]! != 1)
+        {
+            failure = $"Engine event source did not report queue drops to a Warning-level session (drops={drops.Length}).";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateSyntheticTouchStream(out string failure)
+    {
+        foreach (SyntheticTouchPattern pattern in Enum.GetValues<SyntheticTouchPattern>())
+        {
+            SyntheticTouchStreamOptions options = new(ReportRateHz: 1000, MaxContacts: 5, Pattern: pattern, Seed: 5);
+            SyntheticTouchStream first = new(options);
+            SyntheticTouchStream second = new(options);
+            int maxContacts = 0;
+            long previousTimestamp = -1;
+            for (int index = 0; index < 8000; index++)
+            {
+                SyntheticTouchFrame a = first.Next();
+                SyntheticTouchFrame b = second.Next();
+                if (a != b)
+                {
+                    failure = $"Synthetic touch stream ({pattern}) was not deterministic at frame {index}.";
+                    return false;
+                }
+
+                TrackpadSide expectedSide = (index & 1) == 0 ? TrackpadSide.Left : TrackpadSide.Right;
+                if (a.Side != expectedSide || a.TimestampTicks < previousTimestamp || a.Frame.ContactCount > options.MaxContacts)
+                {
+                    failure = $"Synthetic touch stream ({pattern}) produced an invalid frame at {index} (side={a.Side}, contacts={a.Frame.ContactCount}).";
+                    return false;
+                }
+
+                for (int contact = 1; contact < a.Frame.ContactCount; contact++)
+                {
+                    if (a.Frame.GetContact(contact).Id == a.Frame.GetContact(contact - 1).Id)
+                    {
+                        failure = $"Synthetic touch stream ({pattern}) repeated a contact id within frame {index}.";
+                        return false;
+                    }
+                }
+
+                previousTimestamp = a.TimestampTicks;
+                maxContacts = Math.Max(maxContacts, a.Frame.ContactCount);
+            }
+
+            // Swipes go up to five fingers, so Swipe and Mixed must reach MaxContacts.
+            int expectedMax = pattern switch
+            {
+                SyntheticTouchPattern.Typing or SyntheticTouchPattern.Hold => 2,
+                SyntheticTouchPattern.ChordShift => 4,
+                _ => options.MaxContacts
+            };
+            if (maxContacts < expectedMax)
+            {
+                failure = $"Synthetic touch stream ({pattern}) never reached {expectedMax} contacts (max={maxContacts}).";
+                return false;
+            }
+        }
+
+        LinuxStressResult stress = LinuxStressRunner.Run(
+            new LinuxStressOptions(0.25, new SyntheticTouchStreamOptions(ReportRateHz: 250), Paced: true),
+            KeymapStore.LoadBundledDefault(),
+            TrackpadLayoutPreset.SixByThree,
+            new UserSettings());
+        if (stress.FramesPosted == 0 || stress.FramesProcessed + stress.QueueDrops != stress.FramesPosted)
+        {
+            failure = $"Stress run lost track of frames (posted={stress.FramesPosted}, processed={stress.FramesProcessed}, drops={stress.QueueDrops}).";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateBundledSettingsDefaults(out string failure)
+    {
+        failure = string.Empty;
+
+        string path = Path.Combine(AppContext.BaseDirectory, "GLASSTOKEY_DEFAULT_KEYMAP.json");
+        if (!File.Exists(path))
+        {
+            failure = $"Bundled Linux keymap is missing: {path}";
+            return false;
+        }
+
+        try
+        {
+            using JsonDocument document = JsonDocument.Parse(File.ReadAllText(path));
+            if (!TryGetPropertyIgnoreCase(document.RootElement, "settings", out JsonElement settingsElement) ||
+                settingsElement.ValueKind != JsonValueKind.Object)
+            {
+                failure = "Bundled Linux defaults are missing the settings payload.";
+                return false;
+            }
+
+            UserSettings? expected = JsonSerializer.Deserialize<UserSettings>(
+                settingsElement.GetRawText(),
+                new JsonSerializerOptions { PropertyNameCaseInsensitive = true });
+            if (expected == null)
+            {
+                failure = "Bundled Linux settings payload did not deserialize.";
+                return false;
+            }
+
+            expected.NormalizeRanges();
+
+            UserSettings actual = UserSettings.LoadBundledDefaultsOrDefault();
+            if (!string.Equals(actual.TwoFingerHoldAction, expected.TwoFingerHoldAction, StringComparison.Ordinal) ||
+                !string.Equals(actual.ThreeFingerHoldAction, expected.ThreeFingerHoldAction, StringComparison.Ordinal))
+            {
+                failure = "Bundled Linux settings did not load expected gesture defaults from the settings payload.";
+                return false;
+            }
+
+            if (actual.ForceMin != expected.ForceMin || actual.ForceCap != expected.ForceCap)
+            {
+                failure = "Bundled Linux settings did not load expected force thresholds from the settings payload.";
+                return false;
+            }
+
+            if (actual.ThreeFingerDragEnabled != expected.ThreeFingerDragEnabled)
+            {
+                failure = "Bundled Linux settings did not load the expected 3-finger drag toggle from the settings payload.";
+                return false;
+            }
+
+            if (!string.Equals(actual.LayoutPresetName, expected.LayoutPresetName, StringComparison.OrdinalIgnoreCase))
+            {
+                failure = "Bundled Linux settings did not load the expected layout preset from the settings payload.";
+                return false;
+            }
+
+            return true;
+        }
+        catch (Exception ex)
+        {
+            failure = $"Bundled Linux settings validation failed: {ex.Message}";
+            return false;
+        }
+    }
+
+    private static bool ValidateConfiguredRuntimeStartupState(out string failure)
+    {
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        UserSettings settings = new()
+        {
+            LayoutPresetName = preset.Name,
+            ActiveLayer = 2,
+            TypingEnabled = false,
+            KeyboardModeEnabled = true
+        };
+        settings.NormalizeRanges();
+
+        using RecordingDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
+        if (!host.TryGetSnapshot(out TouchProcessorRuntimeSnapshot snapshot))
+        {
+            failure = "Configured runtime host did not produce an initial snapshot.";
+            return false;
+        }
+
+        if (snapshot.ActiveLayer != settings.ActiveLayer ||
+            snapshot.TypingEnabled != settings.TypingEnabled ||
+            snapshot.KeyboardModeEnabled != settings.KeyboardModeEnabled)
+        {
+            failure = $"Configured runtime host did not restore startup mode state (layer={snapshot.ActiveLayer}, typing={snapshot.TypingEnabled}, keyboard={snapshot.KeyboardModeEnabled}).";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateConfiguredMouseTakeoverStartupState(out string failure)
+    {
+        const ushort maxX = 7612;
+        const ushort maxY = 5065;
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
+        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
+        NormalizedRect keyRect = rightLayout.Rects[0][0];
+        ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
+        ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
+        ushort offKeyX = (ushort)Math.Clamp(maxX - 64, 1, maxX - 1);
+        ushort offKeyY = (ushort)Math.Clamp(maxY - 64, 1, maxY - 1);
+
+        UserSettings settings = new()
+        {
+            LayoutPresetName = preset.Name,
+            TypingEnabled = true,
+            KeyboardModeEnabled = false,
+            KeyBufferMs = 1.0,
+            IntentMoveMm = 1.0,
+            DragCancelMm = 1.0
+        };
+        settings.NormalizeRanges();
+
+        using RecordingDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
+
+        long now = Stopwatch.Frequency / 100;
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 200);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+
+        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out TouchProcessorRuntimeSnapshot snapshot))
+        {
+            failure = "Configured runtime host did not produce a synchronized snapshot for mouse takeover validation.";
+            return false;
+        }
+
+        if (!string.Equals(snapshot.IntentMode, "MouseActive", StringComparison.Ordinal))
+        {
+            failure = $"Configured runtime host did not restore mouse takeover on startup (intent={snapshot.IntentMode}).";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateGestureRecognizerPipeline(out string failure)
+    {
+        const ushort maxX = 7612;
+        const ushort maxY = 5065;
+
+        // The bundled defaults only bind the five-finger swipe; chord-shift holds are not
+        // hold recognizers.
+        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(KeymapStore.LoadBundledDefault());
+        if (core.Snapshot().EnabledGestureRecognizers != GestureRecognizers.FiveFingerSwipe)
+        {
+            failure = $"Default gesture pipeline was {core.Snapshot().EnabledGestureRecognizers}, expected FiveFingerSwipe.";
+            return false;
+        }
+
+        core.Configure(core.CurrentConfig with
+        {
+            TwoFingerHoldAction = "A",
+            TopLeftTriangleAction = "B",
+            HoldRepeatEnabled = true
+        });
+        GestureRecognizers expected = GestureRecognizers.FiveFingerSwipe | GestureRecognizers.TwoFingerHold | GestureRecognizers.Triangle;
+        if (core.Snapshot().EnabledGestureRecognizers != expected)
+        {
+            failure = $"Configured gesture pipeline was {core.Snapshot().EnabledGestureRecognizers}, expected {expected}.";
+            return false;
+        }
+
+        // A held repeating gesture must be released when Configure drops its recognizer,
+        // since the recognizer no longer sees the frames that would end it. The release is
+        // drained with the next frame, like other engine events raised outside ProcessFrame.
+        using DispatchEventQueue queue = new();
+        using (TouchProcessorActor actor = new(core, dispatchQueue: queue))
+        {
+            InputFrame twoFingers = MakeMultiContactFrame((70, 2600, 2500), (71, 3400, 2500));
+            long now = 0;
+            for (int frame = 0; frame < 40; frame++)
+            {
+                actor.Post(TrackpadSide.Left, in twoFingers, maxX, maxY, now);
+                now += MsToTicks(10);
+            }
+
+            actor.WaitForIdle();
+            actor.Configure(core.CurrentConfig with { TwoFingerHoldAction = "None" });
+            InputFrame allUp = MakeFrame(contactCount: 0);
+            actor.Post(TrackpadSide.Left, in allUp, maxX, maxY, now);
+            actor.WaitForIdle();
+        }
+
+        ulong heldToken = 0;
+        bool released = false;
+        while (queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
+        {
+            if (dispatchEvent.Kind == DispatchEventKind.KeyDown && dispatchEvent.RepeatToken != 0)
+            {
+                heldToken = dispatchEvent.RepeatToken;
+            }
+            else if (dispatchEvent.Kind == DispatchEventKind.KeyUp && heldToken != 0 && dispatchEvent.RepeatToken == heldToken)
+            {
+                released = true;
+            }
+        }
+
+        if (heldToken == 0 || !released)
+        {
+            failure = $"Disabling a held two-finger hold gesture did not release it (held={heldToken != 0}, released={released}).";
+            return false;
+        }
+
+        if (core.Snapshot().EnabledGestureRecognizers != (GestureRecognizers.FiveFingerSwipe | GestureRecognizers.Triangle))
+        {
+            failure = $"Gesture pipeline after disabling the two-finger hold was {core.Snapshot().EnabledGestureRecognizers}.";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateLinuxChordShiftDispatchSequence(out string failure)
+    {
+        const ushort maxX = 7612;
+        const ushort maxY = 5065;
+
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
+        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
+        NormalizedRect rightKeyRect = rightLayout.Rects[0][2];
+        ushort rightKeyX = (ushort)Math.Clamp((int)Math.Round((rightKeyRect.X + (rightKeyRect.Width * 0.5)) * maxX), 1, maxX - 1);
+        ushort rightKeyY = (ushort)Math.Clamp((int)Math.Round((rightKeyRect.Y + (rightKeyRect.Height * 0.5)) * maxY), 1, maxY - 1);
+
+        KeymapStore keymap = KeymapStore.LoadBundledDefault();
+        string rightStorageKey = GridKeyPosition.StorageKey(TrackpadSide.Right, 0, 2);
+        keymap.Mappings[0][rightStorageKey] = new KeyMapping
+        {
+            Primary = new KeyAction { Label = "a" },
+            Hold = null
+        };
+
+        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(keymap);
+        core.Configure(core.CurrentConfig with
+        {
+            ThreeFingerHoldAction = "Shift",
+            FourFingerHoldAction = "None"
+        });
+
+        using DispatchEventQueue queue = new();
+        using TouchProcessorActor actor = new(core, dispatchQueue: queue);
+
+        long now = 0;
+        InputFrame leftChordHold = MakeMultiContactFrame(
+            (60, 800, 900),
+            (61, 1200, 1100),
+            (62, 1600, 1300));
+        InputFrame leftChordHoldMoved = MakeMultiContactFrame(
+            (60, 1200, 900),
+            (61, 1600, 1100),
+            (62, 2000, 1300));
+        InputFrame rightKeyDown = MakeFrame(contactCount: 1, x: rightKeyX, y: rightKeyY);
+        InputFrame allUp = MakeFrame(contactCount: 0);
+
+        actor.Post(TrackpadSide.Left, in leftChordHold, maxX, maxY, now);
+        now += MsToTicks(10);
+        actor.Post(TrackpadSide.Left, in leftChordHoldMoved, maxX, maxY, now);
+        now += MsToTicks(10);
+        actor.Post(TrackpadSide.Right, in rightKeyDown, maxX, maxY, now);
+        now += MsToTicks(10);
+        actor.Post(TrackpadSide.Right, in allUp, maxX, maxY, now);
+
+        now += MsToTicks(320);
+        actor.Post(TrackpadSide.Right, in allUp, maxX, maxY, now);
+        now += MsToTicks(10);
+        actor.Post(TrackpadSide.Right, in allUp, maxX, maxY, now);
+        actor.WaitForIdle();
+
+        TouchProcessorSnapshot snapshot = actor.Snapshot();
+        bool sawShiftDown = false;
+        bool sawShiftedTap = false;
+        bool sawShiftUp = false;
+        int shiftDownCount = 0;
+
+        while (queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
+        {
+            if (!sawShiftDown &&
+                dispatchEvent.Kind == DispatchEventKind.ModifierDown &&
+                dispatchEvent.VirtualKey == 0x10)
+            {
+                sawShiftDown = true;
+                shiftDownCount++;
+                continue;
+            }
+
+            if (dispatchEvent.Kind == DispatchEventKind.ModifierDown &&
+                dispatchEvent.VirtualKey == 0x10)
+            {
+                shiftDownCount++;
+            }
+
+            if (sawShiftDown &&
+                !sawShiftedTap &&
+                dispatchEvent.Kind == DispatchEventKind.KeyTap &&
+                dispatchEvent.VirtualKey == 0x41)
+            {
+                sawShiftedTap = true;
+                continue;
+            }
+
+            if (sawShiftDown &&
+                sawShiftedTap &&
+                dispatchEvent.Kind == DispatchEventKind.ModifierUp &&
+                dispatchEvent.VirtualKey == 0x10)
+            {
+                sawShiftUp = true;
+                break;
+            }
+        }
+
+        if (!sawShiftDown || !sawShiftedTap || !sawShiftUp)
+        {
+            failure = "Linux chord-shift self-test did not observe the expected Shift down/key tap/up sequence.";
+            return false;
+        }
+
+        if (shiftDownCount != 1)
+        {
+            failure = $"Linux chord-shift self-test saw an unexpected number of Shift-down events ({shiftDownCount}).";
+            return false;
+        }
+
+        if (snapshot.ChordShiftRight)
+        {
+            failure = "Linux chord-shift self-test left the right-side chord shift latched after stale-source timeout.";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateLinuxHeldModifierSequencing(out string failure)
+    {
+        const ushort maxX = 7612;
+        const ushort maxY = 5065;
+
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
+        KeyLayout leftLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: true);
+
+        KeymapStore keymap = KeymapStore.LoadBundledDefault();
+        string shiftStorageKey = GridKeyPosition.StorageKey(TrackpadSide.Left, 0, 2);
+        string tapStorageKey = GridKeyPosition.StorageKey(TrackpadSide.Left, 0, 3);
+        keymap.Mappings[0][shiftStorageKey] = new KeyMapping
+        {
+            Primary = new KeyAction { Label = "Shift" },
+            Hold = null
+        };
+        keymap.Mappings[0][tapStorageKey] = new KeyMapping
+        {
+            Primary = new KeyAction { Label = "A" },
+            Hold = null
+        };
+
+        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(keymap);
+        using DispatchEventQueue queue = new();
+        using TouchProcessorActor actor = new(core, dispatchQueue: queue);
+
+        NormalizedRect shiftRect = leftLayout.Rects[0][2];
+        NormalizedRect tapRect = leftLayout.Rects[0][3];
+        ushort shiftX = (ushort)Math.Clamp((int)Math.Round((shiftRect.X + (shiftRect.Width * 0.5)) * maxX), 1, maxX - 1);
+        ushort shiftY = (ushort)Math.Clamp((int)Math.Round((shiftRect.Y + (shiftRect.Height * 0.5)) * maxY), 1, maxY - 1);
+        ushort tapX = (ushort)Math.Clamp((int)Math.Round((tapRect.X + (tapRect.Width * 0.5)) * maxX), 1, maxX - 1);
+        ushort tapY = (ushort)Math.Clamp((int)Math.Round((tapRect.Y + (tapRect.Height * 0.5)) * maxY), 1, maxY - 1);
+        ushort shiftDriftX = (ushort)Math.Clamp(shiftX + 500, 1, maxX - 1);
+
+        long now = 0;
+        InputFrame heldShiftDown = MakeMultiContactFrame((53, shiftX, shiftY));
+        InputFrame heldShiftDrift = MakeMultiContactFrame((53, shiftDriftX, shiftY));
+        InputFrame tap1Down = MakeMultiContactFrame((53, shiftDriftX, shiftY), (54, tapX, tapY));
+        InputFrame tap1Up = MakeMultiContactFrame((53, shiftDriftX, shiftY));
+        InputFrame tap2Down = MakeMultiContactFrame((53, shiftDriftX, shiftY), (55, tapX, tapY));
+        InputFrame tap2Up = MakeMultiContactFrame((53, shiftDriftX, shiftY));
+        InputFrame allUp = MakeFrame(contactCount: 0);
+
+        actor.Post(TrackpadSide.Left, in heldShiftDown, maxX, maxY, now);
+        now += MsToTicks(8);
+        actor.Post(TrackpadSide.Left, in heldShiftDrift, maxX, maxY, now);
+        now += MsToTicks(8);
+        actor.Post(TrackpadSide.Left, in tap1Down, maxX, maxY, now);
+        now += MsToTicks(8);
+        actor.Post(TrackpadSide.Left, in tap1Up, maxX, maxY, now);
+        now += MsToTicks(8);
+        actor.Post(TrackpadSide.Left, in tap2Down, maxX, maxY, now);
+        now += MsToTicks(8);
+        actor.Post(TrackpadSide.Left, in tap2Up, maxX, maxY, now);
+        now += MsToTicks(8);
+        actor.Post(TrackpadSide.Left, in allUp, maxX, maxY, now);
+        actor.WaitForIdle();
+
+        int eventIndex = 0;
+        int shiftDownIndex = -1;
+        int shiftUpIndex = -1;
+        int firstTapIndex = -1;
+        int lastTapIndex = -1;
+        int tapCount = 0;
+        bool earlyShiftUp = false;
+        List<string> events = [];
+
+        while (queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
+        {
+            events.Add($"{dispatchEvent.Kind}:0x{dispatchEvent.VirtualKey:X2}:{dispatchEvent.DispatchLabel}");
+            if (dispatchEvent.Kind == DispatchEventKind.ModifierDown &&
+                dispatchEvent.VirtualKey == 0x10 &&
+                shiftDownIndex < 0)
+            {
+                shiftDownIndex = eventIndex;
+            }
+            else if (dispatchEvent.Kind == DispatchEventKind.ModifierUp &&
+                     dispatchEvent.VirtualKey == 0x10)
+            {
+                if (tapCount < 2)
+                {
+                    earlyShiftUp = true;
+                }
+
+                if (shiftUpIndex < 0)
+                {
+                    shiftUpIndex = eventIndex;
+                }
+            }
+            else if (dispatchEvent.Kind == DispatchEventKind.KeyTap &&
+                     dispatchEvent.VirtualKey == 0x41)
+            {
+                if (firstTapIndex < 0)
+                {
+                    firstTapIndex = eventIndex;
+                }
+
+                lastTapIndex = eventIndex;
+                tapCount++;
+            }
+
+            eventIndex++;
+        }
+
+        if (shiftDownIndex < 0 ||
+            shiftUpIndex < 0 ||
+            tapCount != 2 ||
+            firstTapIndex < 0 ||
+            lastTapIndex < 0 ||
+            shiftDownIndex > firstTapIndex ||
+            shiftUpIndex < lastTapIndex ||
+            earlyShiftUp)
+        {
+            failure = $"Linux held-modifier sequencing mismatch (downIdx={shiftDownIndex}, upIdx={shiftUpIndex}, firstTap={firstTapIndex}, lastTap={lastTapIndex}, tapCount={tapCount}, earlyUp={earlyShiftUp}, events=[{string.Join(", ", events)}]).";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateThreeFingerDragReleaseClearsLatchedContacts(out string failure)
+    {
+        const ushort maxX = 7612;
+        const ushort maxY = 5065;
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
+        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
+        NormalizedRect keyRect = rightLayout.Rects[0][0];
+        ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
+        ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
+        UserSettings settings = new()
+        {
+            LayoutPresetName = preset.Name,
+            TypingEnabled = true,
+            ThreeFingerDragEnabled = true
+        };
+        settings.NormalizeRanges();
+
+        using RecordingDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
+
+        long now = Stopwatch.Frequency / 50;
+
+        now += Math.Max(1, Stopwatch.Frequency / 200);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeThreeFingerFrame(
+                (1000, 1200),
+                (1800, 1500),
+                (2600, 1800)),
+            maxX,
+            maxY,
+            now));
+
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeThreeFingerFrame(
+                (1200, 1200),
+                (2000, 1500),
+                (2800, 1800)),
+            maxX,
+            maxY,
+            now));
+
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+
+        now += Math.Max(1, Stopwatch.Frequency / 200);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 0),
+            maxX,
+            maxY,
+            now));
+
+        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out TouchProcessorRuntimeSnapshot snapshot))
+        {
+            failure = "Three-finger drag release regression test could not read a synchronized runtime snapshot.";
+            return false;
+        }
+
+        if (dispatcher.LeftButtonDownCount != 1 || dispatcher.LeftButtonUpCount != 1)
+        {
+            failure = $"Three-finger drag release regression test saw an unexpected button sequence (down={dispatcher.LeftButtonDownCount}, up={dispatcher.LeftButtonUpCount}).";
+            return false;
+        }
+
+        if (dispatcher.Snapshot().Length != 0)
+        {
+            failure = "Residual fingers after three-finger drag should not leak key or mouse dispatch before all-up.";
+            return false;
+        }
+
+        if (snapshot.ContactCount != 0 || !string.Equals(snapshot.IntentMode, "Idle", StringComparison.Ordinal))
+        {
+            failure = $"Three-finger drag release did not clear the latched engine contact state (contacts={snapshot.ContactCount}, intent={snapshot.IntentMode}).";
+            return false;
+        }
+
+        now += Math.Max(1, Stopwatch.Frequency / 8);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+
+        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out snapshot))
+        {
+            failure = "Three-finger drag release regression test could not read a follow-up runtime snapshot.";
+            return false;
+        }
+
+        if (!string.Equals(snapshot.IntentMode, "MouseCandidate", StringComparison.Ordinal))
+        {
+            failure = $"Three-finger drag release should bias the next touch sequence back to mouse (intent={snapshot.IntentMode}).";
+            return false;
+        }
+
+        if (dispatcher.Snapshot().Length != 0)
+        {
+            failure = "Three-finger drag release pointer grace should not emit dispatch on the first follow-up contact.";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateHeadlessPureKeyboardPolicy(out string failure)
+    {
+        UserSettings profile = new()
+        {
+            KeyboardModeEnabled = false,
+            TypingEnabled = false,
+            ThreeFingerDragEnabled = true
+        };
+
+        UserSettings effective = LinuxRuntimePolicy.HeadlessPureKeyboard.ApplyToProfile(profile);
+        if (!effective.KeyboardModeEnabled || !effective.TypingEnabled || effective.ThreeFingerDragEnabled)
+        {
+            failure = $"HeadlessPureKeyboard policy did not force the expected runtime flags (typing={effective.TypingEnabled}, keyboard={effective.KeyboardModeEnabled}, drag={effective.ThreeFingerDragEnabled}).";
+            return false;
+        }
+
+        if (LinuxRuntimePolicy.DesktopInteractive.IgnoresTypingToggleActions() ||
+            !LinuxRuntimePolicy.HeadlessPureKeyboard.IgnoresTypingToggleActions())
+        {
+            failure = "Linux runtime typing-toggle policy flags are inconsistent.";
+            return false;
+        }
+
+        if (LinuxRuntimePolicy.DesktopInteractive.UsesPureKeyboardIntent() ||
+            !LinuxRuntimePolicy.HeadlessPureKeyboard.UsesPureKeyboardIntent())
+        {
+            failure = "Linux runtime pure-keyboard intent policy flags are inconsistent.";
+            return false;
+        }
+
+        if (!LinuxRuntimePolicy.HeadlessPureKeyboard.AllowsAutomaticBindingSelection(hasSavedBindings: false) ||
+            LinuxRuntimePolicy.HeadlessPureKeyboard.AllowsAutomaticBindingSelection(hasSavedBindings: true) ||
+            LinuxRuntimePolicy.DesktopInteractive.AllowsAutomaticBindingSelection(hasSavedBindings: false))
+        {
+            failure = "Linux runtime auto-binding policy flags are inconsistent.";
+            return false;
+        }
+
+        if (LinuxRuntimePolicy.HeadlessPureKeyboard.ResolveExclusiveGrabMode(disableExclusiveGrab: false, graphicalSession: true) != LinuxExclusiveGrabMode.Always ||
+            LinuxRuntimePolicy.HeadlessPureKeyboard.ResolveExclusiveGrabMode(disableExclusiveGrab: false, graphicalSession: false) != LinuxExclusiveGrabMode.Never ||
+            LinuxRuntimePolicy.HeadlessPureKeyboard.ResolveExclusiveGrabMode(disableExclusiveGrab: true, graphicalSession: true) != LinuxExclusiveGrabMode.Never ||
+            LinuxRuntimePolicy.DesktopInteractive.ResolveExclusiveGrabMode(disableExclusiveGrab: false, graphicalSession: true) != LinuxExclusiveGrabMode.DynamicKeyboardMode)
+        {
+            failure = "Linux runtime exclusive-grab policy flags are inconsistent.";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidatePureKeyboardIntentSuppressesMouseTakeover(out string failure)
+    {
+        const ushort maxX = 7612;
+        const ushort maxY = 5065;
+        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
+        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
+        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
+        NormalizedRect keyRect = rightLayout.Rects[0][0];
+        ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
+        ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
+        ushort offKeyX = (ushort)Math.Clamp(maxX - 64, 1, maxX - 1);
+        ushort offKeyY = (ushort)Math.Clamp(maxY - 64, 1, maxY - 1);
+
+        UserSettings settings = new()
+        {
+            LayoutPresetName = preset.Name,
+            TypingEnabled = true,
+            KeyboardModeEnabled = false,
+            KeyBufferMs = 1.0,
+            IntentMoveMm = 1.0,
+            DragCancelMm = 1.0
+        };
+        settings.NormalizeRanges();
+
+        using RecordingDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(
+            dispatcher,
+            KeymapStore.LoadBundledDefault(),
+            preset,
+            settings,
+            pureKeyboardIntent: true);
+
+        long now = Stopwatch.Frequency / 100;
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 200);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+        now += Math.Max(1, Stopwatch.Frequency / 20);
+        host.Post(new TrackpadFrameEnvelope(
+            TrackpadSide.Right,
+            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
+            maxX,
+            maxY,
+            now));
+
+        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out TouchProcessorRuntimeSnapshot snapshot))
+        {
+            failure = "Pure-keyboard runtime host did not produce a synchronized snapshot for mouse suppression validation.";
+            return false;
+        }
+
+        if (string.Equals(snapshot.IntentMode, "MouseCandidate", StringComparison.Ordinal) ||
+            string.Equals(snapshot.IntentMode, "MouseActive", StringComparison.Ordinal))
+        {
+            failure = $"Pure-keyboard runtime host still entered mouse intent (intent={snapshot.IntentMode}).";
+            return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool ValidateLinuxBundleRoundTripPreservesTrackpadBindings(out string failure)
+    {
+        string? originalConfigHome = Environment.GetEnvironmentVariable("XDG_CONFIG_HOME");
+        string tempRoot = Path.Combine(Path.GetTempPath(), $"glasstokey-selftest-{Guid.NewGuid():N}");
+
+        try
+        {
+            Directory.CreateDirectory(tempRoot);
+            Environment.SetEnvironmentVariable("XDG_CONFIG_HOME", tempRoot);
+
+            LinuxAppRuntime runtime = new();
+            LinuxHostSettings settings = runtime.LoadSettings();
+            settings.LeftTrackpadStableId = "left-stable-id";
+            settings.RightTrackpadStableId = "right-stable-id";
+            runtime.SaveSettings(settings);
+
+            string bundlePath = Path.Combine(tempRoot, "bundle.json");
+            if (!runtime.TryExportProfile(bundlePath, out string exportMessage))
+            {
+                failure = $"Linux bundle export failed during self-test: {exportMessage}";
+                return false;
+            }
+
+            LinuxHostSettings clearedSettings = runtime.LoadSettings();
+            clearedSettings.LeftTrackpadStableId = null;
+            clearedSettings.RightTrackpadStableId = null;
+            runtime.SaveSettings(clearedSettings);
+
+            if (!runtime.TryImportProfile(bundlePath, out string importMessage))
+            {
+                failure = $"Linux bundle import failed during self-test: {importMessage}";
+                return false;
+            }
+
+            LinuxHostSettings imported = runtime.LoadSettings();
+            if (!string.Equals(imported.LeftTrackpadStableId, "left-stable-id", StringComparison.Ordinal) ||
+                !string.Equals(imported.RightTrackpadStableId, "right-stable-id", StringComparison.Ordinal))
+            {
+                failure = $"Linux bundle round-trip did not preserve trackpad bindings (left='{imported.LeftTrackpadStableId}', right='{imported.RightTrackpadStableId}').";
+                return false;
+            }
+
+            failure = string.Empty;
+            return true;
+        }
+        catch (Exception ex)
+        {
+            failure = $"Linux bundle round-trip self-test failed: {ex.Message}";
+            return false;
+        }
+        finally
+        {
+            Environment.SetEnvironmentVariable("XDG_CONFIG_HOME", originalConfigHome);
+            try
+            {
+                if (Directory.Exists(tempRoot))
+                {
+                    Directory.Delete(tempRoot, recursive: true);
+                }
+            }
+            catch
+            {
+                // Best-effort cleanup only.
+            }
+        }
+    }
+
+    private static bool ValidateResolvedAction(string label, EngineKeyAction action, out string failure)
+    {
+        if (action.Kind == EngineActionKind.None)
+        {
+            if (!string.Equals(label, "None", StringComparison.OrdinalIgnoreCase))
+            {
+                failure = $"Label '{label}' resolved to None.";
+                return false;
+            }
+
+            failure = string.Empty;
+            return true;
+        }
+
+        switch (action.Kind)
+        {
+            case EngineActionKind.Key:
+            case EngineActionKind.Continuous:
+            case EngineActionKind.Modifier:
+                if (!CanResolveLinuxKey(action.SemanticAction.PrimaryCode, action.VirtualKey))
+                {
+                    failure = $"Label '{label}' did not resolve to a Linux key code.";
+                    return false;
+                }
+
+                break;
+            case EngineActionKind.KeyChord:
+                if (!CanResolveLinuxKey(action.SemanticAction.PrimaryCode, action.VirtualKey))
+                {
+                    failure = $"Chord '{label}' did not resolve its primary Linux key code.";
+                    return false;
+                }
+
+                if (!CanResolveChordModifiers(action))
+                {
+                    failure = $"Chord '{label}' did not resolve its modifier Linux key code.";
+                    return false;
+                }
+
+                break;
+            case EngineActionKind.MouseButton:
+                if (!LinuxKeyCodeMapper.TryMapMouseButton(action.MouseButton, out _))
+                {
+                    failure = $"Mouse label '{label}' did not resolve to a Linux button.";
+                    return false;
+                }
+
+                break;
+            case EngineActionKind.MomentaryLayer:
+            case EngineActionKind.LayerSet:
+            case EngineActionKind.LayerToggle:
+            case EngineActionKind.TypingToggle:
+                break;
+            default:
+                failure = $"Label '{label}' resolved unexpected action kind '{action.Kind}'.";
+                return false;
+        }
+
+        failure = string.Empty;
+        return true;
+    }
+
+    private static bool CanResolveChordModifiers(EngineKeyAction action)
+    {
+        if (action.SemanticAction.Modifiers != DispatchModifierFlags.None)
+        {
+            Span<DispatchSemanticCode> modifierCodes = stackalloc DispatchSemanticCode[12];
+            int count = DispatchShortcutHelper.CopyModifierSemanticCodes(action.SemanticAction.Modifiers, modifierCodes);
+            int limit = Math.Min(count, modifierCodes.Length);
+            for (int index = 0; index < limit; index++)
+            {
+                if (!CanResolveLinuxKey(modifierCodes[index], 0))
+                {
+                    return false;
+                }
+            }
+
+            return limit > 0;
+        }
+
+        return CanResolveLinuxKey(action.SemanticAction.SecondaryCode, action.ModifierVirtualKey);
+    }
+
+    private sealed class FakeTrackpadBackend : ILinuxTrackpadBackend
+    {
+        private int _enumerationCount;
+
+        public volatile IReadOnlyList<LinuxInputDeviceDescriptor> Devices = [];
+
+        public int EnumerationCount => Volatile.Read(ref _enumerationCount);
+
+        public IReadOnlyList<LinuxInputDeviceDescriptor> EnumerateDevices()
+        {
+            Interlocked.Increment(ref _enumerationCount);
+            return Devices;
+        }
+    }
+
+    private sealed class FakeUeventSource : ILinuxUeventSource
+    {
+        private Action<LinuxUevent>? _onUevent;
+
+        public bool Disposed { get; private set; }
+
+        public void Start(Action<LinuxUevent> onUevent)
+        {
+            _onUevent = onUevent;
+        }
+
+        public void Raise(LinuxUevent uevent)
+        {
+            _onUevent?.Invoke(uevent);
+        }
+
+        public void Dispose()
+        {
+            Disposed = true;
+        }
+    }
+
+    private sealed class RecordingRuntimeObserver : ILinuxRuntimeObserver
+    {
+        private readonly List<LinuxRuntimeBindingState> _states = new();
+
+        public void OnBindingStateChanged(LinuxRuntimeBindingState state)
+        {
+            lock (_states)
+            {
+                _states.Add(state);
+                Monitor.PulseAll(_states);
+            }
+        }
+
+        public bool WaitFor(Func<LinuxRuntimeBindingState, bool> predicate, int timeoutMs)
+        {
+            long deadline = Environment.TickCount64 + timeoutMs;
+            lock (_states)
+            {
+                while (!_states.Any(predicate))
+                {
+                    int remaining = (int)(deadline - Environment.TickCount64);
+                    if (remaining <= 0 || !Monitor.Wait(_states, remaining))
+                    {
+                        return _states.Any(predicate);
+                    }
+                }
+
+                return true;
+            }
+        }
+    }
+
+    private sealed class NullFrameSink : ILinuxInputFrameSink
+    {
+        public ValueTask OnFrameAsync(LinuxRuntimeFrame frame, CancellationToken cancellationToken)
+        {
+            return ValueTask.CompletedTask;
+        }
+    }
+
+    private sealed class FakeAutocorrectLexicon : AutocorrectSession.IAutocorrectLexicon
+    {
+        private readonly Dictionary<string, string> _corrections;
+
+        public FakeAutocorrectLexicon(params (string Typed, string Corrected)[] pairs)
+        {
+            _corrections = new Dictionary<string, string>(StringComparer.Ordinal);
+            for (int index = 0; index < pairs.Length; index++)
+            {
+                (string typed, string corrected) = pairs[index];
+                _corrections[typed] = corrected;
+            }
+        }
+
+        // When set, lookups block until the gate opens, like a slow SymSpell query.
+        public ManualResetEventSlim? LookupGate { get; init; }
+
+        public bool IsLoaded => true;
+
+        public bool IsLoading => false;
+
+        public void BeginLoad()
+        {
+        }
+
+        public bool EnsureLoaded()
+        {
+            return true;
+        }
+
+        public string? ResolveCorrection(ReadOnlySpan<char> typedLower, int maxEditDistance)
+        {
+            _ = maxEditDistance;
+            LookupGate?.Wait();
+            return _corrections.TryGetValue(typedLower.ToString(), out string? corrected)
+                ? corrected
+                : null;
+        }
+
+        public void Unload()
+        {
+        }
+    }
+
+    private static bool ValidateCaptureWriterDropsWhenDiskStalls(out string failure)
+    {
+        const int FrameCount = 2_000;
+        string capturePath = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}.atpcap");
+        try
+        {
+            LinuxInputDeviceDescriptor device = new(
+                DeviceNode: "/dev/input/event-selftest",
+                StableId: "selftest-stall",
+                UniqueId: "selftest-stall",
+                PhysicalPath: "selftest-phys",
+                DisplayName: "SelfTest Trackpad",
+                VendorId: 0x05ac,
+                ProductId: 0x0324,
+                SupportsMultitouch: true,
+                SupportsPressure: true,
+                SupportsButtonClick: true,
+                IsPreferredInterface: true,
+                CanOpenEventStream: true,
+                AccessError: "ok");
+            LinuxTrackpadBinding binding = new(TrackpadSide.Right, device);
+            LinuxAtpCapCaptureOptions options = new()
+            {
+                RingCapacityBytes = 4096,
+                FlushThresholdBytes = 1024,
+                FsyncPolicy = LinuxAtpCapFsyncPolicy.None
+            };
+
+            long written;
+            long dropped;
+            long frameTicks;
+            using (StallingStream stream = new(File.Create(capturePath)))
+            {
+                LinuxAtpCapCaptureWriter writer = new(stream, capturePath, options);
+                stream.Stall();
+                long startTicks = Stopwatch.GetTimestamp();
+                for (int index = 0; index < FrameCount; index++)
+                {
+                    InputFrame frame = new()
+                    {
+                        ArrivalQpcTicks = startTicks + index,
+                        ReportId = 0xEE,
+                        ScanTime = (ushort)index,
+                        ContactCount = 1
+                    };
+                    frame.SetContact(0, new ContactFrame(1, (ushort)(index % 7000), 800, 0x03, Pressure: 32, Phase: 0, HasForceData: false));
+                    writer.WriteFrame(new LinuxRuntimeFrame(
+                        binding,
+                        new LinuxEvdevFrameSnapshot(
+                            DeviceNode: device.DeviceNode,
+                            MinX: 0,
+                            MinY: 0,
+                            MaxX: 7612,
+                            MaxY: 5065,
+                            FrameSequence: index + 1,
+                            Frame: frame)));
+                }
+
+                // The frame path must never wait on the stalled disk.
+                frameTicks = Stopwatch.GetTimestamp() - startTicks;
+                stream.Resume();
+                writer.Dispose();
+                written = writer.RecordsWritten;
+                dropped = writer.RecordsDropped;
+            }
+
+            if (dropped == 0 || written + dropped != FrameCount + 1)
+            {
+                failure = $"Capture writer expected drops under a stalled disk with written+dropped={FrameCount + 1}, got written={written}, dropped={dropped}.";
+                return false;
+            }
+
+            if (frameTicks > Stopwatch.Frequency)
+            {
+                failure = $"Capture writer blocked the frame path for {frameTicks * 1000.0 / Stopwatch.Frequency:F0} ms while the disk was stalled.";
+                return false;
+            }
+
+            using InputCaptureReader reader = new(capturePath);
+            if (reader.RecordCount != written)
+            {
+                failure = $"Capture writer reported {written} written records but the file holds {reader.RecordCount}.";
+                return false;
+            }
+
+            long lastSequence = 0;
+            while (reader.TryReadNext(out CaptureRecord record))
+            {
+                if (record.DeviceIndex < 0)
+                {
+                    continue;
+                }
+
+                long sequence = (long)BinaryPrimitives.ReadUInt64LittleEndian(record.Payload.Span.Slice(4, 8));
+                if (sequence <= lastSequence)
+                {
+                    failure = $"Capture writer emitted frame {sequence} after {lastSequence}; dropped records must not reorder the file.";
+                    return false;
+                }
+
+                lastSequence = sequence;
+            }
+
+            failure = string.Empty;
+            return true;
+        }
+        finally
         {
-            Primary = new KeyAction { Label = "A" },
-            Hold = null
-        };
+            File.Delete(capturePath);
+        }
+    }
 
-        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(keymap);
-        using DispatchEventQueue queue = new();
-        using TouchProcessorActor actor = new(core, dispatchQueue: queue);
+    // Blocks writes while stalled, like a disk that stops accepting data for a while.
+    private sealed class StallingStream(Stream inner) : Stream
+    {
+        private readonly ManualResetEventSlim _open = new(true);
 
-        NormalizedRect shiftRect = leftLayout.Rects[0][2];
-        NormalizedRect tapRect = leftLayout.Rects[0][3];
-        ushort shiftX = (ushort)Math.Clamp((int)Math.Round((shiftRect.X + (shiftRect.Width * 0.5)) * maxX), 1, maxX - 1);
-        ushort shiftY = (ushort)Math.Clamp((int)Math.Round((shiftRect.Y + (shiftRect.Height * 0.5)) * maxY), 1, maxY - 1);
-        ushort tapX = (ushort)Math.Clamp((int)Math.Round((tapRect.X + (tapRect.Width * 0.5)) * maxX), 1, maxX - 1);
-        ushort tapY = (ushort)Math.Clamp((int)Math.Round((tapRect.Y + (tapRect.Height * 0.5)) * maxY), 1, maxY - 1);
-        ushort shiftDriftX = (ushort)Math.Clamp(shiftX + 500, 1, maxX - 1);
+        public override bool CanRead => false;
+        public override bool CanSeek => false;
+        public override bool CanWrite => true;
+        public override long Length => inner.Length;
+        public override long Position { get => inner.Position; set => throw new NotSupportedException(); }
 
-        long now = 0;
-        InputFrame heldShiftDown = MakeMultiContactFrame((53, shiftX, shiftY));
-        InputFrame heldShiftDrift = MakeMultiContactFrame((53, shiftDriftX, shiftY));
-        InputFrame tap1Down = MakeMultiContactFrame((53, shiftDriftX, shiftY), (54, tapX, tapY));
-        InputFrame tap1Up = MakeMultiContactFrame((53, shiftDriftX, shiftY));
-        InputFrame tap2Down = MakeMultiContactFrame((53, shiftDriftX, shiftY), (55, tapX, tapY));
-        InputFrame tap2Up = MakeMultiContactFrame((53, shiftDriftX, shiftY));
-        InputFrame allUp = MakeFrame(contactCount: 0);
+        public void Stall() => _open.Reset();
 
-        actor.Post(TrackpadSide.Left, in heldShiftDown, maxX, maxY, now);
-        now += MsToTicks(8);
-        actor.Post(TrackpadSide.Left, in heldShiftDrift, maxX, maxY, now);
-        now += MsToTicks(8);
-        actor.Post(TrackpadSide.Left, in tap1Down, maxX, maxY, now);
-        now += MsToTicks(8);
-        actor.Post(TrackpadSide.Left, in tap1Up, maxX, maxY, now);
-        now += MsToTicks(8);
-        actor.Post(TrackpadSide.Left, in tap2Down, maxX, maxY, now);
-        now += MsToTicks(8);
-        actor.Post(TrackpadSide.Left, in tap2Up, maxX, maxY, now);
-        now += MsToTicks(8);
-        actor.Post(TrackpadSide.Left, in allUp, maxX, maxY, now);
-        actor.WaitForIdle();
+        public void Resume() => _open.Set();
 
-        int eventIndex = 0;
-        int shiftDownIndex = -1;
-        int shiftUpIndex = -1;
-        int firstTapIndex = -1;
-        int lastTapIndex = -1;
-        int tapCount = 0;
-        bool earlyShiftUp = false;
-        List<string> events = [];
+        public override void Write(byte[] buffer, int offset, int count)
+        {
+            _open.Wait();
+            inner.Write(buffer, offset, count);
+        }
 
-        while (queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
+        public override void Flush() => inner.Flush();
+        public override int Read(byte[] buffer, int offset, int count) => throw new NotSupportedException();
+        public override long Seek(long offset, SeekOrigin origin) => throw new NotSupportedException();
+        public override void SetLength(long value) => throw new NotSupportedException();
+
+        protected override void Dispose(bool disposing)
         {
-            events.Add($"{dispatchEvent.Kind}:0x{dispatchEvent.VirtualKey:X2}:{dispatchEvent.DispatchLabel}");
-            if (dispatchEvent.Kind == DispatchEventKind.ModifierDown &&
-                dispatchEvent.VirtualKey == 0x10 &&
-                shiftDownIndex < 0)
+            if (disposing)
             {
-                shiftDownIndex = eventIndex;
+                inner.Dispose();
+                _open.Dispose();
             }
-            else if (dispatchEvent.Kind == DispatchEventKind.ModifierUp &&
-                     dispatchEvent.VirtualKey == 0x10)
+
+            base.Dispose(disposing);
+        }
+    }
+
+    private static bool ValidateCaptureReaderRecordIndex(out string failure)
+    {
+        const int RecordCount = 300;
+        string capturePath = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}.atpcap");
+        try
+        {
+            using (FileStream stream = File.Create(capturePath))
             {
-                if (tapCount < 2)
+                InputCaptureFile.WriteHeader(stream, InputCaptureFile.Version3, 1_000_000);
+                Span<byte> header = stackalloc byte[InputCaptureFile.RecordHeaderSize];
+                for (int index = 0; index < RecordCount; index++)
                 {
-                    earlyShiftUp = true;
+                    byte[] payload = new byte[1 + (index % 23)];
+                    payload.AsSpan().Fill((byte)index);
+                    header.Clear();
+                    BinaryPrimitives.WriteInt32LittleEndian(header.Slice(0, 4), payload.Length);
+                    BinaryPrimitives.WriteInt64LittleEndian(header.Slice(4, 8), 1000L * index);
+                    BinaryPrimitives.WriteInt32LittleEndian(header.Slice(12, 4), index % 2);
+                    stream.Write(header);
+                    stream.Write(payload);
                 }
 
-                if (shiftUpIndex < 0)
+                // A record cut off mid-payload, as left by a capture that is still being written.
+                header.Clear();
+                BinaryPrimitives.WriteInt32LittleEndian(header.Slice(0, 4), 64);
+                stream.Write(header);
+                stream.Write(new byte[8]);
+            }
+
+            using InputCaptureReader reader = new(capturePath);
+            if (!reader.IsMemoryMapped || reader.RecordCount != RecordCount)
+            {
+                failure = $"Capture reader index expected {RecordCount} mapped records, got {reader.RecordCount} (mapped={reader.IsMemoryMapped}).";
+                return false;
+            }
+
+            if (!reader.TryReadRecord(10, out CaptureRecord tenth) ||
+                !reader.TryReadNext(out CaptureRecord eleventh) ||
+                !Unsafe.AreSame(
+                    ref Unsafe.AsRef(in tenth.Payload.Span[0]),
+                    ref Unsafe.Subtract(ref Unsafe.AsRef(in eleventh.Payload.Span[0]), InputCaptureFile.RecordHeaderSize + tenth.Payload.Length)))
+            {
+                failure = "Capture reader payloads are not slices of the mapped file.";
+                return false;
+            }
+
+            for (int step = 0; step < RecordCount; step++)
+            {
+                int index = (step * 137) % RecordCount;
+                if (!reader.TryReadRecord(index, out CaptureRecord record) ||
+                    record.ArrivalQpcTicks != 1000L * index ||
+                    record.DeviceIndex != index % 2 ||
+                    record.Payload.Length != 1 + (index % 23) ||
+                    record.Payload.Span[^1] != (byte)index ||
+                    reader.NextRecordIndex != index + 1)
                 {
-                    shiftUpIndex = eventIndex;
+                    failure = $"Capture reader seek to record {index} returned the wrong record.";
+                    return false;
                 }
             }
-            else if (dispatchEvent.Kind == DispatchEventKind.KeyTap &&
-                     dispatchEvent.VirtualKey == 0x41)
+
+            if (!reader.TrySeekToRecord(RecordCount - 1) || !reader.TryReadNext(out _))
             {
-                if (firstTapIndex < 0)
+                failure = "Capture reader could not read the last complete record after seeking.";
+                return false;
+            }
+
+            try
+            {
+                reader.TryReadNext(out _);
+                failure = "Capture reader did not report the truncated trailing record.";
+                return false;
+            }
+            catch (InvalidDataException)
+            {
+            }
+
+            failure = string.Empty;
+            return true;
+        }
+        finally
+        {
+            File.Delete(capturePath);
+        }
+    }
+
+    private static bool ValidateAtpCapRoundTrip(out string failure)
+    {
+        string tempRoot = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}");
+        string capturePath = Path.Combine(tempRoot, "synthetic.atpcap");
+        string fixturePath = Path.Combine(tempRoot, "synthetic.fixture.json");
+        string tracePath = Path.Combine(tempRoot, "synthetic-trace.json");
+
+        try
+        {
+            Directory.CreateDirectory(tempRoot);
+            LinuxInputDeviceDescriptor device = new(
+                DeviceNode: "/dev/input/event-selftest",
+                StableId: "selftest-left",
+                UniqueId: "selftest-left",
+                PhysicalPath: "selftest-phys",
+                DisplayName: "SelfTest Trackpad",
+                VendorId: 0x05ac,
+                ProductId: 0x0324,
+                SupportsMultitouch: true,
+                SupportsPressure: true,
+                SupportsButtonClick: true,
+                IsPreferredInterface: true,
+                CanOpenEventStream: true,
+                AccessError: "ok");
+            LinuxTrackpadBinding binding = new(TrackpadSide.Left, device);
+
+            using (LinuxAtpCapCaptureWriter writer = new(capturePath))
+            {
+                InputFrame baseline = new()
                 {
-                    firstTapIndex = eventIndex;
-                }
+                    ArrivalQpcTicks = 1_000,
+                    ReportId = 0xEE,
+                    ScanTime = 1,
+                    ContactCount = 0,
+                    IsButtonClicked = 0
+                };
+                writer.WriteFrame(new LinuxRuntimeFrame(
+                    binding,
+                    new LinuxEvdevFrameSnapshot(
+                        DeviceNode: device.DeviceNode,
+                        MinX: -3678,
+                        MinY: -2478,
+                        MaxX: 7612,
+                        MaxY: 5065,
+                        FrameSequence: 1,
+                        Frame: baseline)));
+
+                InputFrame active = new()
+                {
+                    ArrivalQpcTicks = 2_000,
+                    ReportId = 0xEE,
+                    ScanTime = 2,
+                    ContactCount = 1,
+                    IsButtonClicked = 1
+                };
+                active.SetContact(0, new ContactFrame(1, 1200, 800, 0x03, Pressure: 64, Phase: 0, HasForceData: false));
+                writer.WriteFrame(new LinuxRuntimeFrame(
+                    binding,
+                    new LinuxEvdevFrameSnapshot(
+                        DeviceNode: device.DeviceNode,
+                        MinX: -3678,
+                        MinY: -2478,
+                        MaxX: 7612,
+                        MaxY: 5065,
+                        FrameSequence: 2,
+                        Frame: active)));
+
+                InputFrame released = new()
+                {
+                    ArrivalQpcTicks = 3_000,
+                    ReportId = 0xEE,
+                    ScanTime = 3,
+                    ContactCount = 0,
+                    IsButtonClicked = 0
+                };
+                writer.WriteFrame(new LinuxRuntimeFrame(
+                    binding,
+                    new LinuxEvdevFrameSnapshot(
+                        DeviceNode: device.DeviceNode,
+                        MinX: -3678,
+                        MinY: -2478,
+                        MaxX: 7612,
+                        MaxY: 5065,
+                        FrameSequence: 3,
+                        Frame: released)));
+            }
+
+            LinuxAtpCapSummaryResult summary = LinuxAtpCapReplayRunner.Summarize(capturePath);
+            if (!summary.Success ||
+                !summary.Summary.Contains("frames=3", StringComparison.Ordinal) ||
+                !summary.Summary.Contains("buttonPressedFrames=1", StringComparison.Ordinal) ||
+                !summary.Summary.Contains("buttonDownEdges=1", StringComparison.Ordinal) ||
+                !summary.Summary.Contains("buttonUpEdges=1", StringComparison.Ordinal))
+            {
+                failure = $"Synthetic Linux .atpcap summary failed: {summary.Summary}";
+                return false;
+            }
+
+            LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+            LinuxAtpCapReplayResult replay = LinuxAtpCapReplayRunner.Replay(capturePath, configuration, tracePath);
+            if (!replay.Success)
+            {
+                failure = "Synthetic Linux .atpcap replay failed.";
+                return false;
+            }
+
+            if (replay.Metrics.FramesSeen < 4 || replay.Metrics.FramesParsed < 3 || replay.Metrics.FramesDispatched < 3)
+            {
+                failure = "Synthetic Linux .atpcap replay metrics were incomplete.";
+                return false;
+            }
+
+            if (replay.CaptureFingerprint == 0 || replay.DispatchFingerprint == 0)
+            {
+                failure = "Synthetic Linux .atpcap replay fingerprints were not populated.";
+                return false;
+            }
+
+            if (!File.Exists(tracePath))
+            {
+                failure = "Synthetic Linux replay trace was not created.";
+                return false;
+            }
+
+            LinuxAtpCapFixtureWriteResult fixtureWrite = LinuxAtpCapFixtureRunner.WriteFixture(capturePath, fixturePath, configuration);
+            if (!fixtureWrite.Success || !File.Exists(fixturePath))
+            {
+                failure = $"Synthetic Linux fixture generation failed: {fixtureWrite.Summary}";
+                return false;
+            }
 
-                lastTapIndex = eventIndex;
-                tapCount++;
+            LinuxAtpCapFixtureCheckResult fixtureCheck = LinuxAtpCapFixtureRunner.CheckFixture(capturePath, fixturePath, configuration, traceOutputPath: null);
+            if (!fixtureCheck.Success)
+            {
+                failure = $"Synthetic Linux fixture check failed: {fixtureCheck.Summary}";
+                return false;
             }
 
-            eventIndex++;
+            failure = string.Empty;
+            return true;
         }
-
-        if (shiftDownIndex < 0 ||
-            shiftUpIndex < 0 ||
-            tapCount != 2 ||
-            firstTapIndex < 0 ||
-            lastTapIndex < 0 ||
-            shiftDownIndex > firstTapIndex ||
-            shiftUpIndex < lastTapIndex ||
-            earlyShiftUp)
+        catch (Exception ex)
         {
-            failure = $"Linux held-modifier sequencing mismatch (downIdx={shiftDownIndex}, upIdx={shiftUpIndex}, firstTap={firstTapIndex}, lastTap={lastTapIndex}, tapCount={tapCount}, earlyUp={earlyShiftUp}, events=[{string.Join(", ", events)}]).";
+            failure = $"Synthetic Linux .atpcap round-trip failed: {ex.Message}";
             return false;
         }
+        finally
+        {
+            try
+            {
+                if (Directory.Exists(tempRoot))
+                {
+                    Directory.Delete(tempRoot, recursive: true);
+                }
+            }
+            catch
+            {
+            }
+        }
+    }
 
-        failure = string.Empty;
-        return true;
+    private static bool CanResolveLinuxKey(DispatchSemanticCode semanticCode, ushort virtualKey)
+    {
+        return (semanticCode != DispatchSemanticCode.None && LinuxKeyCodeMapper.TryMapSemanticCode(semanticCode, out _)) ||
+               (virtualKey != 0 && LinuxKeyCodeMapper.TryMapKey(virtualKey, out _));
     }
 
-    private static bool ValidateThreeFingerDragReleaseClearsLatchedContacts(out string failure)
+    private static bool ValidateLinuxForceThresholdDispatch(out string failure)
     {
         const ushort maxX = 7612;
         const ushort maxY = 5065;
@@ -791,104 +3003,52 @@ internal static class LinuxSelfTestRunner
         NormalizedRect keyRect = rightLayout.Rects[0][0];
         ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
         ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
+
         UserSettings settings = new()
         {
             LayoutPresetName = preset.Name,
-            TypingEnabled = true,
-            ThreeFingerDragEnabled = true
+            ForceMin = 200,
+            ForceCap = 255
         };
         settings.NormalizeRanges();
 
         using RecordingDispatcher dispatcher = new();
         using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
 
-        long now = Stopwatch.Frequency / 50;
-
-        now += Math.Max(1, Stopwatch.Frequency / 200);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeThreeFingerFrame(
-                (1000, 1200),
-                (1800, 1500),
-                (2600, 1800)),
-            maxX,
-            maxY,
-            now));
-
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeThreeFingerFrame(
-                (1200, 1200),
-                (2000, 1500),
-                (2800, 1800)),
-            maxX,
-            maxY,
-            now));
-
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-
-        now += Math.Max(1, Stopwatch.Frequency / 200);
+        long now = 0;
         host.Post(new TrackpadFrameEnvelope(
             TrackpadSide.Right,
-            MakeFrame(contactCount: 0),
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 32, hasForceData: true),
             maxX,
             maxY,
             now));
-
-        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out TouchProcessorRuntimeSnapshot snapshot))
-        {
-            failure = "Three-finger drag release regression test could not read a synchronized runtime snapshot.";
-            return false;
-        }
-
-        if (dispatcher.LeftButtonDownCount != 1 || dispatcher.LeftButtonUpCount != 1)
-        {
-            failure = $"Three-finger drag release regression test saw an unexpected button sequence (down={dispatcher.LeftButtonDownCount}, up={dispatcher.LeftButtonUpCount}).";
-            return false;
-        }
-
-        if (dispatcher.Snapshot().Length != 0)
-        {
-            failure = "Residual fingers after three-finger drag should not leak key or mouse dispatch before all-up.";
-            return false;
-        }
-
-        if (snapshot.ContactCount != 0 || !string.Equals(snapshot.IntentMode, "Idle", StringComparison.Ordinal))
+        now += 1;
+        host.Post(new TrackpadFrameEnvelope(TrackpadSide.Right, MakeFrame(contactCount: 0), maxX, maxY, now));
+        if (!dispatcher.WaitForDispatchCount(0, timeoutMs: 150))
         {
-            failure = $"Three-finger drag release did not clear the latched engine contact state (contacts={snapshot.ContactCount}, intent={snapshot.IntentMode}).";
+            failure = "Low-force key tap was not suppressed by shared Force Min/Max settings.";
             return false;
         }
 
-        now += Math.Max(1, Stopwatch.Frequency / 8);
+        now += 10;
         host.Post(new TrackpadFrameEnvelope(
             TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
+            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 240, hasForceData: true),
             maxX,
             maxY,
             now));
-
-        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out snapshot))
-        {
-            failure = "Three-finger drag release regression test could not read a follow-up runtime snapshot.";
-            return false;
-        }
-
-        if (!string.Equals(snapshot.IntentMode, "MouseCandidate", StringComparison.Ordinal))
+        now += 1;
+        host.Post(new TrackpadFrameEnvelope(TrackpadSide.Right, MakeFrame(contactCount: 0), maxX, maxY, now));
+        if (!dispatcher.WaitForDispatchCount(1, timeoutMs: 150))
         {
-            failure = $"Three-finger drag release should bias the next touch sequence back to mouse (intent={snapshot.IntentMode}).";
+            failure = "High-force key tap did not dispatch when inside the shared Force Min/Max window.";
             return false;
         }
 
-        if (dispatcher.Snapshot().Length != 0)
+        DispatchEvent[] events = dispatcher.Snapshot();
+        if (events.Length != 1 || events[0].Kind != DispatchEventKind.KeyTap)
         {
-            failure = "Three-finger drag release pointer grace should not emit dispatch on the first follow-up contact.";
+            failure = $"Unexpected dispatch sequence for force-threshold validation (events={events.Length}).";
             return false;
         }
 
@@ -896,50 +3056,30 @@ internal static class LinuxSelfTestRunner
         return true;
     }
 
-    private static bool ValidateHeadlessPureKeyboardPolicy(out string failure)
+    private static bool ValidateLinuxAssemblerForceData(out string failure)
     {
-        UserSettings profile = new()
-        {
-            KeyboardModeEnabled = false,
-            TypingEnabled = false,
-            ThreeFingerDragEnabled = true
-        };
-
-        UserSettings effective = LinuxRuntimePolicy.HeadlessPureKeyboard.ApplyToProfile(profile);
-        if (!effective.KeyboardModeEnabled || !effective.TypingEnabled || effective.ThreeFingerDragEnabled)
-        {
-            failure = $"HeadlessPureKeyboard policy did not force the expected runtime flags (typing={effective.TypingEnabled}, keyboard={effective.KeyboardModeEnabled}, drag={effective.ThreeFingerDragEnabled}).";
-            return false;
-        }
-
-        if (LinuxRuntimePolicy.DesktopInteractive.IgnoresTypingToggleActions() ||
-            !LinuxRuntimePolicy.HeadlessPureKeyboard.IgnoresTypingToggleActions())
-        {
-            failure = "Linux runtime typing-toggle policy flags are inconsistent.";
-            return false;
-        }
-
-        if (LinuxRuntimePolicy.DesktopInteractive.UsesPureKeyboardIntent() ||
-            !LinuxRuntimePolicy.HeadlessPureKeyboard.UsesPureKeyboardIntent())
-        {
-            failure = "Linux runtime pure-keyboard intent policy flags are inconsistent.";
-            return false;
-        }
+        LinuxMtFrameAssembler assembler = new(
+            slotCount: 1,
+            maxX: 1000,
+            maxY: 1000,
+            hasMtPressureData: true);
+        assembler.SelectSlot(0);
+        assembler.SetTrackingId(7);
+        assembler.SetPositionX(320);
+        assembler.SetPositionY(480);
+        assembler.SetPressure(192);
 
-        if (!LinuxRuntimePolicy.HeadlessPureKeyboard.AllowsAutomaticBindingSelection(hasSavedBindings: false) ||
-            LinuxRuntimePolicy.HeadlessPureKeyboard.AllowsAutomaticBindingSelection(hasSavedBindings: true) ||
-            LinuxRuntimePolicy.DesktopInteractive.AllowsAutomaticBindingSelection(hasSavedBindings: false))
+        InputFrame mtFrame = assembler.CommitFrame(timestampTicks: 1);
+        if (mtFrame.GetClampedContactCount() != 1)
         {
-            failure = "Linux runtime auto-binding policy flags are inconsistent.";
+            failure = "Linux multitouch assembler did not emit the expected slot contact.";
             return false;
         }
 
-        if (LinuxRuntimePolicy.HeadlessPureKeyboard.ResolveExclusiveGrabMode(disableExclusiveGrab: false, graphicalSession: true) != LinuxExclusiveGrabMode.Always ||
-            LinuxRuntimePolicy.HeadlessPureKeyboard.ResolveExclusiveGrabMode(disableExclusiveGrab: false, graphicalSession: false) != LinuxExclusiveGrabMode.Never ||
-            LinuxRuntimePolicy.HeadlessPureKeyboard.ResolveExclusiveGrabMode(disableExclusiveGrab: true, graphicalSession: true) != LinuxExclusiveGrabMode.Never ||
-            LinuxRuntimePolicy.DesktopInteractive.ResolveExclusiveGrabMode(disableExclusiveGrab: false, graphicalSession: true) != LinuxExclusiveGrabMode.DynamicKeyboardMode)
+        ContactFrame mtContact = mtFrame.GetContact(0);
+        if (!mtContact.HasForceData || mtContact.Pressure8 != 192 || mtContact.ForceNorm <= 0)
         {
-            failure = "Linux runtime exclusive-grab policy flags are inconsistent.";
+            failure = "Linux multitouch assembler did not preserve force-capable pressure data.";
             return false;
         }
 
@@ -947,84 +3087,34 @@ internal static class LinuxSelfTestRunner
         return true;
     }
 
-    private static bool ValidatePureKeyboardIntentSuppressesMouseTakeover(out string failure)
-    {
-        const ushort maxX = 7612;
-        const ushort maxY = 5065;
-        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
-        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
-        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
-        NormalizedRect keyRect = rightLayout.Rects[0][0];
-        ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
-        ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
-        ushort offKeyX = (ushort)Math.Clamp(maxX - 64, 1, maxX - 1);
-        ushort offKeyY = (ushort)Math.Clamp(maxY - 64, 1, maxY - 1);
-
-        UserSettings settings = new()
-        {
-            LayoutPresetName = preset.Name,
-            TypingEnabled = true,
-            KeyboardModeEnabled = false,
-            KeyBufferMs = 1.0,
-            IntentMoveMm = 1.0,
-            DragCancelMm = 1.0
-        };
-        settings.NormalizeRanges();
-
-        using RecordingDispatcher dispatcher = new();
-        using TouchProcessorRuntimeHost host = new(
-            dispatcher,
-            KeymapStore.LoadBundledDefault(),
-            preset,
-            settings,
-            pureKeyboardIntent: true);
-
-        long now = Stopwatch.Frequency / 100;
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 200);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
-        now += Math.Max(1, Stopwatch.Frequency / 20);
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: offKeyX, y: offKeyY, pressure: 64),
-            maxX,
-            maxY,
-            now));
+    private static bool ValidateEvdevReactorEpollSet(out string failure)
+    {
+        using AnonymousPipeServerStream writer = new(PipeDirection.Out);
+        using AnonymousPipeClientStream reader = new(PipeDirection.In, writer.ClientSafePipeHandle);
+        using LinuxEpollSet epoll = new(capacity: 2);
+        Span<int> readyTokens = stackalloc int[2];
+        epoll.Add((int)reader.SafePipeHandle.DangerousGetHandle(), token: 1);
 
-        if (!host.TryGetSynchronizedSnapshot(timeoutMs: 25, out TouchProcessorRuntimeSnapshot snapshot))
+        if (epoll.Wait(readyTokens, timeoutMs: 0) != 0)
         {
-            failure = "Pure-keyboard runtime host did not produce a synchronized snapshot for mouse suppression validation.";
+            failure = "Linux evdev reactor epoll set reported readiness on an idle fd.";
             return false;
         }
 
-        if (string.Equals(snapshot.IntentMode, "MouseCandidate", StringComparison.Ordinal) ||
-            string.Equals(snapshot.IntentMode, "MouseActive", StringComparison.Ordinal))
+        writer.WriteByte(0x2a);
+        writer.Flush();
+        if (epoll.Wait(readyTokens, timeoutMs: 1000) != 1 || readyTokens[0] != 1)
         {
-            failure = $"Pure-keyboard runtime host still entered mouse intent (intent={snapshot.IntentMode}).";
+            failure = "Linux evdev reactor epoll set did not report the readable fd with its binding token.";
+            return false;
+        }
+
+        _ = reader.ReadByte();
+        epoll.Wake();
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        if (epoll.Wait(readyTokens, timeoutMs: 1000) != 0 || stopwatch.ElapsedMilliseconds >= 500)
+        {
+            failure = "Linux evdev reactor epoll set did not return promptly on Wake without reporting a binding.";
             return false;
         }
 
@@ -1032,445 +3122,486 @@ internal static class LinuxSelfTestRunner
         return true;
     }
 
-    private static bool ValidateLinuxBundleRoundTripPreservesTrackpadBindings(out string failure)
+    private static bool ValidateBindingIndexHitTesting(out string failure)
     {
-        string? originalConfigHome = Environment.GetEnvironmentVariable("XDG_CONFIG_HOME");
-        string tempRoot = Path.Combine(Path.GetTempPath(), $"glasstokey-selftest-{Guid.NewGuid():N}");
-
-        try
+        // Sample a grid dense enough to land on every key, including exact shared edges.
+        const int GridSteps = 241;
+        double[] xs = new double[GridSteps * GridSteps];
+        double[] ys = new double[xs.Length];
+        for (int row = 0; row < GridSteps; row++)
         {
-            Directory.CreateDirectory(tempRoot);
-            Environment.SetEnvironmentVariable("XDG_CONFIG_HOME", tempRoot);
-
-            LinuxAppRuntime runtime = new();
-            LinuxHostSettings settings = runtime.LoadSettings();
-            settings.LeftTrackpadStableId = "left-stable-id";
-            settings.RightTrackpadStableId = "right-stable-id";
-            runtime.SaveSettings(settings);
-
-            string bundlePath = Path.Combine(tempRoot, "bundle.json");
-            if (!runtime.TryExportProfile(bundlePath, out string exportMessage))
+            for (int col = 0; col < GridSteps; col++)
             {
-                failure = $"Linux bundle export failed during self-test: {exportMessage}";
-                return false;
+                xs[(row * GridSteps) + col] = col / (double)(GridSteps - 1);
+                ys[(row * GridSteps) + col] = row / (double)(GridSteps - 1);
             }
+        }
 
-            LinuxHostSettings clearedSettings = runtime.LoadSettings();
-            clearedSettings.LeftTrackpadStableId = null;
-            clearedSettings.RightTrackpadStableId = null;
-            runtime.SaveSettings(clearedSettings);
-
-            if (!runtime.TryImportProfile(bundlePath, out string importMessage))
+        foreach (LinuxHitTestBenchmark.LinuxHitTestCase testCase in LinuxHitTestBenchmark.BuildCases())
+        {
+            LinuxHitTestBenchmark.ReferenceHitTester reference = new(testCase.Index);
+            int mismatches = LinuxHitTestBenchmark.CountMismatches(testCase.Index, reference, xs, ys);
+            if (mismatches != 0)
             {
-                failure = $"Linux bundle import failed during self-test: {importMessage}";
+                failure = $"Binding hit test disagreed with the reference path on {mismatches} points for layout '{testCase.Name}'.";
                 return false;
             }
+        }
 
-            LinuxHostSettings imported = runtime.LoadSettings();
-            if (!string.Equals(imported.LeftTrackpadStableId, "left-stable-id", StringComparison.Ordinal) ||
-                !string.Equals(imported.RightTrackpadStableId, "right-stable-id", StringComparison.Ordinal))
-            {
-                failure = $"Linux bundle round-trip did not preserve trackpad bindings (left='{imported.LeftTrackpadStableId}', right='{imported.RightTrackpadStableId}').";
-                return false;
-            }
+        failure = string.Empty;
+        return true;
+    }
 
-            failure = string.Empty;
-            return true;
-        }
-        catch (Exception ex)
+    private static bool ValidateEngineFrameRing(out string failure)
+    {
+        using BoundedMpscRing<int> ring = new(capacity: 3);
+        if (ring.Capacity != 4)
         {
-            failure = $"Linux bundle round-trip self-test failed: {ex.Message}";
+            failure = $"Engine frame ring capacity 3 should round up to 4, got {ring.Capacity}.";
             return false;
         }
-        finally
-        {
-            Environment.SetEnvironmentVariable("XDG_CONFIG_HOME", originalConfigHome);
-            try
-            {
-                if (Directory.Exists(tempRoot))
-                {
-                    Directory.Delete(tempRoot, recursive: true);
-                }
-            }
-            catch
-            {
-                // Best-effort cleanup only.
-            }
-        }
-    }
 
-    private static bool ValidateResolvedAction(string label, EngineKeyAction action, out string failure)
-    {
-        if (action.Kind == EngineActionKind.None)
+        for (int value = 0; value < ring.Capacity; value++)
         {
-            if (!string.Equals(label, "None", StringComparison.OrdinalIgnoreCase))
+            if (!ring.TryEnqueue(value))
             {
-                failure = $"Label '{label}' resolved to None.";
+                failure = $"Engine frame ring rejected item {value} before reaching capacity {ring.Capacity}.";
                 return false;
             }
-
-            failure = string.Empty;
-            return true;
         }
 
-        switch (action.Kind)
+        if (ring.TryEnqueue(99))
         {
-            case EngineActionKind.Key:
-            case EngineActionKind.Continuous:
-            case EngineActionKind.Modifier:
-                if (!CanResolveLinuxKey(action.SemanticAction.PrimaryCode, action.VirtualKey))
-                {
-                    failure = $"Label '{label}' did not resolve to a Linux key code.";
-                    return false;
-                }
-
-                break;
-            case EngineActionKind.KeyChord:
-                if (!CanResolveLinuxKey(action.SemanticAction.PrimaryCode, action.VirtualKey))
-                {
-                    failure = $"Chord '{label}' did not resolve its primary Linux key code.";
-                    return false;
-                }
-
-                if (!CanResolveChordModifiers(action))
-                {
-                    failure = $"Chord '{label}' did not resolve its modifier Linux key code.";
-                    return false;
-                }
-
-                break;
-            case EngineActionKind.MouseButton:
-                if (!LinuxKeyCodeMapper.TryMapMouseButton(action.MouseButton, out _))
-                {
-                    failure = $"Mouse label '{label}' did not resolve to a Linux button.";
-                    return false;
-                }
+            failure = "Engine frame ring accepted an item past capacity instead of reporting a drop.";
+            return false;
+        }
 
-                break;
-            case EngineActionKind.MomentaryLayer:
-            case EngineActionKind.LayerSet:
-            case EngineActionKind.LayerToggle:
-            case EngineActionKind.TypingToggle:
-                break;
-            default:
-                failure = $"Label '{label}' resolved unexpected action kind '{action.Kind}'.";
+        for (int expected = 0; expected < ring.Capacity; expected++)
+        {
+            if (!ring.TryDequeue(out int value) || value != expected)
+            {
+                failure = $"Engine frame ring returned items out of order (expected {expected}, got {value}).";
                 return false;
+            }
         }
 
-        failure = string.Empty;
-        return true;
-    }
-
-    private static bool CanResolveChordModifiers(EngineKeyAction action)
-    {
-        if (action.SemanticAction.Modifiers != DispatchModifierFlags.None)
+        const int producers = 4;
+        const int itemsPerProducer = 5000;
+        long sum = 0;
+        int received = 0;
+        Thread[] threads = new Thread[producers];
+        for (int producer = 0; producer < producers; producer++)
         {
-            Span<DispatchSemanticCode> modifierCodes = stackalloc DispatchSemanticCode[12];
-            int count = DispatchShortcutHelper.CopyModifierSemanticCodes(action.SemanticAction.Modifiers, modifierCodes);
-            int limit = Math.Min(count, modifierCodes.Length);
-            for (int index = 0; index < limit; index++)
+            threads[producer] = new Thread(() =>
             {
-                if (!CanResolveLinuxKey(modifierCodes[index], 0))
+                for (int item = 1; item <= itemsPerProducer; item++)
                 {
-                    return false;
+                    while (!ring.TryEnqueue(item))
+                    {
+                        Thread.Yield();
+                    }
                 }
-            }
-
-            return limit > 0;
+            });
+            threads[producer].Start();
         }
 
-        return CanResolveLinuxKey(action.SemanticAction.SecondaryCode, action.ModifierVirtualKey);
-    }
-
-    private sealed class FakeAutocorrectLexicon : AutocorrectSession.IAutocorrectLexicon
-    {
-        private readonly Dictionary<string, string> _corrections;
-
-        public FakeAutocorrectLexicon(params (string Typed, string Corrected)[] pairs)
+        Stopwatch stopwatch = Stopwatch.StartNew();
+        while (received < producers * itemsPerProducer && stopwatch.ElapsedMilliseconds < 10_000)
         {
-            _corrections = new Dictionary<string, string>(StringComparer.Ordinal);
-            for (int index = 0; index < pairs.Length; index++)
+            if (ring.TryDequeue(out int value))
             {
-                (string typed, string corrected) = pairs[index];
-                _corrections[typed] = corrected;
+                sum += value;
+                received++;
+                continue;
             }
+
+            ring.WaitForItem(parkTimeoutMs: 50);
         }
 
-        public bool EnsureLoaded()
+        foreach (Thread thread in threads)
         {
-            return true;
+            thread.Join();
         }
 
-        public string? ResolveCorrection(string typedLower, int maxEditDistance)
+        long expectedSum = producers * ((long)itemsPerProducer * (itemsPerProducer + 1) / 2);
+        if (received != producers * itemsPerProducer || sum != expectedSum)
         {
-            _ = maxEditDistance;
-            return _corrections.TryGetValue(typedLower, out string? corrected)
-                ? corrected
-                : null;
+            failure = $"Engine frame ring lost or duplicated items under concurrent producers (received={received}, sum={sum}, expected={expectedSum}).";
+            return false;
         }
 
-        public void Unload()
+        // Posts racing Dispose are either processed or rejected, never stranded in the ring.
+        TouchProcessorCore core = TouchProcessorFactory.CreateDefault(KeymapStore.LoadBundledDefault());
+        TouchProcessorActor actor = new(core, queueCapacity: 64);
+        long accepted = 0;
+        bool stop = false;
+        using ManualResetEventSlim started = new();
+        Thread poster = new(() =>
         {
+            InputFrame frame = MakeFrame(contactCount: 0);
+            for (long tick = 0; !Volatile.Read(ref stop); tick++)
+            {
+                if (actor.Post(TrackpadSide.Left, in frame, 7612, 5065, tick))
+                {
+                    accepted++;
+                }
+
+                if (tick == 1000)
+                {
+                    started.Set();
+                }
+            }
+        });
+        poster.Start();
+        started.Wait(5000);
+        actor.Dispose();
+        Volatile.Write(ref stop, true);
+        poster.Join();
+        TouchProcessorSnapshot afterDispose = core.Snapshot();
+        if (afterDispose.FramesProcessed != accepted)
+        {
+            failure = $"Engine actor stranded frames posted during Dispose (accepted={accepted}, processed={afterDispose.FramesProcessed}, drops={afterDispose.QueueDrops}).";
+            return false;
         }
+
+        failure = string.Empty;
+        return true;
     }
 
-    private static bool ValidateAtpCapRoundTrip(out string failure)
+    private static bool ValidateUinputBatchedWrites(out string failure)
     {
-        string tempRoot = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}");
-        string capturePath = Path.Combine(tempRoot, "synthetic.atpcap");
-        string fixturePath = Path.Combine(tempRoot, "synthetic.fixture.json");
-        string tracePath = Path.Combine(tempRoot, "synthetic-trace.json");
-
+        const int EventSize = 24;
+        string outputPath = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}.uinput");
         try
         {
-            Directory.CreateDirectory(tempRoot);
-            LinuxInputDeviceDescriptor device = new(
-                DeviceNode: "/dev/input/event-selftest",
-                StableId: "selftest-left",
-                UniqueId: "selftest-left",
-                PhysicalPath: "selftest-phys",
-                DisplayName: "SelfTest Trackpad",
-                VendorId: 0x05ac,
-                ProductId: 0x0324,
-                SupportsMultitouch: true,
-                SupportsPressure: true,
-                SupportsButtonClick: true,
-                IsPreferredInterface: true,
-                CanOpenEventStream: true,
-                AccessError: "ok");
-            LinuxTrackpadBinding binding = new(TrackpadSide.Left, device);
-
-            using (LinuxAtpCapCaptureWriter writer = new(capturePath))
+            LinuxUinputDevice device = new(File.OpenHandle(outputPath, FileMode.Create, FileAccess.ReadWrite));
+            using (LinuxUinputDispatcher dispatcher = new(device, DispatchRepeatProfile.Default))
             {
-                InputFrame baseline = new()
-                {
-                    ArrivalQpcTicks = 1_000,
-                    ReportId = 0xEE,
-                    ScanTime = 1,
-                    ContactCount = 0,
-                    IsButtonClicked = 0
-                };
-                writer.WriteFrame(new LinuxRuntimeFrame(
-                    binding,
-                    new LinuxEvdevFrameSnapshot(
-                        DeviceNode: device.DeviceNode,
-                        MinX: -3678,
-                        MinY: -2478,
-                        MaxX: 7612,
-                        MaxY: 5065,
-                        FrameSequence: 1,
-                        Frame: baseline)));
-
-                InputFrame active = new()
+                device.EmitKey(LinuxEvdevCodes.KeyA, isDown: true);
+                device.EmitKey(LinuxEvdevCodes.KeyA, isDown: false);
+                if (device.WriteCalls != 2 || device.EventsWritten != 4)
                 {
-                    ArrivalQpcTicks = 2_000,
-                    ReportId = 0xEE,
-                    ScanTime = 2,
-                    ContactCount = 1,
-                    IsButtonClicked = 1
-                };
-                active.SetContact(0, new ContactFrame(1, 1200, 800, 0x03, Pressure: 64, Phase: 0, HasForceData: false));
-                writer.WriteFrame(new LinuxRuntimeFrame(
-                    binding,
-                    new LinuxEvdevFrameSnapshot(
-                        DeviceNode: device.DeviceNode,
-                        MinX: -3678,
-                        MinY: -2478,
-                        MaxX: 7612,
-                        MaxY: 5065,
-                        FrameSequence: 2,
-                        Frame: active)));
+                    failure = $"uinput key reports expected 2 writes/4 events, got {device.WriteCalls}/{device.EventsWritten}.";
+                    return false;
+                }
 
-                InputFrame released = new()
+                dispatcher.Dispatch(new DispatchEvent(
+                    TimestampTicks: Stopwatch.GetTimestamp(),
+                    Kind: DispatchEventKind.MouseButtonClick,
+                    VirtualKey: 0,
+                    MouseButton: DispatchMouseButton.Left,
+                    RepeatToken: 0,
+                    Flags: DispatchEventFlags.None,
+                    Side: TrackpadSide.Right,
+                    DispatchLabel: "LClick"));
+                if (!dispatcher.TryGetDiagnostics(out InputDispatcherDiagnostics diagnostics) ||
+                    diagnostics.OutputWriteCalls != 3 ||
+                    diagnostics.OutputEvents != 8)
                 {
-                    ArrivalQpcTicks = 3_000,
-                    ReportId = 0xEE,
-                    ScanTime = 3,
-                    ContactCount = 0,
-                    IsButtonClicked = 0
-                };
-                writer.WriteFrame(new LinuxRuntimeFrame(
-                    binding,
-                    new LinuxEvdevFrameSnapshot(
-                        DeviceNode: device.DeviceNode,
-                        MinX: -3678,
-                        MinY: -2478,
-                        MaxX: 7612,
-                        MaxY: 5065,
-                        FrameSequence: 3,
-                        Frame: released)));
-            }
+                    failure = $"uinput click expected one write of 4 events, diagnostics show {diagnostics.OutputWriteCalls} writes/{diagnostics.OutputEvents} events.";
+                    return false;
+                }
 
-            LinuxAtpCapSummaryResult summary = LinuxAtpCapReplayRunner.Summarize(capturePath);
-            if (!summary.Success ||
-                !summary.Summary.Contains("frames=3", StringComparison.Ordinal) ||
-                !summary.Summary.Contains("buttonPressedFrames=1", StringComparison.Ordinal) ||
-                !summary.Summary.Contains("buttonDownEdges=1", StringComparison.Ordinal) ||
-                !summary.Summary.Contains("buttonUpEdges=1", StringComparison.Ordinal))
-            {
-                failure = $"Synthetic Linux .atpcap summary failed: {summary.Summary}";
-                return false;
-            }
+                // A burst larger than the staging buffer still flushes in capacity-sized writes.
+                device.BeginBatch();
+                for (int index = 0; index < 200; index++)
+                {
+                    device.EmitKey(LinuxEvdevCodes.KeyBackspace, isDown: (index & 1) == 0);
+                }
 
-            LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
-            LinuxAtpCapReplayResult replay = LinuxAtpCapReplayRunner.Replay(capturePath, configuration, tracePath);
-            if (!replay.Success)
-            {
-                failure = "Synthetic Linux .atpcap replay failed.";
-                return false;
+                if (device.WriteCalls != 4)
+                {
+                    failure = $"uinput batch flushed before EndBatch ({device.WriteCalls} writes).";
+                    return false;
+                }
+
+                device.EndBatch();
+                if (device.Flushes != 5 || device.EventsWritten != 408)
+                {
+                    failure = $"uinput 400-event burst expected 2 flushes, got flushes={device.Flushes}, events={device.EventsWritten}.";
+                    return false;
+                }
             }
 
-            if (replay.Metrics.FramesSeen < 4 || replay.Metrics.FramesParsed < 3 || replay.Metrics.FramesDispatched < 3)
+            byte[] written = File.ReadAllBytes(outputPath);
+            if (written.Length != 408 * EventSize ||
+                BinaryPrimitives.ReadUInt16LittleEndian(written.AsSpan(16, 2)) != LinuxEvdevCodes.EventKey ||
+                BinaryPrimitives.ReadUInt16LittleEndian(written.AsSpan(18, 2)) != LinuxEvdevCodes.KeyA ||
+                BinaryPrimitives.ReadInt32LittleEndian(written.AsSpan(20, 4)) != 1 ||
+                BinaryPrimitives.ReadUInt16LittleEndian(written.AsSpan(EventSize + 16, 2)) != LinuxEvdevCodes.EventSync ||
+                BinaryPrimitives.ReadUInt16LittleEndian(written.AsSpan((407 * EventSize) + 16, 2)) != LinuxEvdevCodes.EventSync)
             {
-                failure = "Synthetic Linux .atpcap replay metrics were incomplete.";
+                failure = $"uinput batched output has unexpected layout ({written.Length} bytes).";
                 return false;
             }
 
-            if (replay.CaptureFingerprint == 0 || replay.DispatchFingerprint == 0)
+            failure = string.Empty;
+            return true;
+        }
+        finally
+        {
+            File.Delete(outputPath);
+        }
+    }
+
+    // Needs a writable uinput and a readable loopback node; passes without running otherwise.
+    private static bool ValidateUinputLoopback(out string failure)
+    {
+        failure = string.Empty;
+        if (!new LinuxUinputPermissionProbe().Probe().IsReady)
+        {
+            return true;
+        }
+
+        LinuxUinputLoopbackResult result;
+        try
+        {
+            result = LinuxUinputLoopbackProbe.Run(new LinuxUinputLoopbackOptions(Samples: 20, IntervalMicroseconds: 1000, BurstSize: 16, Bursts: 2));
+        }
+        catch (LinuxUinputLoopbackUnavailableException)
+        {
+            return true;
+        }
+
+        if (result.ReportsLost != 0 ||
+            result.ReportsMismatched != 0 ||
+            result.KeyLatency.Count != 20 ||
+            result.RelativeLatency.Count != 20 ||
+            result.BurstLatency.Count != 32)
+        {
+            failure = $"uinput loopback lost or mismatched reports (sent={result.ReportsSent}, delivered={result.ReportsDelivered}, mismatched={result.ReportsMismatched}, synDropped={result.SynDropped}).";
+            return false;
+        }
+
+        return true;
+    }
+
+    private static bool ValidateVirtualClockPipeline(out string failure)
+    {
+        string outputPath = Path.Combine(Path.GetTempPath(), $"glasstokey-linux-selftest-{Guid.NewGuid():N}.uinput");
+        try
+        {
+            // A held key repeats on simulated time: a second of repeats costs no wall time.
+            VirtualTimeProvider clock = new(Stopwatch.Frequency * 10);
+            LinuxUinputDevice device = new(File.OpenHandle(outputPath, FileMode.Create, FileAccess.ReadWrite));
+            using (LinuxUinputDispatcher dispatcher = new(device, DispatchRepeatProfile.Default, new AutocorrectSession(), clock))
             {
-                failure = "Synthetic Linux .atpcap replay fingerprints were not populated.";
-                return false;
+                long downTicks = clock.GetTimestamp();
+                dispatcher.Dispatch(new DispatchEvent(
+                    TimestampTicks: downTicks,
+                    Kind: DispatchEventKind.KeyDown,
+                    VirtualKey: 0x41,
+                    MouseButton: DispatchMouseButton.None,
+                    RepeatToken: 7,
+                    Flags: DispatchEventFlags.Repeatable,
+                    Side: TrackpadSide.Left,
+                    DispatchLabel: "A",
+                    RepeatProfile: DispatchRepeatProfile.Default));
+                long heldTicks = Stopwatch.Frequency;
+                long wallStart = Stopwatch.GetTimestamp();
+                int ticks = DispatchEventPump.RunDueTicks(dispatcher, clock, downTicks + heldTicks);
+                long wallTicks = Stopwatch.GetTimestamp() - wallStart;
+                long expectedRepeats = 1 + ((heldTicks - DispatchRepeatProfile.Default.GetInitialDelayTicks()) / DispatchRepeatProfile.Default.GetIntervalTicks());
+                // Each repeat pulses the key: a release then a press.
+                if (device.WriteCalls != 1 + (2 * expectedRepeats) || ticks != expectedRepeats || clock.GetTimestamp() != downTicks + heldTicks)
+                {
+                    failure = $"Virtual-clock key hold expected {expectedRepeats} repeats, got writes={device.WriteCalls}, ticks={ticks}.";
+                    return false;
+                }
+
+                if (wallTicks >= heldTicks / 2)
+                {
+                    failure = $"Virtual-clock key hold took {wallTicks * 1000.0 / Stopwatch.Frequency:F0} ms of wall time for 1 s simulated.";
+                    return false;
+                }
             }
 
-            if (!File.Exists(tracePath))
+            // Between frames the engine stamps on the injected clock: disabling typing releases a
+            // held gesture at the virtual "now", not at a Stopwatch reading.
+            VirtualTimeProvider engineClock = new(Stopwatch.Frequency * 5);
+            TouchProcessorCore core = TouchProcessorFactory.CreateDefault(KeymapStore.LoadBundledDefault(), clock: engineClock);
+            core.Configure(core.CurrentConfig with { TwoFingerHoldAction = "A", HoldRepeatEnabled = true });
+            using DispatchEventQueue queue = new();
+            long disableTicks = engineClock.GetTimestamp() + (2 * Stopwatch.Frequency);
+            using (TouchProcessorActor actor = new(core, dispatchQueue: queue))
             {
-                failure = "Synthetic Linux replay trace was not created.";
-                return false;
+                InputFrame twoFingers = MakeMultiContactFrame((70, 2600, 2500), (71, 3400, 2500));
+                long now = engineClock.GetTimestamp();
+                for (int frame = 0; frame < 40; frame++)
+                {
+                    actor.Post(TrackpadSide.Left, in twoFingers, 7612, 5065, now);
+                    now += MsToTicks(10);
+                }
+
+                actor.WaitForIdle();
+                engineClock.AdvanceTo(disableTicks);
+                actor.SetTypingEnabled(false);
+                InputFrame allUp = MakeFrame(contactCount: 0);
+                actor.Post(TrackpadSide.Left, in allUp, 7612, 5065, disableTicks + Stopwatch.Frequency);
+                actor.WaitForIdle();
             }
 
-            LinuxAtpCapFixtureWriteResult fixtureWrite = LinuxAtpCapFixtureRunner.WriteFixture(capturePath, fixturePath, configuration);
-            if (!fixtureWrite.Success || !File.Exists(fixturePath))
+            ulong heldToken = 0;
+            long releaseTicks = -1;
+            while (queue.TryDequeue(out DispatchEvent dispatchEvent, waitMs: 0))
             {
-                failure = $"Synthetic Linux fixture generation failed: {fixtureWrite.Summary}";
-                return false;
+                if (dispatchEvent.Kind == DispatchEventKind.KeyDown && dispatchEvent.RepeatToken != 0)
+                {
+                    heldToken = dispatchEvent.RepeatToken;
+                }
+                else if (dispatchEvent.Kind == DispatchEventKind.KeyUp && heldToken != 0 && dispatchEvent.RepeatToken == heldToken)
+                {
+                    releaseTicks = dispatchEvent.TimestampTicks;
+                }
             }
 
-            LinuxAtpCapFixtureCheckResult fixtureCheck = LinuxAtpCapFixtureRunner.CheckFixture(capturePath, fixturePath, configuration, traceOutputPath: null);
-            if (!fixtureCheck.Success)
+            if (heldToken == 0 || releaseTicks != disableTicks)
             {
-                failure = $"Synthetic Linux fixture check failed: {fixtureCheck.Summary}";
+                failure = $"Virtual-clock engine released the held gesture at {releaseTicks}, expected virtual {disableTicks} (held={heldToken != 0}).";
                 return false;
             }
-
-            failure = string.Empty;
-            return true;
         }
-        catch (Exception ex)
+        finally
         {
-            failure = $"Synthetic Linux .atpcap round-trip failed: {ex.Message}";
+            File.Delete(outputPath);
+        }
+
+        string fixtureDirectory = Path.Combine(AppContext.BaseDirectory, "fixtures", "linux");
+        string[] capturePaths = Directory.Exists(fixtureDirectory)
+            ? Directory.GetFiles(fixtureDirectory, "*.atpcap")
+            : [];
+        if (capturePaths.Length == 0)
+        {
+            failure = $"No replay fixtures were found under '{fixtureDirectory}' for the virtual-clock replay check.";
             return false;
         }
-        finally
+
+        LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+        // Deferred autocorrect lookups answer on a real worker thread and must not leak its
+        // timing into the simulated output.
+        UserSettings autocorrectProfile = configuration.SharedProfile.Clone();
+        autocorrectProfile.AutocorrectEnabled = true;
+        LinuxRuntimeConfiguration[] configurations = [configuration, configuration with { SharedProfile = autocorrectProfile }];
+        foreach (LinuxRuntimeConfiguration replayConfiguration in configurations)
         {
-            try
+            foreach (string capturePath in capturePaths)
             {
-                if (Directory.Exists(tempRoot))
+                LinuxAtpCapVirtualReplayResult first = LinuxAtpCapReplayRunner.ReplayVirtualPipeline(capturePath, replayConfiguration, outputPath: null);
+                LinuxAtpCapVirtualReplayResult second = LinuxAtpCapReplayRunner.ReplayVirtualPipeline(capturePath, replayConfiguration, outputPath: null);
+                if (!first.Success ||
+                    first.Frames == 0 ||
+                    first.OutputFingerprint != second.OutputFingerprint ||
+                    first.OutputEvents != second.OutputEvents ||
+                    first.VirtualTicks != second.VirtualTicks)
                 {
-                    Directory.Delete(tempRoot, recursive: true);
+                    failure = $"Virtual-clock replay was not deterministic (autocorrect={replayConfiguration.SharedProfile.AutocorrectEnabled}). first: {first.Summary} second: {second.Summary}";
+                    return false;
                 }
             }
-            catch
-            {
-            }
         }
-    }
 
-    private static bool CanResolveLinuxKey(DispatchSemanticCode semanticCode, ushort virtualKey)
-    {
-        return (semanticCode != DispatchSemanticCode.None && LinuxKeyCodeMapper.TryMapSemanticCode(semanticCode, out _)) ||
-               (virtualKey != 0 && LinuxKeyCodeMapper.TryMapKey(virtualKey, out _));
+        failure = string.Empty;
+        return true;
     }
 
-    private static bool ValidateLinuxForceThresholdDispatch(out string failure)
+    private static bool ValidateDispatchPumpDeadlineScheduling(out string failure)
     {
-        const ushort maxX = 7612;
-        const ushort maxY = 5065;
-        TrackpadLayoutPreset preset = TrackpadLayoutPreset.SixByThree;
-        ColumnLayoutSettings[] columns = ColumnLayoutDefaults.DefaultSettings(preset.Columns);
-        KeyLayout rightLayout = LayoutBuilder.BuildLayout(preset, 160.0, 114.9, 18.0, 17.0, columns, mirrored: false);
-        NormalizedRect keyRect = rightLayout.Rects[0][0];
-        ushort keyX = (ushort)Math.Clamp((int)Math.Round((keyRect.X + (keyRect.Width * 0.5)) * maxX), 1, maxX - 1);
-        ushort keyY = (ushort)Math.Clamp((int)Math.Round((keyRect.Y + (keyRect.Height * 0.5)) * maxY), 1, maxY - 1);
-
-        UserSettings settings = new()
+        DeadlineDispatcher dispatcher = new();
+        using DispatchEventQueue queue = new();
+        long deadlineTicks = Stopwatch.GetTimestamp() + (Stopwatch.Frequency / 50);
+        dispatcher.SetDeadline(deadlineTicks);
+        using (DispatchEventPump pump = new(queue, dispatcher))
         {
-            LayoutPresetName = preset.Name,
-            ForceMin = 200,
-            ForceCap = 255
-        };
-        settings.NormalizeRanges();
+            if (!dispatcher.DeadlineReached.Wait(1000))
+            {
+                failure = "Dispatch pump never ticked the dispatcher at its reported deadline.";
+                return false;
+            }
 
-        using RecordingDispatcher dispatcher = new();
-        using TouchProcessorRuntimeHost host = new(dispatcher, KeymapStore.LoadBundledDefault(), preset, settings);
+            long firedTicks = dispatcher.FiredTicks;
+            if (firedTicks < deadlineTicks)
+            {
+                failure = "Dispatch pump ticked the dispatcher before its reported deadline.";
+                return false;
+            }
 
-        long now = 0;
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 32, hasForceData: true),
-            maxX,
-            maxY,
-            now));
-        now += 1;
-        host.Post(new TrackpadFrameEnvelope(TrackpadSide.Right, MakeFrame(contactCount: 0), maxX, maxY, now));
-        if (!dispatcher.WaitForDispatchCount(0, timeoutMs: 150))
-        {
-            failure = "Low-force key tap was not suppressed by shared Force Min/Max settings.";
-            return false;
+            Thread.Sleep(100);
+            if (pump.Snapshot().TickCalls != 1)
+            {
+                failure = $"Dispatch pump ticked an idle dispatcher with no pending deadline (tickCalls={pump.Snapshot().TickCalls}).";
+                return false;
+            }
         }
 
-        now += 10;
-        host.Post(new TrackpadFrameEnvelope(
-            TrackpadSide.Right,
-            MakeFrame(contactCount: 1, x: keyX, y: keyY, pressure: 240, hasForceData: true),
-            maxX,
-            maxY,
-            now));
-        now += 1;
-        host.Post(new TrackpadFrameEnvelope(TrackpadSide.Right, MakeFrame(contactCount: 0), maxX, maxY, now));
-        if (!dispatcher.WaitForDispatchCount(1, timeoutMs: 150))
-        {
-            failure = "High-force key tap did not dispatch when inside the shared Force Min/Max window.";
+        failure = string.Empty;
+        return true;
+    }
+
+    // Steady-state frame processing must not allocate, with or without engine diagnostics.
+    private static bool ValidateReplayAllocationBudget(out string failure)
+    {
+        const double budgetBytesPerFrame = 0;
+        string fixtureDirectory = Path.Combine(AppContext.BaseDirectory, "fixtures", "linux");
+        string[] capturePaths = Directory.Exists(fixtureDirectory)
+            ? Directory.GetFiles(fixtureDirectory, "*.atpcap")
+            : [];
+        if (capturePaths.Length == 0)
+        {
+            failure = $"No replay fixtures were found under '{fixtureDirectory}' for the allocation budget check.";
             return false;
         }
 
-        DispatchEvent[] events = dispatcher.Snapshot();
-        if (events.Length != 1 || events[0].Kind != DispatchEventKind.KeyTap)
+        LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+        foreach (string capturePath in capturePaths)
         {
-            failure = $"Unexpected dispatch sequence for force-threshold validation (events={events.Length}).";
-            return false;
+            foreach (bool diagnosticsEnabled in new[] { false, true })
+            {
+                LinuxAtpCapAllocationResult result = LinuxAtpCapReplayRunner.MeasureAllocations(capturePath, configuration, diagnosticsEnabled);
+                if (!result.Success || result.AllocatedBytesPerFrame > budgetBytesPerFrame)
+                {
+                    failure = $"Replay allocation budget of {budgetBytesPerFrame} bytes/frame exceeded. {result.Summary}";
+                    return false;
+                }
+            }
         }
 
         failure = string.Empty;
         return true;
     }
 
-    private static bool ValidateLinuxAssemblerForceData(out string failure)
+    private static bool ValidateBatchReplayMatchesActorReplay(out string failure)
     {
-        LinuxMtFrameAssembler assembler = new(
-            slotCount: 1,
-            maxX: 1000,
-            maxY: 1000,
-            hasMtPressureData: true);
-        assembler.SelectSlot(0);
-        assembler.SetTrackingId(7);
-        assembler.SetPositionX(320);
-        assembler.SetPositionY(480);
-        assembler.SetPressure(192);
-
-        InputFrame mtFrame = assembler.CommitFrame(timestampTicks: 1);
-        if (mtFrame.GetClampedContactCount() != 1)
+        string fixtureDirectory = Path.Combine(AppContext.BaseDirectory, "fixtures", "linux");
+        if (!Directory.Exists(fixtureDirectory))
         {
-            failure = "Linux multitouch assembler did not emit the expected slot contact.";
+            failure = $"No replay fixtures were found under '{fixtureDirectory}' for the batch replay check.";
             return false;
         }
 
-        ContactFrame mtContact = mtFrame.GetContact(0);
-        if (!mtContact.HasForceData || mtContact.Pressure8 != 192 || mtContact.ForceNorm <= 0)
+        LinuxAtpCapBatchReplayReport report = LinuxAtpCapBatchReplayRunner.Run(
+            fixtureDirectory,
+            parallelism: 2,
+            () => new LinuxAppRuntime().LoadReplayConfiguration());
+        if (report.Results.Count == 0 || report.FailedCount != 0)
         {
-            failure = "Linux multitouch assembler did not preserve force-capable pressure data.";
+            failure = $"Batch replay over '{fixtureDirectory}' failed: {LinuxAtpCapBatchReplayRunner.FormatReport(report)}";
             return false;
         }
 
+        LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+        foreach (LinuxAtpCapReplayResult batch in report.Results)
+        {
+            LinuxAtpCapReplayResult actor = LinuxAtpCapReplayRunner.Replay(batch.CapturePath, configuration, traceOutputPath: null);
+            if (batch.CaptureFingerprint != actor.CaptureFingerprint ||
+                batch.DispatchFingerprint != actor.DispatchFingerprint ||
+                batch.DispatchEventCount != actor.DispatchEventCount ||
+                batch.IntentTransitionCount != actor.IntentTransitionCount)
+            {
+                failure = $"Synchronous batch replay diverged from actor replay. batch: {batch.Summary} actor: {actor.Summary}";
+                return false;
+            }
+        }
+
         failure = string.Empty;
         return true;
     }
@@ -1586,6 +3717,86 @@ internal static class LinuxSelfTestRunner
         return frame;
     }
 
+    private sealed class DeadlineDispatcher : IInputDispatcher
+    {
+        private long _deadlineTicks = long.MaxValue;
+
+        public ManualResetEventSlim DeadlineReached { get; } = new(false);
+
+        public long FiredTicks { get; private set; }
+
+        public void SetDeadline(long deadlineTicks)
+        {
+            Volatile.Write(ref _deadlineTicks, deadlineTicks);
+        }
+
+        public void Dispatch(in DispatchEvent dispatchEvent)
+        {
+        }
+
+        public void Tick(long nowTicks)
+        {
+            if (nowTicks < Volatile.Read(ref _deadlineTicks))
+            {
+                return;
+            }
+
+            FiredTicks = nowTicks;
+            Volatile.Write(ref _deadlineTicks, long.MaxValue);
+            DeadlineReached.Set();
+        }
+
+        public long GetNextDeadlineTicks()
+        {
+            return Volatile.Read(ref _deadlineTicks);
+        }
+
+        public void Dispose()
+        {
+        }
+    }
+
+    private sealed class EngineEventRecorder : EventListener
+    {
+        private readonly List<EventWrittenEventArgs> _events = new();
+
+        public EngineEventRecorder()
+        {
+        }
+
+        // OnEventSourceCreated runs from the base constructor, before a level field could be
+        // set, so a narrower session replaces the Verbose one it enabled.
+        public EngineEventRecorder(EventLevel level)
+        {
+            DisableEvents(EngineEventSource.Log);
+            EnableEvents(EngineEventSource.Log, level, EventKeywords.All);
+        }
+
+        protected override void OnEventSourceCreated(EventSource eventSource)
+        {
+            if (string.Equals(eventSource.Name, "GlassToKey-Engine", StringComparison.Ordinal))
+            {
+                EnableEvents(eventSource, EventLevel.Verbose, EventKeywords.All);
+            }
+        }
+
+        protected override void OnEventWritten(EventWrittenEventArgs eventData)
+        {
+            lock (_events)
+            {
+                _events.Add(eventData);
+            }
+        }
+
+        public EventWrittenEventArgs[] Snapshot()
+        {
+            lock (_events)
+            {
+                return _events.ToArray();
+            }
+        }
+    }
+
     private sealed class RecordingDispatcher : IInputDispatcher, IThreeFingerDragSink
     {
         private readonly object _gate = new();
@@ -1608,6 +3819,11 @@ internal static class LinuxSelfTestRunner
             _ = nowTicks;
         }
 
+        public long GetNextDeadlineTicks()
+        {
+            return long.MaxValue;
+        }
+
         public void MovePointerBy(int deltaX, int deltaY)
         {
             if (deltaX == 0 && deltaY == 0)
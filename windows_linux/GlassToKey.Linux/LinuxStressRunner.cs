@@ -0,0 +1,127 @@
+using System.Diagnostics;
+using GlassToKey;
+
+namespace GlassToKey.Linux;
+
+internal readonly record struct LinuxStressOptions(
+    double Seconds,
+    SyntheticTouchStreamOptions Stream,
+    bool Paced);
+
+internal readonly record struct LinuxStressResult(
+    long FramesPosted,
+    long FramesProcessed,
+    long QueueDrops,
+    long DispatchEnqueued,
+    long DispatchDrops,
+    long ElapsedTicks,
+    PipelineLatencySnapshot Latency)
+{
+    public double ElapsedSeconds => ElapsedTicks / (double)Stopwatch.Frequency;
+
+    public double FramesPerSecond => ElapsedTicks <= 0 ? 0 : FramesProcessed / ElapsedSeconds;
+
+    // Frames/sec the engine thread could sustain at the median per-frame processing cost.
+    public double EstimatedCapacity
+    {
+        get
+        {
+            long p50 = Latency[PipelineLatencyStage.EngineProcess].P50Nanoseconds;
+            return p50 <= 0 ? 0 : 1_000_000_000.0 / p50;
+        }
+    }
+}
+
+// Drives the full runtime host (actor, dispatch queue and pump) with a synthetic two-trackpad
+// stream into a dispatcher that discards everything, from one producer thread like the evdev
+// reactor. Paced runs post each frame at its report time; unpaced runs post as fast as the
+// queue accepts them, which finds the point where frames start to drop.
+internal static class LinuxStressRunner
+{
+    public static LinuxStressResult Run(LinuxStressOptions options, KeymapStore keymap, TrackpadLayoutPreset preset, UserSettings settings)
+    {
+        using NullDispatcher dispatcher = new();
+        using TouchProcessorRuntimeHost host = new(dispatcher, keymap, preset, settings);
+        long startTicks = Stopwatch.GetTimestamp();
+        SyntheticTouchStream stream = new(options.Stream, startTicks);
+        long durationTicks = (long)(options.Seconds * Stopwatch.Frequency);
+        long posted = 0;
+        while (true)
+        {
+            SyntheticTouchFrame frame = stream.Next();
+            long nowTicks = Stopwatch.GetTimestamp();
+            if (options.Paced)
+            {
+                if (frame.TimestampTicks - startTicks >= durationTicks)
+                {
+                    break;
+                }
+
+                nowTicks = WaitUntil(frame.TimestampTicks, nowTicks);
+            }
+            else if (nowTicks - startTicks >= durationTicks)
+            {
+                break;
+            }
+
+            // The report's due time stands in for the kernel timestamp, so paced runs also
+            // show how late the producer itself was.
+            PipelineTimestamps timestamps = new(options.Paced ? frame.TimestampTicks : 0, nowTicks);
+            host.Post(new TrackpadFrameEnvelope(frame.Side, frame.Frame, options.Stream.MaxX, options.Stream.MaxY, frame.TimestampTicks, timestamps));
+            posted++;
+        }
+
+        // Let the actor drain what it accepted before reading the counters.
+        host.TryGetSynchronizedSnapshot(timeoutMs: 2000, out TouchProcessorRuntimeSnapshot snapshot);
+        long elapsedTicks = Stopwatch.GetTimestamp() - startTicks;
+        return new LinuxStressResult(
+            posted,
+            snapshot.FramesProcessed,
+            snapshot.QueueDrops,
+            snapshot.DispatchEnqueued,
+            snapshot.DispatchQueueDrops + snapshot.DispatchSuppressedRingFull,
+            elapsedTicks,
+            host.GetPipelineLatency());
+    }
+
+    private static long WaitUntil(long targetTicks, long nowTicks)
+    {
+        while (nowTicks < targetTicks)
+        {
+            long remainingMs = (targetTicks - nowTicks) * 1000 / Stopwatch.Frequency;
+            if (remainingMs >= 2)
+            {
+                Thread.Sleep((int)(remainingMs - 1));
+            }
+            else
+            {
+                // Yield rather than spin so the engine thread keeps its core on small machines.
+                Thread.Yield();
+            }
+
+            nowTicks = Stopwatch.GetTimestamp();
+        }
+
+        return nowTicks;
+    }
+
+    private sealed class NullDispatcher : IInputDispatcher
+    {
+        public void Dispatch(in DispatchEvent dispatchEvent)
+        {
+        }
+
+        public void Tick(long nowTicks)
+        {
+        }
+
+        public long GetNextDeadlineTicks()
+        {
+            return long.MaxValue;
+        }
+
+        public void Dispose()
+        {
+        }
+    }
+}
@@ -0,0 +1,8 @@
+namespace GlassToKey.Platform.Linux.Devices;
+
+// Push source of hotplug uevents. The netlink implementation calls back on its own thread;
+// tests substitute a source they raise events on directly.
+internal interface ILinuxUeventSource : IDisposable
+{
+    void Start(Action<LinuxUevent> onUevent);
+}
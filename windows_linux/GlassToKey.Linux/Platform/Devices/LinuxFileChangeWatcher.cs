@@ -0,0 +1,366 @@
+using System.Buffers.Binary;
+using System.ComponentModel;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace GlassToKey.Platform.Linux.Devices;
+
+// inotify change detector for a handful of files plus whole directories. Files are watched
+// through their parent directory so editors that save by rename are still seen. A burst of
+// events is coalesced into one change after the debounce window.
+public sealed class LinuxFileChangeWatcher : IDisposable
+{
+    private const int InotifyNonBlocking = 0x800;
+    private const int InotifyCloexec = 0x80000;
+    private const int EventFdCloexec = 0x80000;
+    private const int EventFdNonBlocking = 0x800;
+    private const uint InCloseWrite = 0x008;
+    private const uint InMovedFrom = 0x040;
+    private const uint InMovedTo = 0x080;
+    private const uint InCreate = 0x100;
+    private const uint InDelete = 0x200;
+    private const uint InQueueOverflow = 0x4000;
+    private const uint InIgnored = 0x8000;
+    private const uint InOnlyDirectory = 0x1000000;
+    private const uint FileEntryMask = InCloseWrite | InMovedTo | InMovedFrom | InDelete;
+    // No IN_ATTRIB: every permission or timestamp change on a device node (our own uinput
+    // node included) would otherwise look like a hotplug.
+    private const uint DirectoryEntryMask = InCreate | InDelete | InMovedTo | InMovedFrom;
+    private const short PollIn = 0x001;
+    private const int ErrnoInterrupted = 4;
+    private const int ErrnoWouldBlock = 11;
+    private const int EventHeaderSize = 16;
+
+    private readonly object _watchGate = new();
+    private readonly object _signalGate = new();
+    private readonly int _inotifyFd;
+    private readonly int _wakeFd;
+    private readonly long _debounceTicks;
+    private readonly Dictionary<int, WatchedDirectory> _watches = new();
+    private readonly byte[] _readBuffer = new byte[16 * 1024];
+    private readonly byte[] _wakeBuffer = new byte[sizeof(ulong)];
+    private readonly byte[] _wakeValue = BitConverter.GetBytes(1UL);
+    private readonly Thread _thread;
+    private TaskCompletionSource _changed = new(TaskCreationOptions.RunContinuationsAsynchronously);
+    private long _changeSequence;
+    private string? _failure;
+    private volatile bool _disposed;
+
+    public LinuxFileChangeWatcher(TimeSpan debounce)
+    {
+        _debounceTicks = Math.Max(0, (long)(debounce.TotalSeconds * Stopwatch.Frequency));
+        _inotifyFd = inotify_init1(InotifyNonBlocking | InotifyCloexec);
+        if (_inotifyFd < 0)
+        {
+            throw new IOException($"inotify_init1() failed: {new Win32Exception(Marshal.GetLastWin32Error()).Message}");
+        }
+
+        _wakeFd = eventfd(0, EventFdCloexec | EventFdNonBlocking);
+        if (_wakeFd < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            close(_inotifyFd);
+            throw new IOException($"eventfd() failed: {new Win32Exception(error).Message}");
+        }
+
+        _thread = new Thread(Run)
+        {
+            IsBackground = true,
+            Name = "GlassToKey.FileWatch"
+        };
+        _thread.Start();
+    }
+
+    // Bumped once per debounced change; pair with WaitForChangeAsync so a change that lands
+    // between two waits is not lost.
+    public long ChangeSequence
+    {
+        get
+        {
+            lock (_signalGate)
+            {
+                return _changeSequence;
+            }
+        }
+    }
+
+    // Set once the watch thread has stopped on an unrecoverable poll() error; no further
+    // changes will be reported.
+    public string? Failure => Volatile.Read(ref _failure);
+
+    // Replaces the watched set. Files match by name inside their directory; directories match
+    // any entry. Returns false when any path could not be watched (typically it does not exist)
+    // or the watcher has failed, so the caller falls back to polling.
+    public bool Watch(IEnumerable<string> files, IEnumerable<string> directories)
+    {
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (Failure != null)
+        {
+            return false;
+        }
+
+        Dictionary<string, WatchedDirectory> requested = new(StringComparer.Ordinal);
+        foreach (string file in files)
+        {
+            string fullPath = Path.GetFullPath(file);
+            string directory = Path.GetDirectoryName(fullPath) ?? "/";
+            if (!requested.TryGetValue(directory, out WatchedDirectory? entry))
+            {
+                entry = new WatchedDirectory(directory);
+                requested.Add(directory, entry);
+            }
+
+            entry.Names.Add(Path.GetFileName(fullPath));
+        }
+
+        foreach (string directory in directories)
+        {
+            string fullPath = Path.TrimEndingDirectorySeparator(Path.GetFullPath(directory));
+            if (!requested.TryGetValue(fullPath, out WatchedDirectory? entry))
+            {
+                entry = new WatchedDirectory(fullPath);
+                requested.Add(fullPath, entry);
+            }
+
+            entry.AnyEntry = true;
+        }
+
+        bool allWatched = true;
+        lock (_watchGate)
+        {
+            HashSet<int> retained = new();
+            foreach (WatchedDirectory entry in requested.Values)
+            {
+                uint mask = InOnlyDirectory | (entry.AnyEntry ? DirectoryEntryMask : 0) | (entry.Names.Count > 0 ? FileEntryMask : 0);
+                // Re-adding an already watched directory returns its existing descriptor.
+                int wd = inotify_add_watch(_inotifyFd, entry.Path, mask);
+                if (wd < 0)
+                {
+                    allWatched = false;
+                    continue;
+                }
+
+                _watches[wd] = entry;
+                retained.Add(wd);
+            }
+
+            foreach (int wd in _watches.Keys.Where(wd => !retained.Contains(wd)).ToArray())
+            {
+                _watches.Remove(wd);
+                _ = inotify_rm_watch(_inotifyFd, wd);
+            }
+        }
+
+        return allWatched;
+    }
+
+    // Completes once ChangeSequence moves past observedSequence, and at once after the watcher
+    // has failed (the caller's next Watch then returns false).
+    public Task WaitForChangeAsync(long observedSequence, CancellationToken cancellationToken)
+    {
+        Task changed;
+        lock (_signalGate)
+        {
+            if (_changeSequence != observedSequence || _failure != null)
+            {
+                return Task.CompletedTask;
+            }
+
+            changed = _changed.Task;
+        }
+
+        return changed.WaitAsync(cancellationToken);
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+        {
+            return;
+        }
+
+        _disposed = true;
+        _ = write(_wakeFd, _wakeValue, (nuint)_wakeValue.Length);
+        if (Thread.CurrentThread != _thread)
+        {
+            _thread.Join();
+        }
+
+        close(_inotifyFd);
+        close(_wakeFd);
+    }
+
+    private void Run()
+    {
+        PollFd[] pollFds =
+        [
+            new PollFd { Fd = _inotifyFd, Events = PollIn },
+            new PollFd { Fd = _wakeFd, Events = PollIn }
+        ];
+        long dueTicks = 0;
+        while (!_disposed)
+        {
+            int timeoutMs = -1;
+            if (dueTicks != 0)
+            {
+                long remaining = dueTicks - Stopwatch.GetTimestamp();
+                timeoutMs = remaining <= 0 ? 0 : (int)Math.Ceiling(remaining * 1000.0 / Stopwatch.Frequency);
+            }
+
+            pollFds[0].Revents = 0;
+            pollFds[1].Revents = 0;
+            int result = poll(pollFds, (nuint)pollFds.Length, timeoutMs);
+            int pollError = result < 0 ? Marshal.GetLastWin32Error() : 0;
+            if (result < 0 && pollError != ErrnoInterrupted)
+            {
+                // The fds are unusable. Record the failure before waking waiters so they see it,
+                // rescan once and switch to polling.
+                lock (_signalGate)
+                {
+                    _failure = $"poll() failed: {new Win32Exception(pollError).Message}";
+                }
+
+                Signal();
+                return;
+            }
+
+            if ((pollFds[1].Revents & PollIn) != 0)
+            {
+                _ = read(_wakeFd, _wakeBuffer, (nuint)_wakeBuffer.Length);
+            }
+
+            if ((pollFds[0].Revents & PollIn) != 0 && DrainEvents() && dueTicks == 0)
+            {
+                // Debounce from the first event so a steady stream still settles within the window.
+                dueTicks = Stopwatch.GetTimestamp() + _debounceTicks;
+            }
+
+            if (dueTicks != 0 && Stopwatch.GetTimestamp() >= dueTicks)
+            {
+                dueTicks = 0;
+                Signal();
+            }
+        }
+    }
+
+    private bool DrainEvents()
+    {
+        bool relevant = false;
+        while (true)
+        {
+            nint length = read(_inotifyFd, _readBuffer, (nuint)_readBuffer.Length);
+            if (length <= 0)
+            {
+                int error = length < 0 ? Marshal.GetLastWin32Error() : 0;
+                if (error == ErrnoInterrupted)
+                {
+                    continue;
+                }
+
+                return relevant || (error != 0 && error != ErrnoWouldBlock);
+            }
+
+            ReadOnlySpan<byte> buffer = _readBuffer.AsSpan(0, (int)length);
+            lock (_watchGate)
+            {
+                while (buffer.Length >= EventHeaderSize)
+                {
+                    int wd = BinaryPrimitives.ReadInt32LittleEndian(buffer);
+                    uint mask = BinaryPrimitives.ReadUInt32LittleEndian(buffer[4..]);
+                    int nameLength = (int)BinaryPrimitives.ReadUInt32LittleEndian(buffer[12..]);
+                    ReadOnlySpan<byte> name = buffer.Slice(EventHeaderSize, nameLength);
+                    int terminator = name.IndexOf((byte)0);
+                    if (terminator >= 0)
+                    {
+                        name = name[..terminator];
+                    }
+
+                    relevant |= IsRelevant(wd, mask, name);
+                    buffer = buffer[(EventHeaderSize + nameLength)..];
+                }
+            }
+        }
+    }
+
+    private bool IsRelevant(int wd, uint mask, ReadOnlySpan<byte> name)
+    {
+        if ((mask & InQueueOverflow) != 0)
+        {
+            return true;
+        }
+
+        if (!_watches.TryGetValue(wd, out WatchedDirectory? entry))
+        {
+            return false;
+        }
+
+        if ((mask & InIgnored) != 0)
+        {
+            // The directory itself went away; the caller's next Watch re-arms it.
+            _watches.Remove(wd);
+            return true;
+        }
+
+        if (entry.AnyEntry)
+        {
+            return true;
+        }
+
+        return (mask & FileEntryMask) != 0 && entry.Names.Contains(Encoding.UTF8.GetString(name));
+    }
+
+    private void Signal()
+    {
+        TaskCompletionSource completed;
+        lock (_signalGate)
+        {
+            _changeSequence++;
+            completed = _changed;
+            _changed = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+        }
+
+        completed.TrySetResult();
+    }
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int inotify_init1(int flags);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int inotify_add_watch(int fd, string pathname, uint mask);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int inotify_rm_watch(int fd, int wd);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int eventfd(uint initval, int flags);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int poll([In, Out] PollFd[] fds, nuint nfds, int timeout);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint read(int fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint write(int fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int close(int fd);
+
+    private sealed class WatchedDirectory(string path)
+    {
+        public string Path { get; } = path;
+
+        public HashSet<string> Names { get; } = new(StringComparer.Ordinal);
+
+        public bool AnyEntry { get; set; }
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct PollFd
+    {
+        public int Fd;
+        public short Events;
+        public short Revents;
+    }
+}
@@ -0,0 +1,181 @@
+using System.ComponentModel;
+using System.Runtime.InteropServices;
+
+namespace GlassToKey.Platform.Linux.Devices;
+
+// Listens on a NETLINK_KOBJECT_UEVENT socket without libudev. It joins both the kernel group,
+// which fires as soon as a node exists, and the udevd group, which follows once permissions
+// and /dev/input/by-id links (the stable IDs) are in place.
+internal sealed class LinuxNetlinkUeventSource : ILinuxUeventSource
+{
+    private const int AddressFamilyNetlink = 16;
+    private const int SocketDatagram = 2;
+    private const int SocketNonBlocking = 0x800;
+    private const int SocketCloexec = 0x80000;
+    private const int NetlinkKobjectUevent = 15;
+    private const uint KernelGroup = 1;
+    private const uint UdevGroup = 2;
+    private const int EventFdCloexec = 0x80000;
+    private const int EventFdNonBlocking = 0x800;
+    private const short PollIn = 0x001;
+    private const int ErrnoInterrupted = 4;
+    private const int ErrnoNoBufferSpace = 105;
+
+    private readonly int _socketFd;
+    private readonly int _wakeFd;
+    private readonly byte[] _receiveBuffer = new byte[16 * 1024];
+    private readonly byte[] _wakeValue = BitConverter.GetBytes(1UL);
+    private Thread? _thread;
+    private volatile bool _disposed;
+
+    public LinuxNetlinkUeventSource()
+    {
+        _socketFd = socket(AddressFamilyNetlink, SocketDatagram | SocketNonBlocking | SocketCloexec, NetlinkKobjectUevent);
+        if (_socketFd < 0)
+        {
+            throw new IOException($"socket(NETLINK_KOBJECT_UEVENT) failed: {new Win32Exception(Marshal.GetLastWin32Error()).Message}");
+        }
+
+        // struct sockaddr_nl { sa_family_t nl_family; unsigned short nl_pad; __u32 nl_pid; __u32 nl_groups; }
+        byte[] address = new byte[12];
+        BitConverter.TryWriteBytes(address.AsSpan(0, 2), (ushort)AddressFamilyNetlink);
+        BitConverter.TryWriteBytes(address.AsSpan(8, 4), KernelGroup | UdevGroup);
+        if (bind(_socketFd, address, (uint)address.Length) < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            close(_socketFd);
+            throw new IOException($"bind(NETLINK_KOBJECT_UEVENT) failed: {new Win32Exception(error).Message}");
+        }
+
+        _wakeFd = eventfd(0, EventFdCloexec | EventFdNonBlocking);
+        if (_wakeFd < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            close(_socketFd);
+            throw new IOException($"eventfd() failed: {new Win32Exception(error).Message}");
+        }
+    }
+
+    public void Start(Action<LinuxUevent> onUevent)
+    {
+        ArgumentNullException.ThrowIfNull(onUevent);
+        ObjectDisposedException.ThrowIf(_disposed, this);
+        if (_thread != null)
+        {
+            throw new InvalidOperationException("The uevent source is already started.");
+        }
+
+        _thread = new Thread(() => Run(onUevent))
+        {
+            IsBackground = true,
+            Name = "GlassToKey.Uevent"
+        };
+        _thread.Start();
+    }
+
+    public void Dispose()
+    {
+        if (_disposed)
+        {
+            return;
+        }
+
+        _disposed = true;
+        _ = write(_wakeFd, _wakeValue, (nuint)_wakeValue.Length);
+        if (_thread != null && Thread.CurrentThread != _thread)
+        {
+            _thread.Join();
+        }
+
+        close(_socketFd);
+        close(_wakeFd);
+    }
+
+    private void Run(Action<LinuxUevent> onUevent)
+    {
+        PollFd[] pollFds =
+        [
+            new PollFd { Fd = _socketFd, Events = PollIn },
+            new PollFd { Fd = _wakeFd, Events = PollIn }
+        ];
+        while (!_disposed)
+        {
+            pollFds[0].Revents = 0;
+            pollFds[1].Revents = 0;
+            if (poll(pollFds, (nuint)pollFds.Length, -1) < 0)
+            {
+                if (Marshal.GetLastWin32Error() == ErrnoInterrupted)
+                {
+                    continue;
+                }
+
+                return;
+            }
+
+            if ((pollFds[0].Revents & PollIn) != 0)
+            {
+                Drain(onUevent);
+            }
+        }
+    }
+
+    private void Drain(Action<LinuxUevent> onUevent)
+    {
+        while (!_disposed)
+        {
+            nint length = read(_socketFd, _receiveBuffer, (nuint)_receiveBuffer.Length);
+            if (length < 0)
+            {
+                int error = Marshal.GetLastWin32Error();
+                if (error == ErrnoInterrupted)
+                {
+                    continue;
+                }
+
+                if (error == ErrnoNoBufferSpace)
+                {
+                    // The socket overflowed and events were lost; report an unknown input change.
+                    onUevent(new LinuxUevent("change", "input", DevName: null, DevPath: null));
+                    continue;
+                }
+
+                // EAGAIN means drained; any other error also waits for the next readiness.
+                return;
+            }
+
+            if (length > 0 && LinuxUevent.TryParse(_receiveBuffer.AsSpan(0, (int)length), out LinuxUevent uevent))
+            {
+                onUevent(uevent);
+            }
+        }
+    }
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int socket(int domain, int type, int protocol);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int bind(int sockfd, byte[] addr, uint addrlen);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int eventfd(uint initval, int flags);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int poll([In, Out] PollFd[] fds, nuint nfds, int timeout);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint read(int fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint write(int fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int close(int fd);
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct PollFd
+    {
+        public int Fd;
+        public short Events;
+        public short Revents;
+    }
+}
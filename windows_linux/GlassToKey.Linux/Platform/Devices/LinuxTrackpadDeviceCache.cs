@@ -0,0 +1,127 @@
+using System.Diagnostics;
+using GlassToKey.Platform.Linux.Contracts;
+using GlassToKey.Platform.Linux.Models;
+
+namespace GlassToKey.Platform.Linux.Devices;
+
+// Keeps the last trackpad enumeration until an input uevent says something changed, so a
+// binding waiting for its device does not re-probe sysfs on every retry. Without a working
+// uevent source every call enumerates, as before. Entries also expire after MaxAge in case
+// uevents are not delivered (e.g. a network namespace that does not receive them).
+internal sealed class LinuxTrackpadDeviceCache : ILinuxTrackpadBackend, IDisposable
+{
+    public static readonly TimeSpan DefaultMaxAge = TimeSpan.FromSeconds(10);
+
+    private readonly object _gate = new();
+    private readonly ILinuxTrackpadBackend _backend;
+    private readonly ILinuxUeventSource? _source;
+    private readonly long _maxAgeTicks;
+    private IReadOnlyList<LinuxInputDeviceDescriptor>? _devices;
+    private long _enumeratedTicks;
+    private long _generation;
+    private int _enumerationCount;
+    private TaskCompletionSource _changed = new(TaskCreationOptions.RunContinuationsAsynchronously);
+
+    public LinuxTrackpadDeviceCache(ILinuxTrackpadBackend backend, ILinuxUeventSource? source, TimeSpan maxAge)
+    {
+        _backend = backend;
+        _maxAgeTicks = (long)(maxAge.TotalSeconds * Stopwatch.Frequency);
+        if (source != null)
+        {
+            try
+            {
+                source.Start(OnUevent);
+                _source = source;
+            }
+            catch (Exception ex) when (ex is IOException or InvalidOperationException)
+            {
+                source.Dispose();
+            }
+        }
+    }
+
+    // Raised on the uevent thread after the cache was invalidated.
+    public event Action? Changed;
+
+    public bool IsLive => _source != null;
+
+    public long Generation
+    {
+        get
+        {
+            lock (_gate)
+            {
+                return _generation;
+            }
+        }
+    }
+
+    public int EnumerationCount => Volatile.Read(ref _enumerationCount);
+
+    public IReadOnlyList<LinuxInputDeviceDescriptor> EnumerateDevices()
+    {
+        long generation;
+        lock (_gate)
+        {
+            if (_devices != null && Stopwatch.GetTimestamp() - _enumeratedTicks < _maxAgeTicks)
+            {
+                return _devices;
+            }
+
+            generation = _generation;
+        }
+
+        // Probe outside the lock; a uevent that lands meanwhile makes this result stale, so it
+        // is only kept when the generation did not move.
+        Interlocked.Increment(ref _enumerationCount);
+        IReadOnlyList<LinuxInputDeviceDescriptor> devices = _backend.EnumerateDevices();
+        if (IsLive)
+        {
+            lock (_gate)
+            {
+                if (_generation == generation)
+                {
+                    _devices = devices;
+                    _enumeratedTicks = Stopwatch.GetTimestamp();
+                }
+            }
+        }
+
+        return devices;
+    }
+
+    // Completes once Generation moves past observedGeneration; never completes without a
+    // live uevent source.
+    public Task WaitForChangeAsync(long observedGeneration)
+    {
+        lock (_gate)
+        {
+            return _generation != observedGeneration ? Task.CompletedTask : _changed.Task;
+        }
+    }
+
+    public void Dispose()
+    {
+        _source?.Dispose();
+    }
+
+    private void OnUevent(LinuxUevent uevent)
+    {
+        if (!uevent.IsInputDevice)
+        {
+            return;
+        }
+
+        TaskCompletionSource completed;
+        lock (_gate)
+        {
+            _devices = null;
+            _generation++;
+            completed = _changed;
+            _changed = new TaskCompletionSource(TaskCreationOptions.RunContinuationsAsynchronously);
+        }
+
+        completed.TrySetResult();
+        Changed?.Invoke();
+    }
+}
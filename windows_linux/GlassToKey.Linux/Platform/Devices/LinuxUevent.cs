@@ -0,0 +1,92 @@
+using System.Buffers.Binary;
+using System.Text;
+
+namespace GlassToKey.Platform.Linux.Devices;
+
+// One NETLINK_KOBJECT_UEVENT message, reduced to the properties hotplug handling needs.
+internal readonly record struct LinuxUevent(string Action, string Subsystem, string? DevName, string? DevPath)
+{
+    private const uint UdevMonitorMagic = 0xfeedcafe;
+    private const int UdevHeaderPropertiesOffset = 16;
+    private static ReadOnlySpan<byte> UdevPrefix => "libudev\0"u8;
+
+    public bool IsInputDevice => string.Equals(Subsystem, "input", StringComparison.Ordinal);
+
+    // Accepts both the kernel format ("action@devpath" then KEY=VALUE strings) and the
+    // udevd re-broadcast, which puts a "libudev" header in front of the same properties.
+    public static bool TryParse(ReadOnlySpan<byte> message, out LinuxUevent uevent)
+    {
+        uevent = default;
+        ReadOnlySpan<byte> properties;
+        if (message.StartsWith(UdevPrefix))
+        {
+            if (message.Length < UdevHeaderPropertiesOffset + 8 ||
+                BinaryPrimitives.ReadUInt32BigEndian(message[UdevPrefix.Length..]) != UdevMonitorMagic)
+            {
+                return false;
+            }
+
+            int offset = BinaryPrimitives.ReadInt32LittleEndian(message[UdevHeaderPropertiesOffset..]);
+            int length = BinaryPrimitives.ReadInt32LittleEndian(message[(UdevHeaderPropertiesOffset + 4)..]);
+            if (offset < 0 || length < 0 || offset > message.Length || length > message.Length - offset)
+            {
+                return false;
+            }
+
+            properties = message.Slice(offset, length);
+        }
+        else
+        {
+            int headerEnd = message.IndexOf((byte)0);
+            if (headerEnd < 0 || message[..headerEnd].IndexOf((byte)'@') < 0)
+            {
+                return false;
+            }
+
+            properties = message[(headerEnd + 1)..];
+        }
+
+        string? action = null;
+        string? subsystem = null;
+        string? devName = null;
+        string? devPath = null;
+        while (!properties.IsEmpty)
+        {
+            int end = properties.IndexOf((byte)0);
+            ReadOnlySpan<byte> property = end < 0 ? properties : properties[..end];
+            properties = end < 0 ? default : properties[(end + 1)..];
+            int separator = property.IndexOf((byte)'=');
+            if (separator <= 0)
+            {
+                continue;
+            }
+
+            ReadOnlySpan<byte> key = property[..separator];
+            ReadOnlySpan<byte> value = property[(separator + 1)..];
+            if (key.SequenceEqual("ACTION"u8))
+            {
+                action = Encoding.UTF8.GetString(value);
+            }
+            else if (key.SequenceEqual("SUBSYSTEM"u8))
+            {
+                subsystem = Encoding.UTF8.GetString(value);
+            }
+            else if (key.SequenceEqual("DEVNAME"u8))
+            {
+                devName = Encoding.UTF8.GetString(value);
+            }
+            else if (key.SequenceEqual("DEVPATH"u8))
+            {
+                devPath = Encoding.UTF8.GetString(value);
+            }
+        }
+
+        if (action == null || subsystem == null)
+        {
+            return false;
+        }
+
+        uevent = new LinuxUevent(action, subsystem, devName, devPath);
+        return true;
+    }
+}
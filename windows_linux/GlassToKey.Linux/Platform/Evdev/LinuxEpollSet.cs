@@ -0,0 +1,158 @@
+using System.Buffers.Binary;
+using System.ComponentModel;
+using System.Runtime.InteropServices;
+
+namespace GlassToKey.Platform.Linux.Evdev;
+
+// Minimal epoll wrapper with an eventfd so another thread can interrupt a blocked Wait.
+internal sealed class LinuxEpollSet : IDisposable
+{
+    private const int EpollCloexec = 0x80000;
+    private const int EventFdCloexec = 0x80000;
+    private const int EventFdNonBlocking = 0x800;
+    private const int EpollCtlAdd = 1;
+    private const int EpollCtlDelete = 2;
+    private const uint EpollIn = 0x001;
+    private const int ErrnoInterrupted = 4;
+    private const ulong WakeToken = ulong.MaxValue;
+
+    // struct epoll_event is packed on x86-64 only; every other ABI pads the data union to 8 bytes.
+    private static readonly int EventSize = RuntimeInformation.ProcessArchitecture == Architecture.X64 ? 12 : 16;
+    private static readonly int EventDataOffset = RuntimeInformation.ProcessArchitecture == Architecture.X64 ? 4 : 8;
+
+    private readonly object _gate = new();
+    private readonly int _epollFd;
+    private readonly int _wakeFd;
+    private readonly byte[] _controlBuffer = new byte[16];
+    private readonly byte[] _waitBuffer;
+    private readonly byte[] _wakeBuffer = new byte[sizeof(ulong)];
+    private readonly byte[] _wakeValue = BitConverter.GetBytes(1UL);
+    private bool _disposed;
+
+    public LinuxEpollSet(int capacity)
+    {
+        _waitBuffer = new byte[EventSize * Math.Max(1, capacity + 1)];
+        _epollFd = epoll_create1(EpollCloexec);
+        if (_epollFd < 0)
+        {
+            throw new IOException($"epoll_create1() failed: {new Win32Exception(Marshal.GetLastWin32Error()).Message}");
+        }
+
+        _wakeFd = eventfd(0, EventFdCloexec | EventFdNonBlocking);
+        if (_wakeFd < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            close(_epollFd);
+            throw new IOException($"eventfd() failed: {new Win32Exception(error).Message}");
+        }
+
+        Control(EpollCtlAdd, _wakeFd, WakeToken);
+    }
+
+    public void Add(int fd, int token)
+    {
+        Control(EpollCtlAdd, fd, (ulong)token);
+    }
+
+    public void Remove(int fd)
+    {
+        // The fd may already be gone after an unplug; closing it removes it from the set anyway.
+        _ = epoll_ctl(_epollFd, EpollCtlDelete, fd, _controlBuffer);
+    }
+
+    // Blocks until at least one registered fd is readable, Wake is called, or the timeout
+    // elapses. Writes ready tokens into readyTokens and returns how many were written.
+    public int Wait(Span<int> readyTokens, int timeoutMs)
+    {
+        int maxEvents = Math.Min(readyTokens.Length + 1, _waitBuffer.Length / EventSize);
+        int result = epoll_wait(_epollFd, _waitBuffer, maxEvents, timeoutMs);
+        if (result < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            if (error == ErrnoInterrupted)
+            {
+                return 0;
+            }
+
+            throw new IOException($"epoll_wait() failed: {new Win32Exception(error).Message}");
+        }
+
+        int readyCount = 0;
+        for (int index = 0; index < result; index++)
+        {
+            ulong token = BinaryPrimitives.ReadUInt64LittleEndian(_waitBuffer.AsSpan((index * EventSize) + EventDataOffset, sizeof(ulong)));
+            if (token == WakeToken)
+            {
+                _ = read(_wakeFd, _wakeBuffer, (nuint)_wakeBuffer.Length);
+                continue;
+            }
+
+            if (readyCount < readyTokens.Length)
+            {
+                readyTokens[readyCount++] = (int)token;
+            }
+        }
+
+        return readyCount;
+    }
+
+    public void Wake()
+    {
+        lock (_gate)
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            _ = write(_wakeFd, _wakeValue, (nuint)_wakeValue.Length);
+        }
+    }
+
+    public void Dispose()
+    {
+        lock (_gate)
+        {
+            if (_disposed)
+            {
+                return;
+            }
+
+            _disposed = true;
+            close(_wakeFd);
+            close(_epollFd);
+        }
+    }
+
+    private void Control(int operation, int fd, ulong token)
+    {
+        Array.Clear(_controlBuffer);
+        BinaryPrimitives.WriteUInt32LittleEndian(_controlBuffer, EpollIn);
+        BinaryPrimitives.WriteUInt64LittleEndian(_controlBuffer.AsSpan(EventDataOffset, sizeof(ulong)), token);
+        if (epoll_ctl(_epollFd, operation, fd, _controlBuffer) < 0)
+        {
+            throw new IOException($"epoll_ctl({operation}, fd={fd}) failed: {new Win32Exception(Marshal.GetLastWin32Error()).Message}");
+        }
+    }
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int epoll_create1(int flags);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int epoll_ctl(int epfd, int op, int fd, byte[] epollEvent);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int epoll_wait(int epfd, byte[] events, int maxevents, int timeout);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int eventfd(uint initval, int flags);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint read(int fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint write(int fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int close(int fd);
+}
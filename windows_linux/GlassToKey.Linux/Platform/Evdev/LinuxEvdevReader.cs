@@ -12,6 +12,8 @@ public sealed class LinuxEvdevReader
     private const int OpenReadOnly = 0x0000;
     private const int OpenNonBlocking = 0x0800;
     private const int ErrnoTryAgain = 11;
+    // Bounds how long an idle readiness wait can hold off cancellation and grab-mode changes.
+    private const int ReadinessWaitTimeoutMs = 50;
     private const uint EviocGrab = 0x40044590;
     private const ushort EventTypeSync = 0x00;
     private const ushort EventTypeKey = 0x01;
@@ -101,6 +103,7 @@ public sealed class LinuxEvdevReader
         string deviceNode,
         TimeSpan duration,
         int maxFrames,
+        LinuxEvdevReadMode readMode = LinuxEvdevReadMode.Readiness,
         CancellationToken cancellationToken = default)
     {
         ArgumentException.ThrowIfNullOrWhiteSpace(deviceNode);
@@ -129,20 +132,65 @@ public sealed class LinuxEvdevReader
                 return ValueTask.FromResult(frames.Count < maxFrames && Stopwatch.GetTimestamp() < deadlineTimestamp);
             },
             shouldGrabExclusiveInput: null,
+            readMode,
             cancellationToken).ConfigureAwait(false);
 
         return frames;
     }
 
-    public async Task StreamFramesAsync(
+    public Task StreamFramesAsync(
         string deviceNode,
         Func<LinuxEvdevFrameSnapshot, ValueTask<bool>> onFrame,
         Func<bool>? shouldGrabExclusiveInput,
+        LinuxEvdevReadMode readMode,
         CancellationToken cancellationToken = default)
     {
         ArgumentException.ThrowIfNullOrWhiteSpace(deviceNode);
         ArgumentNullException.ThrowIfNull(onFrame);
 
+        return readMode == LinuxEvdevReadMode.Polling
+            ? StreamFramesPollingAsync(deviceNode, onFrame, shouldGrabExclusiveInput, cancellationToken)
+            : StreamFramesReadinessAsync(deviceNode, onFrame, shouldGrabExclusiveInput, cancellationToken);
+    }
+
+    // "Now" in microseconds since the Unix epoch: the raw CLOCK_REALTIME domain evdev stamps
+    // events with.
+    public static long GetEventClockMicroseconds()
+    {
+        return (DateTime.UtcNow - DateTime.UnixEpoch).Ticks / TimeSpan.TicksPerMicrosecond;
+    }
+
+    // Converts "now" into the same CLOCK_REALTIME-derived tick domain that evdev event
+    // timestamps use, so callers can measure kernel-to-reader delivery latency.
+    public static long GetEventClockTimestamp()
+    {
+        return MicrosecondsToTicks(GetEventClockMicroseconds());
+    }
+
+    // Stamps a committed frame for pipeline latency. The event's age is taken on the raw
+    // microsecond clock and only that small difference becomes Stopwatch ticks, which then
+    // moves the kernel time into the Stopwatch domain.
+    internal static PipelineTimestamps StampCommit(long eventMicroseconds)
+    {
+        long commitTicks = Stopwatch.GetTimestamp();
+        long ageMicroseconds = Math.Max(0, GetEventClockMicroseconds() - eventMicroseconds);
+        return new PipelineTimestamps(KernelTicks: commitTicks - MicrosecondsToTicks(ageMicroseconds), CommitTicks: commitTicks);
+    }
+
+    // Whole seconds are scaled separately: epoch microseconds times a 1 GHz Stopwatch
+    // frequency does not fit in a long.
+    internal static long MicrosecondsToTicks(long microseconds)
+    {
+        long seconds = Math.DivRem(microseconds, 1_000_000L, out long remainder);
+        return (seconds * Stopwatch.Frequency) + (remainder * Stopwatch.Frequency / 1_000_000L);
+    }
+
+    private async Task StreamFramesPollingAsync(
+        string deviceNode,
+        Func<LinuxEvdevFrameSnapshot, ValueTask<bool>> onFrame,
+        Func<bool>? shouldGrabExclusiveInput,
+        CancellationToken cancellationToken)
+    {
         using SafeFileHandle handle = OpenNonBlockingHandle(deviceNode);
         LinuxTrackpadAxisProfile axisProfile = GetAxisProfile(handle);
         LinuxMtFrameAssembler assembler = new(
@@ -222,6 +270,7 @@ public sealed class LinuxEvdevReader
                 continue;
             }
 
+            long eventMicroseconds = ToEventMicroseconds(inputEvent);
             LinuxEvdevFrameSnapshot snapshot = new(
                 DeviceNode: deviceNode,
                 MinX: axisProfile.MinX,
@@ -229,7 +278,8 @@ public sealed class LinuxEvdevReader
                 MaxX: axisProfile.MaxX,
                 MaxY: axisProfile.MaxY,
                 FrameSequence: assembler.FrameSequence,
-                Frame: assembler.CommitFrame(ToStopwatchTicks(inputEvent)));
+                Frame: assembler.CommitFrame(MicrosecondsToTicks(eventMicroseconds)),
+                Timestamps: StampCommit(eventMicroseconds));
             bool shouldContinue = await onFrame(snapshot).ConfigureAwait(false);
             if (!shouldContinue)
             {
@@ -238,6 +288,101 @@ public sealed class LinuxEvdevReader
         }
     }
 
+    // The readiness wait is a blocking poll(), so the loop gets its own thread rather than
+    // holding a thread-pool thread for the lifetime of the stream.
+    private static Task StreamFramesReadinessAsync(
+        string deviceNode,
+        Func<LinuxEvdevFrameSnapshot, ValueTask<bool>> onFrame,
+        Func<bool>? shouldGrabExclusiveInput,
+        CancellationToken cancellationToken)
+    {
+        TaskCompletionSource completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        Thread thread = new(() =>
+        {
+            try
+            {
+                RunReadinessLoop(deviceNode, onFrame, shouldGrabExclusiveInput, cancellationToken);
+                completion.TrySetResult();
+            }
+            catch (Exception ex)
+            {
+                completion.TrySetException(ex);
+            }
+        })
+        {
+            IsBackground = true,
+            Name = "GlassToKey.EvdevStream"
+        };
+        thread.Start();
+        return completion.Task;
+    }
+
+    private static void RunReadinessLoop(
+        string deviceNode,
+        Func<LinuxEvdevFrameSnapshot, ValueTask<bool>> onFrame,
+        Func<bool>? shouldGrabExclusiveInput,
+        CancellationToken cancellationToken)
+    {
+        using LinuxEvdevStream stream = LinuxEvdevStream.Open(deviceNode);
+        while (!cancellationToken.IsCancellationRequested)
+        {
+            stream.UpdateExclusiveGrab(shouldGrabExclusiveInput?.Invoke() == true);
+            if (!stream.ReadBatch())
+            {
+                stream.WaitForReadable(ReadinessWaitTimeoutMs);
+                continue;
+            }
+
+            while (stream.TryReadFrame(out LinuxEvdevFrameSnapshot snapshot))
+            {
+                // Only this device's stream thread waits on a sink that completes asynchronously.
+                ValueTask<bool> pending = onFrame(snapshot);
+                bool shouldContinue = pending.IsCompletedSuccessfully
+                    ? pending.Result
+                    : pending.AsTask().GetAwaiter().GetResult();
+                if (!shouldContinue)
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    internal const int InputEventSize = InputEvent.Size;
+
+    internal static bool TryApplyEvent(
+        LinuxMtFrameAssembler assembler,
+        LinuxTrackpadAxisProfile axisProfile,
+        ReadOnlySpan<byte> eventBytes,
+        string deviceNode,
+        out long eventMicroseconds)
+    {
+        InputEvent inputEvent = MemoryMarshal.Read<InputEvent>(eventBytes);
+        if (inputEvent.Type == EventTypeSync && inputEvent.Code == SyncDropped)
+        {
+            throw new IOException($"evdev reported SYN_DROPPED on '{deviceNode}'; rebinding stream.");
+        }
+
+        if (!ApplyEvent(assembler, axisProfile, in inputEvent))
+        {
+            eventMicroseconds = 0;
+            return false;
+        }
+
+        eventMicroseconds = ToEventMicroseconds(inputEvent);
+        return true;
+    }
+
+    // Raw decode for nodes that are not multitouch trackpads (the uinput loopback device).
+    internal static void DecodeEvent(ReadOnlySpan<byte> eventBytes, out ushort type, out ushort code, out int value, out long eventMicroseconds)
+    {
+        InputEvent inputEvent = MemoryMarshal.Read<InputEvent>(eventBytes);
+        type = inputEvent.Type;
+        code = inputEvent.Code;
+        value = inputEvent.Value;
+        eventMicroseconds = ToEventMicroseconds(inputEvent);
+    }
+
     private static bool ApplyEvent(LinuxMtFrameAssembler assembler, LinuxTrackpadAxisProfile axisProfile, in InputEvent inputEvent)
     {
         switch (inputEvent.Type)
@@ -295,7 +440,7 @@ public sealed class LinuxEvdevReader
         return new LinuxInputAxisInfo(absInfo.Value, absInfo.Minimum, absInfo.Maximum, absInfo.Fuzz, absInfo.Flat, absInfo.Resolution);
     }
 
-    private static LinuxTrackpadAxisProfile GetAxisProfile(SafeFileHandle handle)
+    internal static LinuxTrackpadAxisProfile GetAxisProfile(SafeFileHandle handle)
     {
         LinuxInputAxisInfo? slotAxis = TryGetAxisInfo(handle, AbsMtSlot);
         LinuxInputAxisInfo? mtX = TryGetAxisInfo(handle, AbsMtPositionX);
@@ -325,7 +470,7 @@ public sealed class LinuxEvdevReader
         }
     }
 
-    private static SafeFileHandle OpenNonBlockingHandle(string deviceNode)
+    internal static SafeFileHandle OpenNonBlockingHandle(string deviceNode)
     {
         int fd = open(deviceNode, OpenReadOnly | OpenNonBlocking);
         if (fd < 0)
@@ -336,10 +481,9 @@ public sealed class LinuxEvdevReader
         return new SafeFileHandle((IntPtr)fd, ownsHandle: true);
     }
 
-    private static long ToStopwatchTicks(InputEvent inputEvent)
+    private static long ToEventMicroseconds(InputEvent inputEvent)
     {
-        long microseconds = checked((inputEvent.Seconds * 1_000_000L) + inputEvent.Microseconds);
-        return (microseconds * Stopwatch.Frequency) / 1_000_000L;
+        return checked((inputEvent.Seconds * 1_000_000L) + inputEvent.Microseconds);
     }
 
     private static string FormatRawEvent(InputEvent inputEvent)
@@ -397,7 +541,7 @@ public sealed class LinuxEvdevReader
         public readonly int Value;
     }
 
-    private static void SetExclusiveGrab(SafeFileHandle handle, bool shouldGrab, string deviceNode)
+    internal static void SetExclusiveGrab(SafeFileHandle handle, bool shouldGrab, string deviceNode)
     {
         int result = ioctl(handle, EviocGrab, shouldGrab ? 1 : 0);
         if (result < 0)
@@ -0,0 +1,179 @@
+using System.ComponentModel;
+using System.Runtime.InteropServices;
+using GlassToKey.Platform.Linux.Models;
+using Microsoft.Win32.SafeHandles;
+
+namespace GlassToKey.Platform.Linux.Evdev;
+
+// One open evdev node in non-blocking mode. Events are drained a batch at a time into a
+// reusable buffer and assembled into frames; callers decide how to wait for readiness.
+public sealed class LinuxEvdevStream : IDisposable
+{
+    private const int ErrnoInterrupted = 4;
+    private const int ErrnoTryAgain = 11;
+    private const short PollIn = 0x0001;
+    private const int BatchEventCapacity = 64;
+
+    private readonly SafeFileHandle _handle;
+    private readonly LinuxTrackpadAxisProfile _axisProfile;
+    private readonly LinuxMtFrameAssembler _assembler;
+    private readonly byte[] _buffer = new byte[LinuxEvdevReader.InputEventSize * BatchEventCapacity];
+    private int _batchCount;
+    private int _batchIndex;
+    private bool _isExclusivelyGrabbed;
+
+    private LinuxEvdevStream(string deviceNode, SafeFileHandle handle, LinuxTrackpadAxisProfile axisProfile)
+    {
+        DeviceNode = deviceNode;
+        _handle = handle;
+        _axisProfile = axisProfile;
+        _assembler = new LinuxMtFrameAssembler(
+            axisProfile.SlotCount,
+            axisProfile.MaxX,
+            axisProfile.MaxY,
+            axisProfile.SupportsPressure);
+    }
+
+    public string DeviceNode { get; }
+
+    public int FileDescriptor => (int)_handle.DangerousGetHandle();
+
+    public static LinuxEvdevStream Open(string deviceNode)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(deviceNode);
+
+        SafeFileHandle handle = LinuxEvdevReader.OpenNonBlockingHandle(deviceNode);
+        try
+        {
+            return new LinuxEvdevStream(deviceNode, handle, LinuxEvdevReader.GetAxisProfile(handle));
+        }
+        catch
+        {
+            handle.Dispose();
+            throw;
+        }
+    }
+
+    public void UpdateExclusiveGrab(bool shouldGrab)
+    {
+        if (shouldGrab == _isExclusivelyGrabbed)
+        {
+            return;
+        }
+
+        LinuxEvdevReader.SetExclusiveGrab(_handle, shouldGrab, DeviceNode);
+        _isExclusivelyGrabbed = shouldGrab;
+    }
+
+    // Reads the next batch of pending events with one read(). Returns false when the node
+    // has nothing queued, after any events left from the previous batch were consumed.
+    public bool ReadBatch()
+    {
+        if (_batchIndex < _batchCount)
+        {
+            return true;
+        }
+
+        _batchIndex = 0;
+        _batchCount = 0;
+        nint bytesRead = read(_handle, _buffer, (nuint)_buffer.Length);
+        if (bytesRead < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            if (error == ErrnoTryAgain || error == ErrnoInterrupted)
+            {
+                return false;
+            }
+
+            throw new IOException($"read() failed for '{DeviceNode}': {new Win32Exception(error).Message}");
+        }
+
+        if (bytesRead == 0)
+        {
+            return false;
+        }
+
+        if (bytesRead % LinuxEvdevReader.InputEventSize != 0)
+        {
+            throw new IOException($"Expected a multiple of {LinuxEvdevReader.InputEventSize} bytes from evdev but read {bytesRead}.");
+        }
+
+        _batchCount = (int)(bytesRead / LinuxEvdevReader.InputEventSize);
+        return true;
+    }
+
+    // Applies buffered events until one completes a frame. Returns false once the current
+    // batch is exhausted; partial slot state carries over into the next batch.
+    public bool TryReadFrame(out LinuxEvdevFrameSnapshot snapshot)
+    {
+        while (_batchIndex < _batchCount)
+        {
+            int offset = _batchIndex * LinuxEvdevReader.InputEventSize;
+            _batchIndex++;
+            if (LinuxEvdevReader.TryApplyEvent(
+                    _assembler,
+                    _axisProfile,
+                    _buffer.AsSpan(offset, LinuxEvdevReader.InputEventSize),
+                    DeviceNode,
+                    out long eventMicroseconds))
+            {
+                snapshot = new LinuxEvdevFrameSnapshot(
+                    DeviceNode: DeviceNode,
+                    MinX: _axisProfile.MinX,
+                    MinY: _axisProfile.MinY,
+                    MaxX: _axisProfile.MaxX,
+                    MaxY: _axisProfile.MaxY,
+                    FrameSequence: _assembler.FrameSequence,
+                    Frame: _assembler.CommitFrame(LinuxEvdevReader.MicrosecondsToTicks(eventMicroseconds)),
+                    Timestamps: LinuxEvdevReader.StampCommit(eventMicroseconds));
+                return true;
+            }
+        }
+
+        snapshot = null!;
+        return false;
+    }
+
+    public void WaitForReadable(int timeoutMs)
+    {
+        PollFd pollFd = new()
+        {
+            Fd = FileDescriptor,
+            Events = PollIn
+        };
+
+        int result = poll(ref pollFd, 1, timeoutMs);
+        if (result < 0)
+        {
+            int error = Marshal.GetLastWin32Error();
+            if (error == ErrnoInterrupted)
+            {
+                return;
+            }
+
+            throw new IOException($"poll() failed for '{DeviceNode}': {new Win32Exception(error).Message}");
+        }
+
+        // POLLHUP/POLLERR fall through to the next read(), which reports the real errno
+        // (ENODEV on unplug) through the normal disconnect path.
+    }
+
+    public void Dispose()
+    {
+        _handle.Dispose();
+    }
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint read(SafeFileHandle fd, byte[] buffer, nuint count);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern int poll(ref PollFd fds, nuint nfds, int timeout);
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct PollFd
+    {
+        public int Fd;
+        public short Events;
+        public short Revents;
+    }
+}
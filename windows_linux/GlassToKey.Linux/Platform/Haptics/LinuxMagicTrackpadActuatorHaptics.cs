@@ -30,6 +30,7 @@ public sealed class LinuxMagicTrackpadActuatorHaptics : IDisposable
     }
 
     private readonly object _gate = new();
+    private readonly TimeProvider _clock;
     private int _initState;
     private string? _leftTouchHint;
     private string? _rightTouchHint;
@@ -39,6 +40,11 @@ public sealed class LinuxMagicTrackpadActuatorHaptics : IDisposable
     private uint _strength;
     private long _minIntervalTicks;
 
+    public LinuxMagicTrackpadActuatorHaptics(TimeProvider? clock = null)
+    {
+        _clock = clock ?? TimeProvider.System;
+    }
+
     public void Configure(bool enabled, uint strength, int minIntervalMs)
     {
         lock (_gate)
@@ -128,7 +134,7 @@ public sealed class LinuxMagicTrackpadActuatorHaptics : IDisposable
             }
 
             long minInterval = Volatile.Read(ref _minIntervalTicks);
-            long now = Stopwatch.GetTimestamp();
+            long now = _clock.GetTimestamp();
             if (minInterval > 0)
             {
                 long last = device.LastVibrateTicks;
@@ -0,0 +1,388 @@
+using System.Diagnostics;
+using GlassToKey.Platform.Linux.Contracts;
+using GlassToKey.Platform.Linux.Devices;
+using GlassToKey.Platform.Linux.Evdev;
+using GlassToKey.Platform.Linux.Models;
+
+namespace GlassToKey.Platform.Linux;
+
+// Serves every bound trackpad from one thread: all open evdev fds share one epoll set, and
+// frames are delivered synchronously in binding order so left/right interleaving is stable.
+// Resolving a missing device can enumerate sysfs, so that runs on the thread pool and the
+// result is posted back through the epoll wake; only opening the fd happens here.
+internal sealed class LinuxInputReactor
+{
+    // Bounds how long an idle wait can hold off grab-mode changes while streams are open.
+    private const int GrabRefreshTimeoutMs = 50;
+
+    private readonly BindingSlot[] _slots;
+    private readonly LinuxInputRuntimeOptions _options;
+    private readonly LinuxTrackpadDeviceCache? _devices;
+    private readonly Func<string, LinuxInputDeviceDescriptor?> _resolveDevice;
+    private readonly Func<LinuxTrackpadBinding, LinuxEvdevFrameSnapshot, bool> _onFrame;
+    private readonly Func<bool>? _shouldGrabExclusiveInput;
+    private readonly bool _refreshesExclusiveGrab;
+    private volatile bool _devicesChanged;
+
+    public LinuxInputReactor(
+        IReadOnlyList<LinuxTrackpadBinding> bindings,
+        LinuxInputRuntimeOptions options,
+        LinuxTrackpadDeviceCache? devices,
+        Func<string, LinuxInputDeviceDescriptor?> resolveDevice,
+        Func<LinuxTrackpadBinding, LinuxEvdevFrameSnapshot, bool> onFrame)
+    {
+        _slots = new BindingSlot[bindings.Count];
+        for (int index = 0; index < bindings.Count; index++)
+        {
+            _slots[index] = new BindingSlot(bindings[index]);
+        }
+
+        _options = options;
+        _devices = devices;
+        _resolveDevice = resolveDevice;
+        _onFrame = onFrame;
+        _shouldGrabExclusiveInput = LinuxInputRuntimeService.ResolveShouldGrabExclusiveInput(options);
+        _refreshesExclusiveGrab = options.ExclusiveGrabMode == LinuxExclusiveGrabMode.DynamicKeyboardMode &&
+                                  options.ShouldGrabExclusiveInput != null;
+    }
+
+    public Task Start(CancellationToken cancellationToken)
+    {
+        TaskCompletionSource completion = new(TaskCreationOptions.RunContinuationsAsynchronously);
+        Thread thread = new(() =>
+        {
+            try
+            {
+                Run(cancellationToken);
+                completion.TrySetResult();
+            }
+            catch (Exception ex)
+            {
+                completion.TrySetException(ex);
+            }
+        })
+        {
+            IsBackground = true,
+            Name = "GlassToKey.EvdevReactor"
+        };
+        thread.Start();
+        return completion.Task;
+    }
+
+    private void Run(CancellationToken cancellationToken)
+    {
+        using LinuxEpollSet epoll = new(_slots.Length);
+        using CancellationTokenRegistration wakeRegistration = cancellationToken.Register(epoll.Wake);
+        Span<int> readyTokens = stackalloc int[_slots.Length];
+        for (int index = 0; index < _slots.Length; index++)
+        {
+            BindingSlot slot = _slots[index];
+            Report(slot, slot.Binding.Device.DeviceNode, LinuxRuntimeBindingStatus.Starting, "Starting Linux input binding.");
+        }
+
+        // A hotplug uevent cuts any pending reconnect delay short.
+        Action onDevicesChanged = () =>
+        {
+            _devicesChanged = true;
+            epoll.Wake();
+        };
+        if (_devices != null)
+        {
+            _devices.Changed += onDevicesChanged;
+        }
+
+        try
+        {
+            while (!cancellationToken.IsCancellationRequested)
+            {
+                if (_devicesChanged)
+                {
+                    _devicesChanged = false;
+                    for (int index = 0; index < _slots.Length; index++)
+                    {
+                        // A resolve already in flight may have enumerated before the change.
+                        _slots[index].RetryAtTicks = 0;
+                        _slots[index].ResolveStale = _slots[index].Resolving;
+                    }
+                }
+
+                long nowTicks = Stopwatch.GetTimestamp();
+                bool shouldGrab = _shouldGrabExclusiveInput?.Invoke() == true;
+                for (int index = 0; index < _slots.Length; index++)
+                {
+                    BindingSlot slot = _slots[index];
+                    if (slot.Stream == null)
+                    {
+                        ResolveOutcome? outcome = Interlocked.Exchange(ref slot.Resolved, null);
+                        if (outcome != null)
+                        {
+                            slot.Resolving = false;
+                            if (slot.ResolveStale)
+                            {
+                                slot.ResolveStale = false;
+                                BeginResolve(epoll, slot);
+                            }
+                            else
+                            {
+                                TryOpen(epoll, slot, index, outcome, nowTicks);
+                            }
+                        }
+                        else if (!slot.Resolving && nowTicks >= slot.RetryAtTicks)
+                        {
+                            BeginResolve(epoll, slot);
+                        }
+                    }
+
+                    if (slot.Stream != null)
+                    {
+                        UpdateExclusiveGrab(epoll, slot, shouldGrab);
+                    }
+                }
+
+                int readyCount = epoll.Wait(readyTokens, ComputeWaitTimeoutMs(Stopwatch.GetTimestamp()));
+                if (readyCount == 0)
+                {
+                    continue;
+                }
+
+                // epoll reports in kernel order; service ready bindings in binding order instead.
+                readyTokens[..readyCount].Sort();
+                for (int readyIndex = 0; readyIndex < readyCount && !cancellationToken.IsCancellationRequested; readyIndex++)
+                {
+                    BindingSlot slot = _slots[readyTokens[readyIndex]];
+                    if (slot.Stream != null)
+                    {
+                        DrainBatch(epoll, slot, cancellationToken);
+                    }
+                }
+            }
+        }
+        finally
+        {
+            if (_devices != null)
+            {
+                _devices.Changed -= onDevicesChanged;
+            }
+
+            for (int index = 0; index < _slots.Length; index++)
+            {
+                BindingSlot slot = _slots[index];
+                CloseStream(epoll, slot);
+                Report(slot, slot.ActiveDeviceNode, LinuxRuntimeBindingStatus.Stopped, "Stopped Linux input binding.");
+            }
+        }
+    }
+
+    private void BeginResolve(LinuxEpollSet epoll, BindingSlot slot)
+    {
+        slot.Resolving = true;
+        string stableId = slot.Binding.Device.StableId;
+        _ = Task.Run(() =>
+        {
+            ResolveOutcome outcome;
+            try
+            {
+                outcome = new ResolveOutcome(_resolveDevice(stableId), null);
+            }
+            catch (Exception ex)
+            {
+                outcome = new ResolveOutcome(null, ex);
+            }
+
+            Volatile.Write(ref slot.Resolved, outcome);
+            // A no-op once the reactor has stopped and disposed the set.
+            epoll.Wake();
+        });
+    }
+
+    private void TryOpen(LinuxEpollSet epoll, BindingSlot slot, int token, ResolveOutcome outcome, long nowTicks)
+    {
+        if (outcome.Error != null)
+        {
+            HandleStreamFault(epoll, slot, outcome.Error);
+            return;
+        }
+
+        LinuxInputDeviceDescriptor? currentDevice = outcome.Device;
+        if (currentDevice == null)
+        {
+            Report(slot, slot.ActiveDeviceNode, LinuxRuntimeBindingStatus.WaitingForDevice, "Waiting for trackpad to reappear.");
+            slot.ActiveDeviceNode = null;
+            ScheduleRetry(slot, nowTicks);
+            return;
+        }
+
+        if (!currentDevice.CanOpenEventStream)
+        {
+            Report(slot, currentDevice.DeviceNode, LinuxRuntimeBindingStatus.WaitingForDevice, currentDevice.AccessError);
+            slot.ActiveDeviceNode = currentDevice.DeviceNode;
+            ScheduleRetry(slot, nowTicks);
+            return;
+        }
+
+        if (!string.Equals(slot.ActiveDeviceNode, currentDevice.DeviceNode, StringComparison.OrdinalIgnoreCase))
+        {
+            Report(slot, currentDevice.DeviceNode, LinuxRuntimeBindingStatus.Rebinding, "Opening trackpad event stream.");
+            slot.ActiveDeviceNode = currentDevice.DeviceNode;
+        }
+
+        slot.ActiveBinding = new LinuxTrackpadBinding(slot.Binding.Side, currentDevice);
+        try
+        {
+            slot.Stream = LinuxEvdevStream.Open(currentDevice.DeviceNode);
+            epoll.Add(slot.Stream.FileDescriptor, token);
+        }
+        catch (Exception ex)
+        {
+            HandleStreamFault(epoll, slot, ex);
+            return;
+        }
+
+        Report(slot, currentDevice.DeviceNode, LinuxRuntimeBindingStatus.Streaming, "Streaming evdev frames.");
+    }
+
+    private void DrainBatch(LinuxEpollSet epoll, BindingSlot slot, CancellationToken cancellationToken)
+    {
+        try
+        {
+            // One read() per wakeup keeps a busy trackpad from starving the other side;
+            // epoll is level-triggered, so anything left over is reported again immediately.
+            LinuxEvdevStream stream = slot.Stream!;
+            if (!stream.ReadBatch())
+            {
+                return;
+            }
+
+            while (stream.TryReadFrame(out LinuxEvdevFrameSnapshot snapshot))
+            {
+                if (!_onFrame(slot.ActiveBinding!, snapshot) || cancellationToken.IsCancellationRequested)
+                {
+                    return;
+                }
+            }
+        }
+        catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
+        {
+            // Normal shutdown path for timed runs and process exit.
+        }
+        catch (Exception ex)
+        {
+            HandleStreamFault(epoll, slot, ex);
+        }
+    }
+
+    private void UpdateExclusiveGrab(LinuxEpollSet epoll, BindingSlot slot, bool shouldGrab)
+    {
+        try
+        {
+            slot.Stream!.UpdateExclusiveGrab(shouldGrab);
+        }
+        catch (Exception ex)
+        {
+            HandleStreamFault(epoll, slot, ex);
+        }
+    }
+
+    private void HandleStreamFault(LinuxEpollSet epoll, BindingSlot slot, Exception ex)
+    {
+        CloseStream(epoll, slot);
+        switch (ex)
+        {
+            case IOException:
+                Report(slot, slot.ActiveDeviceNode, LinuxRuntimeBindingStatus.Disconnected, ex.Message);
+                break;
+            case UnauthorizedAccessException:
+                Report(slot, slot.ActiveDeviceNode, LinuxRuntimeBindingStatus.Faulted, ex.Message);
+                break;
+            default:
+                Report(slot, slot.ActiveDeviceNode, LinuxRuntimeBindingStatus.Faulted, $"{ex.GetType().Name}: {ex.Message}");
+                break;
+        }
+
+        ScheduleRetry(slot, Stopwatch.GetTimestamp());
+    }
+
+    private static void CloseStream(LinuxEpollSet epoll, BindingSlot slot)
+    {
+        if (slot.Stream == null)
+        {
+            return;
+        }
+
+        epoll.Remove(slot.Stream.FileDescriptor);
+        slot.Stream.Dispose();
+        slot.Stream = null;
+    }
+
+    private void ScheduleRetry(BindingSlot slot, long nowTicks)
+    {
+        long delayTicks = (long)(Math.Max(0, _options.ReconnectDelay.TotalSeconds) * Stopwatch.Frequency);
+        slot.RetryAtTicks = nowTicks + delayTicks;
+    }
+
+    private int ComputeWaitTimeoutMs(long nowTicks)
+    {
+        long timeoutTicks = long.MaxValue;
+        bool anyStreaming = false;
+        for (int index = 0; index < _slots.Length; index++)
+        {
+            BindingSlot slot = _slots[index];
+            if (slot.Stream != null)
+            {
+                anyStreaming = true;
+                continue;
+            }
+
+            // A pending resolve wakes the set when it finishes.
+            if (slot.Resolving)
+            {
+                continue;
+            }
+
+            timeoutTicks = Math.Min(timeoutTicks, Math.Max(0, slot.RetryAtTicks - nowTicks));
+        }
+
+        long timeoutMs = timeoutTicks == long.MaxValue
+            ? long.MaxValue
+            : (long)Math.Ceiling(timeoutTicks * 1000.0 / Stopwatch.Frequency);
+        if (anyStreaming && _refreshesExclusiveGrab)
+        {
+            timeoutMs = Math.Min(timeoutMs, GrabRefreshTimeoutMs);
+        }
+
+        return timeoutMs == long.MaxValue ? -1 : (int)Math.Min(timeoutMs, int.MaxValue);
+    }
+
+    private void Report(BindingSlot slot, string? deviceNode, LinuxRuntimeBindingStatus status, string message)
+    {
+        LinuxInputRuntimeService.Report(
+            _options.Observer,
+            ref slot.LastReported,
+            slot.Binding.Side,
+            slot.Binding.Device.StableId,
+            deviceNode,
+            status,
+            message);
+    }
+
+    private sealed class BindingSlot
+    {
+        public readonly LinuxTrackpadBinding Binding;
+        public LinuxTrackpadBinding? ActiveBinding;
+        public LinuxEvdevStream? Stream;
+        public string? ActiveDeviceNode;
+        public LinuxRuntimeBindingState? LastReported;
+        public long RetryAtTicks;
+        // Resolving and ResolveStale are reactor-only; Resolved is handed over from the resolve task.
+        public bool Resolving;
+        public bool ResolveStale;
+        public ResolveOutcome? Resolved;
+
+        public BindingSlot(LinuxTrackpadBinding binding)
+        {
+            Binding = binding;
+        }
+    }
+
+    private sealed record ResolveOutcome(LinuxInputDeviceDescriptor? Device, Exception? Error);
+}
@@ -1,4 +1,5 @@
 using GlassToKey.Platform.Linux.Contracts;
+using GlassToKey.Platform.Linux.Devices;
 
 namespace GlassToKey.Platform.Linux;
 
@@ -9,6 +10,22 @@ public enum LinuxExclusiveGrabMode
     Always = 2
 }
 
+public enum LinuxEvdevReadMode
+{
+    // One event per read() and an 8 ms sleep when the node is idle. Kept for latency comparison.
+    Polling = 0,
+    // Blocks in poll() until the node is readable, then drains a batch of events per read().
+    Readiness = 1
+}
+
+public enum LinuxHotplugMode
+{
+    // Re-enumerate sysfs every ReconnectDelay while a trackpad is missing. Kept for comparison.
+    Polling = 0,
+    // Cache enumeration between netlink input uevents and retry as soon as one arrives.
+    Uevent = 1
+}
+
 public sealed class LinuxInputRuntimeOptions
 {
     public static LinuxInputRuntimeOptions Default { get; } = new();
@@ -20,4 +37,11 @@ public sealed class LinuxInputRuntimeOptions
     public LinuxExclusiveGrabMode ExclusiveGrabMode { get; init; } = LinuxExclusiveGrabMode.DynamicKeyboardMode;
 
     public Func<bool>? ShouldGrabExclusiveInput { get; init; }
+
+    public LinuxEvdevReadMode ReadMode { get; init; } = LinuxEvdevReadMode.Readiness;
+
+    public LinuxHotplugMode HotplugMode { get; init; } = LinuxHotplugMode.Uevent;
+
+    // Test hook: replaces the netlink socket when HotplugMode is Uevent.
+    internal Func<ILinuxUeventSource>? UeventSourceFactory { get; init; }
 }
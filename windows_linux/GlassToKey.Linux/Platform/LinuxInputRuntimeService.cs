@@ -9,6 +9,7 @@ public sealed class LinuxInputRuntimeService
 {
     private readonly LinuxEvdevReader _reader;
     private readonly ILinuxTrackpadBackend _trackpadBackend;
+    private long _sinkFramesDropped;
 
     public LinuxInputRuntimeService(
         LinuxEvdevReader? reader = null,
@@ -18,6 +19,9 @@ public sealed class LinuxInputRuntimeService
         _trackpadBackend = trackpadBackend ?? new LinuxTrackpadEnumerator();
     }
 
+    // Readiness mode only: frames skipped because an asynchronous sink had not finished.
+    public long SinkFramesDropped => Interlocked.Read(ref _sinkFramesDropped);
+
     public Task RunAsync(
         IReadOnlyList<LinuxTrackpadBinding> bindings,
         ILinuxInputFrameSink sink,
@@ -31,14 +35,57 @@ public sealed class LinuxInputRuntimeService
             throw new ArgumentException("At least one Linux trackpad binding is required.", nameof(bindings));
         }
 
+        LinuxInputRuntimeOptions effectiveOptions = options ?? LinuxInputRuntimeOptions.Default;
+        LinuxTrackpadDeviceCache devices = CreateDeviceCache(effectiveOptions);
+        if (effectiveOptions.ReadMode == LinuxEvdevReadMode.Readiness)
+        {
+            Task? pendingSink = null;
+            LinuxInputReactor reactor = new(
+                bindings,
+                effectiveOptions,
+                devices,
+                stableId => ResolveCurrentDevice(devices, stableId),
+                (activeBinding, snapshot) =>
+                {
+                    // The reactor thread serves every binding and must never wait on the sink:
+                    // frames arriving while an asynchronous call is still running are dropped.
+                    if (pendingSink != null)
+                    {
+                        if (!pendingSink.IsCompleted)
+                        {
+                            Interlocked.Increment(ref _sinkFramesDropped);
+                            return !cancellationToken.IsCancellationRequested;
+                        }
+
+                        Task completed = pendingSink;
+                        pendingSink = null;
+                        // Already complete; rethrows a sink fault as a stream fault.
+                        completed.GetAwaiter().GetResult();
+                    }
+
+                    ValueTask pending = sink.OnFrameAsync(new LinuxRuntimeFrame(activeBinding, snapshot), cancellationToken);
+                    if (pending.IsCompleted)
+                    {
+                        pending.GetAwaiter().GetResult();
+                    }
+                    else
+                    {
+                        pendingSink = pending.AsTask();
+                    }
+
+                    return !cancellationToken.IsCancellationRequested;
+                });
+            return RunWithDeviceCacheAsync(reactor.Start(cancellationToken), devices);
+        }
+
         Task[] tasks = new Task[bindings.Count];
         for (int index = 0; index < bindings.Count; index++)
         {
             LinuxTrackpadBinding binding = bindings[index];
-            tasks[index] = RunBindingLoopAsync(binding, sink, options ?? LinuxInputRuntimeOptions.Default, cancellationToken);
+            tasks[index] = RunBindingLoopAsync(binding, sink, effectiveOptions, devices, cancellationToken);
         }
 
-        return Task.WhenAll(tasks);
+        return RunWithDeviceCacheAsync(Task.WhenAll(tasks), devices);
     }
 
     public Task RunAsync(
@@ -54,25 +101,77 @@ public sealed class LinuxInputRuntimeService
             throw new ArgumentException("At least one Linux trackpad binding is required.", nameof(bindings));
         }
 
+        LinuxInputRuntimeOptions effectiveOptions = options ?? LinuxInputRuntimeOptions.Default;
+        LinuxTrackpadDeviceCache devices = CreateDeviceCache(effectiveOptions);
+        if (effectiveOptions.ReadMode == LinuxEvdevReadMode.Readiness)
+        {
+            LinuxInputReactor reactor = new(
+                bindings,
+                effectiveOptions,
+                devices,
+                stableId => ResolveCurrentDevice(devices, stableId),
+                (activeBinding, snapshot) =>
+                {
+                    TrackpadFrameEnvelope envelope = CreateEnvelope(activeBinding, snapshot);
+                    // A live target may drop frames under backpressure. That should not be
+                    // treated as an evdev disconnect because the device stream is still valid.
+                    target.Post(in envelope);
+                    return !cancellationToken.IsCancellationRequested;
+                });
+            return RunWithDeviceCacheAsync(reactor.Start(cancellationToken), devices);
+        }
+
         Task[] tasks = new Task[bindings.Count];
         for (int index = 0; index < bindings.Count; index++)
         {
             LinuxTrackpadBinding binding = bindings[index];
-            tasks[index] = RunBindingLoopAsync(binding, target, options ?? LinuxInputRuntimeOptions.Default, cancellationToken);
+            tasks[index] = RunBindingLoopAsync(binding, target, effectiveOptions, devices, cancellationToken);
+        }
+
+        return RunWithDeviceCacheAsync(Task.WhenAll(tasks), devices);
+    }
+
+    private LinuxTrackpadDeviceCache CreateDeviceCache(LinuxInputRuntimeOptions options)
+    {
+        ILinuxUeventSource? source = null;
+        if (options.HotplugMode == LinuxHotplugMode.Uevent)
+        {
+            try
+            {
+                source = options.UeventSourceFactory?.Invoke() ?? new LinuxNetlinkUeventSource();
+            }
+            catch (IOException)
+            {
+                // No netlink access (e.g. a restricted sandbox): fall back to re-enumerating.
+            }
         }
 
-        return Task.WhenAll(tasks);
+        return new LinuxTrackpadDeviceCache(_trackpadBackend, source, LinuxTrackpadDeviceCache.DefaultMaxAge);
+    }
+
+    private static async Task RunWithDeviceCacheAsync(Task run, LinuxTrackpadDeviceCache devices)
+    {
+        try
+        {
+            await run.ConfigureAwait(false);
+        }
+        finally
+        {
+            devices.Dispose();
+        }
     }
 
     private async Task RunBindingLoopAsync(
         LinuxTrackpadBinding binding,
         ILinuxInputFrameSink sink,
         LinuxInputRuntimeOptions options,
+        LinuxTrackpadDeviceCache devices,
         CancellationToken cancellationToken)
     {
         await RunBindingLoopCoreAsync(
             binding,
             options,
+            devices,
             async (activeBinding, snapshot, token) =>
             {
                 await sink.OnFrameAsync(new LinuxRuntimeFrame(activeBinding, snapshot), token).ConfigureAwait(false);
@@ -85,22 +184,17 @@ public sealed class LinuxInputRuntimeService
         LinuxTrackpadBinding binding,
         ITrackpadFrameTarget target,
         LinuxInputRuntimeOptions options,
+        LinuxTrackpadDeviceCache devices,
         CancellationToken cancellationToken)
     {
         await RunBindingLoopCoreAsync(
             binding,
             options,
+            devices,
             (activeBinding, snapshot, token) =>
             {
                 token.ThrowIfCancellationRequested();
-                TrackpadFrameEnvelope envelope = new(
-                    activeBinding.Side,
-                    snapshot.Frame,
-                    snapshot.MaxX,
-                    snapshot.MaxY,
-                    snapshot.Frame.ArrivalQpcTicks);
-                // A live target may drop frames under backpressure. That should not be
-                // treated as an evdev disconnect because the device stream is still valid.
+                TrackpadFrameEnvelope envelope = CreateEnvelope(activeBinding, snapshot);
                 target.Post(in envelope);
                 return ValueTask.FromResult(!token.IsCancellationRequested);
             },
@@ -110,6 +204,7 @@ public sealed class LinuxInputRuntimeService
     private async Task RunBindingLoopCoreAsync(
         LinuxTrackpadBinding binding,
         LinuxInputRuntimeOptions options,
+        LinuxTrackpadDeviceCache devices,
         Func<LinuxTrackpadBinding, LinuxEvdevFrameSnapshot, CancellationToken, ValueTask<bool>> onFrame,
         CancellationToken cancellationToken)
     {
@@ -120,12 +215,13 @@ public sealed class LinuxInputRuntimeService
 
         while (!cancellationToken.IsCancellationRequested)
         {
-            LinuxInputDeviceDescriptor? currentDevice = ResolveCurrentDevice(stableId);
+            long observedGeneration = devices.Generation;
+            LinuxInputDeviceDescriptor? currentDevice = ResolveCurrentDevice(devices, stableId);
             if (currentDevice == null)
             {
                 Report(options.Observer, ref lastReported, binding.Side, stableId, activeDeviceNode, LinuxRuntimeBindingStatus.WaitingForDevice, "Waiting for trackpad to reappear.");
                 activeDeviceNode = null;
-                await DelayReconnectAsync(options.ReconnectDelay, cancellationToken).ConfigureAwait(false);
+                await DelayReconnectAsync(options.ReconnectDelay, devices, observedGeneration, cancellationToken).ConfigureAwait(false);
                 continue;
             }
 
@@ -133,7 +229,7 @@ public sealed class LinuxInputRuntimeService
             {
                 Report(options.Observer, ref lastReported, binding.Side, stableId, currentDevice.DeviceNode, LinuxRuntimeBindingStatus.WaitingForDevice, currentDevice.AccessError);
                 activeDeviceNode = currentDevice.DeviceNode;
-                await DelayReconnectAsync(options.ReconnectDelay, cancellationToken).ConfigureAwait(false);
+                await DelayReconnectAsync(options.ReconnectDelay, devices, observedGeneration, cancellationToken).ConfigureAwait(false);
                 continue;
             }
 
@@ -148,17 +244,12 @@ public sealed class LinuxInputRuntimeService
 
             try
             {
-                Func<bool>? shouldGrabExclusiveInput = options.ExclusiveGrabMode switch
-                {
-                    LinuxExclusiveGrabMode.Always => static () => true,
-                    LinuxExclusiveGrabMode.Never => static () => false,
-                    _ => options.ShouldGrabExclusiveInput
-                };
-
+                Func<bool>? shouldGrabExclusiveInput = ResolveShouldGrabExclusiveInput(options);
                 await _reader.StreamFramesAsync(
                     currentDevice.DeviceNode,
                     snapshot => onFrame(activeBinding, snapshot, cancellationToken),
                     shouldGrabExclusiveInput,
+                    options.ReadMode,
                     cancellationToken).ConfigureAwait(false);
 
                 if (cancellationToken.IsCancellationRequested)
@@ -192,15 +283,36 @@ public sealed class LinuxInputRuntimeService
                     $"{ex.GetType().Name}: {ex.Message}");
             }
 
-            await DelayReconnectAsync(options.ReconnectDelay, cancellationToken).ConfigureAwait(false);
+            await DelayReconnectAsync(options.ReconnectDelay, devices, observedGeneration, cancellationToken).ConfigureAwait(false);
         }
 
         Report(options.Observer, ref lastReported, binding.Side, stableId, activeDeviceNode, LinuxRuntimeBindingStatus.Stopped, "Stopped Linux input binding.");
     }
 
-    private LinuxInputDeviceDescriptor? ResolveCurrentDevice(string stableId)
+    internal static Func<bool>? ResolveShouldGrabExclusiveInput(LinuxInputRuntimeOptions options)
     {
-        IReadOnlyList<LinuxInputDeviceDescriptor> devices = _trackpadBackend.EnumerateDevices();
+        return options.ExclusiveGrabMode switch
+        {
+            LinuxExclusiveGrabMode.Always => static () => true,
+            LinuxExclusiveGrabMode.Never => static () => false,
+            _ => options.ShouldGrabExclusiveInput
+        };
+    }
+
+    private static TrackpadFrameEnvelope CreateEnvelope(LinuxTrackpadBinding binding, LinuxEvdevFrameSnapshot snapshot)
+    {
+        return new TrackpadFrameEnvelope(
+            binding.Side,
+            snapshot.Frame,
+            snapshot.MaxX,
+            snapshot.MaxY,
+            snapshot.Frame.ArrivalQpcTicks,
+            snapshot.Timestamps);
+    }
+
+    private static LinuxInputDeviceDescriptor? ResolveCurrentDevice(LinuxTrackpadDeviceCache deviceCache, string stableId)
+    {
+        IReadOnlyList<LinuxInputDeviceDescriptor> devices = deviceCache.EnumerateDevices();
         for (int index = 0; index < devices.Count; index++)
         {
             if (string.Equals(devices[index].StableId, stableId, StringComparison.OrdinalIgnoreCase))
@@ -212,24 +324,26 @@ public sealed class LinuxInputRuntimeService
         return null;
     }
 
-    private static async Task DelayReconnectAsync(TimeSpan delay, CancellationToken cancellationToken)
+    // Waits out the reconnect delay, or less when an input uevent arrives in the meantime.
+    private static async Task DelayReconnectAsync(
+        TimeSpan delay,
+        LinuxTrackpadDeviceCache devices,
+        long observedGeneration,
+        CancellationToken cancellationToken)
     {
         if (delay <= TimeSpan.Zero)
         {
             return;
         }
 
-        try
-        {
-            await Task.Delay(delay, cancellationToken).ConfigureAwait(false);
-        }
-        catch (OperationCanceledException) when (cancellationToken.IsCancellationRequested)
-        {
-            // Normal shutdown path for timed runs and process exit.
-        }
+        // Cancellation (timed runs, process exit) just completes the delay; the loop checks the token.
+        using CancellationTokenSource delayCts = CancellationTokenSource.CreateLinkedTokenSource(cancellationToken);
+        Task delayTask = Task.Delay(delay, delayCts.Token);
+        await Task.WhenAny(delayTask, devices.WaitForChangeAsync(observedGeneration)).ConfigureAwait(false);
+        delayCts.Cancel();
     }
 
-    private static void Report(
+    internal static void Report(
         ILinuxRuntimeObserver? observer,
         ref LinuxRuntimeBindingState? lastReported,
         TrackpadSide side,
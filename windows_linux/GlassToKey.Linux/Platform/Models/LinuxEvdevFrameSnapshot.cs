@@ -9,4 +9,5 @@ public sealed record LinuxEvdevFrameSnapshot(
     ushort MaxX,
     ushort MaxY,
     int FrameSequence,
-    InputFrame Frame);
+    InputFrame Frame,
+    PipelineTimestamps Timestamps = default);
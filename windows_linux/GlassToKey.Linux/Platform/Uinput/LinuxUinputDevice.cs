@@ -1,10 +1,14 @@
 using System.ComponentModel;
+using System.Diagnostics;
 using System.Runtime.InteropServices;
+using System.Text;
 using System.Threading;
 using Microsoft.Win32.SafeHandles;
 
 namespace GlassToKey.Platform.Linux.Uinput;
 
+// Events are staged in a preallocated buffer and written with one write() per report (at each
+// SYN_REPORT), or once per BeginBatch/EndBatch scope so multi-report bursts cost one syscall.
 internal sealed class LinuxUinputDevice : IDisposable
 {
     private const string DefaultDeviceNode = "/dev/uinput";
@@ -12,16 +16,29 @@ internal sealed class LinuxUinputDevice : IDisposable
     private const uint IoctlTypeUinput = (uint)'U';
     private const uint IoctlDirNone = 0;
     private const uint IoctlDirWrite = 1;
+    private const uint IoctlDirRead = 2;
+    private const int SysNameCapacity = 64;
     private const int DeviceReadyDelayMs = 150;
+    // Covers a long autocorrect burst; a fuller batch is flushed early at the capacity boundary.
+    private const int BatchCapacity = 256;
+    private const int ErrorInterrupted = 4;
     private static readonly uint UiDevCreate = ComputeIo(1);
     private static readonly uint UiDevDestroy = ComputeIo(2);
     private static readonly uint UiDevSetup = ComputeIoWrite(3, Marshal.SizeOf<UinputSetup>());
     private static readonly uint UiSetEvBit = ComputeIoWrite(100, sizeof(int));
     private static readonly uint UiSetKeyBit = ComputeIoWrite(101, sizeof(int));
     private static readonly uint UiSetRelBit = ComputeIoWrite(102, sizeof(int));
+    private static readonly uint UiGetSysName = ComputeIoctl(IoctlDirRead, 44, SysNameCapacity);
 
     private readonly SafeFileHandle _handle;
-    private readonly FileStream _stream;
+    private readonly InputEvent[] _pending = new InputEvent[BatchCapacity];
+    private readonly bool _ownsVirtualDevice;
+    private int _pendingCount;
+    private int _batchDepth;
+    private PipelineTimestamps _latencyOrigin;
+    private long _flushes;
+    private long _writeCalls;
+    private long _eventsWritten;
     private bool _disposed;
 
     public LinuxUinputDevice(string deviceName = "GlassToKey Virtual Input", string deviceNode = DefaultDeviceNode)
@@ -30,7 +47,7 @@ internal sealed class LinuxUinputDevice : IDisposable
         ArgumentException.ThrowIfNullOrWhiteSpace(deviceNode);
 
         _handle = File.OpenHandle(deviceNode, FileMode.Open, FileAccess.ReadWrite, FileShare.ReadWrite);
-        _stream = new FileStream(_handle, FileAccess.Write, bufferSize: 1);
+        _ownsVirtualDevice = true;
         try
         {
             ConfigureCapabilities();
@@ -40,12 +57,52 @@ internal sealed class LinuxUinputDevice : IDisposable
         }
         catch
         {
-            _stream.Dispose();
             _handle.Dispose();
             throw;
         }
     }
 
+    // Writes events to an already-open handle without creating a virtual device (tests).
+    internal LinuxUinputDevice(SafeFileHandle handle)
+    {
+        _handle = handle;
+    }
+
+    // Number of flushed batches, write() calls and events since creation.
+    public long Flushes => Volatile.Read(ref _flushes);
+
+    public long WriteCalls => Volatile.Read(ref _writeCalls);
+
+    public long EventsWritten => Volatile.Read(ref _eventsWritten);
+
+    public PipelineLatencyRecorder? LatencyRecorder { get; set; }
+
+    // The next write() is timed against origin, once; repeats and tap releases that Tick emits
+    // later carry no origin. Callers must serialize access, as for batches.
+    public void SetLatencyOrigin(in PipelineTimestamps origin)
+    {
+        _latencyOrigin = origin;
+    }
+
+    public void ClearLatencyOrigin()
+    {
+        _latencyOrigin = default;
+    }
+
+    // Defers writes until the matching EndBatch; scopes nest. Callers must serialize access.
+    public void BeginBatch()
+    {
+        _batchDepth++;
+    }
+
+    public void EndBatch()
+    {
+        if (_batchDepth > 0 && --_batchDepth == 0)
+        {
+            Flush();
+        }
+    }
+
     public void EmitKey(ushort keyCode, bool isDown)
     {
         Emit(LinuxEvdevCodes.EventKey, keyCode, isDown ? 1 : 0);
@@ -78,6 +135,42 @@ internal sealed class LinuxUinputDevice : IDisposable
     public void Sync()
     {
         Emit(LinuxEvdevCodes.EventSync, LinuxEvdevCodes.SyncReport, 0);
+        if (_batchDepth == 0)
+        {
+            Flush();
+        }
+    }
+
+    // The /dev/input/eventN node the kernel created for this virtual device, or null when it
+    // did not appear (yet) or the kernel predates UI_GET_SYSNAME.
+    public string? TryResolveEventNode()
+    {
+        if (!_ownsVirtualDevice)
+        {
+            return null;
+        }
+
+        byte[] sysName = new byte[SysNameCapacity];
+        int length = ioctl(_handle, UiGetSysName, sysName);
+        if (length <= 0)
+        {
+            return null;
+        }
+
+        int terminator = Array.IndexOf(sysName, (byte)0);
+        string inputName = Encoding.ASCII.GetString(sysName, 0, terminator < 0 ? length : terminator);
+        string sysDirectory = Path.Combine("/sys/devices/virtual/input", inputName);
+        if (!Directory.Exists(sysDirectory))
+        {
+            return null;
+        }
+
+        foreach (string entry in Directory.EnumerateDirectories(sysDirectory, "event*"))
+        {
+            return Path.Combine("/dev/input", Path.GetFileName(entry));
+        }
+
+        return null;
     }
 
     public void Dispose()
@@ -90,14 +183,18 @@ internal sealed class LinuxUinputDevice : IDisposable
         _disposed = true;
         try
         {
-            InvokeIoctl(UiDevDestroy, 0);
+            Flush();
+            if (_ownsVirtualDevice)
+            {
+                InvokeIoctl(UiDevDestroy, 0);
+            }
         }
         catch
         {
             // Best-effort cleanup.
         }
 
-        _stream.Dispose();
+        _handle.Dispose();
     }
 
     private void ConfigureCapabilities()
@@ -143,16 +240,55 @@ internal sealed class LinuxUinputDevice : IDisposable
 
     private void Emit(ushort eventType, ushort code, int value)
     {
-        InputEvent inputEvent = new()
+        if (_pendingCount == _pending.Length)
+        {
+            Flush();
+        }
+
+        // The kernel stamps uinput events on arrival, so the time fields stay zero.
+        _pending[_pendingCount++] = new InputEvent
         {
             Type = eventType,
             Code = code,
             Value = value
         };
+    }
+
+    private void Flush()
+    {
+        if (_pendingCount == 0)
+        {
+            return;
+        }
+
+        int count = _pendingCount;
+        _pendingCount = 0;
+        ReadOnlySpan<byte> bytes = MemoryMarshal.AsBytes(_pending.AsSpan(0, count));
+        _flushes++;
+        while (!bytes.IsEmpty)
+        {
+            _writeCalls++;
+            nint written = write(_handle, ref MemoryMarshal.GetReference(bytes), bytes.Length);
+            if (written < 0)
+            {
+                int error = Marshal.GetLastWin32Error();
+                if (error == ErrorInterrupted)
+                {
+                    continue;
+                }
 
-        ReadOnlySpan<InputEvent> span = MemoryMarshal.CreateReadOnlySpan(ref inputEvent, 1);
-        ReadOnlySpan<byte> bytes = MemoryMarshal.AsBytes(span);
-        _stream.Write(bytes);
+                throw new IOException($"uinput write failed: {new Win32Exception(error).Message}");
+            }
+
+            bytes = bytes.Slice((int)written);
+        }
+
+        _eventsWritten += count;
+        if (_latencyOrigin.PumpDequeueTicks != 0)
+        {
+            LatencyRecorder?.RecordOutput(in _latencyOrigin, Stopwatch.GetTimestamp());
+            _latencyOrigin = default;
+        }
     }
 
     private void InvokeIoctl(uint request, int value)
@@ -200,6 +336,12 @@ internal sealed class LinuxUinputDevice : IDisposable
     [DllImport("libc", SetLastError = true)]
     private static extern int ioctl(SafeFileHandle fd, uint request, ref UinputSetup setup);
 
+    [DllImport("libc", SetLastError = true)]
+    private static extern int ioctl(SafeFileHandle fd, uint request, byte[] buffer);
+
+    [DllImport("libc", SetLastError = true)]
+    private static extern nint write(SafeFileHandle fd, ref byte buffer, nint count);
+
     private static uint ComputeIo(byte number)
     {
         return ComputeIoctl(IoctlDirNone, number, 0);
@@ -5,14 +5,18 @@ using System.Threading;
 using GlassToKey.Platform.Linux.Haptics;
 using GlassToKey.Platform.Linux.Models;
 
-public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDiagnosticsProvider, IAutocorrectController, IThreeFingerDragSink
+public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDiagnosticsProvider, IAutocorrectController, IThreeFingerDragSink, IPipelineLatencySink
 {
     private const int KeyTapMinimumHoldMilliseconds = 20;
+    // A deferred correction not applied within this window is dropped; the user has moved on.
+    private const int DeferredAutocorrectTimeoutMilliseconds = 750;
+    private const int DeferredAutocorrectPollMilliseconds = 1;
 
     private readonly LinuxUinputDevice _device;
     private readonly LinuxMagicTrackpadActuatorHaptics _haptics;
     private readonly DispatchRepeatProfile _repeatProfile;
-    private readonly AutocorrectSession _autocorrect = new();
+    private readonly TimeProvider _clock;
+    private readonly AutocorrectSession _autocorrect;
     private readonly int[] _modifierRefCounts = new int[256];
     private readonly bool[] _keyDown = new bool[256];
     private readonly RepeatEntry[] _repeatEntries = new RepeatEntry[64];
@@ -22,6 +26,11 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
     private readonly long _keyTapMinimumHoldTicks;
     private readonly long _repeatInitialDelayTicks;
     private readonly long _repeatIntervalTicks;
+    private readonly long _deferredAutocorrectTimeoutTicks;
+    private readonly long _deferredAutocorrectPollTicks;
+    private ushort _deferredBoundaryKeyCode;
+    private bool _deferredBoundaryShift;
+    private long _deferredAutocorrectExpiresTicks;
     private long _dispatchCalls;
     private long _tickCalls;
     private long _sendFailures;
@@ -41,13 +50,29 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
     }
 
     internal LinuxUinputDispatcher(LinuxUinputDevice device, DispatchRepeatProfile repeatProfile)
+        : this(device, repeatProfile, new AutocorrectSession())
+    {
+    }
+
+    internal LinuxUinputDispatcher(LinuxUinputDevice device, DispatchRepeatProfile repeatProfile, AutocorrectSession autocorrect)
+        : this(device, repeatProfile, autocorrect, TimeProvider.System)
+    {
+    }
+
+    // Repeat, tap-release, deferred-autocorrect and haptics scheduling all read the clock;
+    // on a VirtualTimeProvider the caller drives Tick (DispatchEventPump.RunDueTicks).
+    internal LinuxUinputDispatcher(LinuxUinputDevice device, DispatchRepeatProfile repeatProfile, AutocorrectSession autocorrect, TimeProvider clock)
     {
         _device = device;
-        _haptics = new LinuxMagicTrackpadActuatorHaptics();
+        _autocorrect = autocorrect;
+        _clock = clock;
+        _haptics = new LinuxMagicTrackpadActuatorHaptics(clock);
         _repeatProfile = repeatProfile;
         _keyTapMinimumHoldTicks = MsToTicks(KeyTapMinimumHoldMilliseconds);
         _repeatInitialDelayTicks = _repeatProfile.GetInitialDelayTicks();
         _repeatIntervalTicks = _repeatProfile.GetIntervalTicks();
+        _deferredAutocorrectTimeoutTicks = MsToTicks(DeferredAutocorrectTimeoutMilliseconds);
+        _deferredAutocorrectPollTicks = MsToTicks(DeferredAutocorrectPollMilliseconds);
     }
 
     public void Dispatch(in DispatchEvent dispatchEvent)
@@ -57,13 +82,16 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
             return;
         }
 
-        long nowTicks = Stopwatch.GetTimestamp();
+        long nowTicks = _clock.GetTimestamp();
         Interlocked.Increment(ref _dispatchCalls);
         Volatile.Write(ref _lastDispatchTicks, nowTicks);
         bool shouldVibrate = false;
 
         lock (_gate)
         {
+            // A correction that became ready goes out before the event that follows it.
+            ApplyDeferredAutocorrect(nowTicks);
+            _device.SetLatencyOrigin(dispatchEvent.Timestamps);
             switch (dispatchEvent.Kind)
             {
                 case DispatchEventKind.KeyTap:
@@ -127,6 +155,7 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
                     break;
             }
 
+            _device.ClearLatencyOrigin();
             shouldVibrate = (dispatchEvent.Flags & DispatchEventFlags.Haptic) != 0;
         }
 
@@ -162,6 +191,48 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
 
                 entry.NextTick = nowTicks + entry.IntervalTicks;
             }
+
+            ApplyDeferredAutocorrect(nowTicks);
+        }
+    }
+
+    public long GetNextDeadlineTicks()
+    {
+        if (_disposed)
+        {
+            return long.MaxValue;
+        }
+
+        lock (_gate)
+        {
+            long deadlineTicks = long.MaxValue;
+            for (int index = 0; index < _tapReleaseEntries.Length; index++)
+            {
+                if (_tapReleaseEntries[index].Active && _tapReleaseEntries[index].ReleaseTick < deadlineTicks)
+                {
+                    deadlineTicks = _tapReleaseEntries[index].ReleaseTick;
+                }
+            }
+
+            for (int index = 0; index < _repeatEntries.Length; index++)
+            {
+                if (_repeatEntries[index].Active && _repeatEntries[index].NextTick < deadlineTicks)
+                {
+                    deadlineTicks = _repeatEntries[index].NextTick;
+                }
+            }
+
+            // Poll the lookup worker while it is busy; once answered, held keys releasing (tap
+            // deadlines or key-up dispatches) drive the apply, bounded by the expiry.
+            if (_autocorrect.HasDeferredLookup)
+            {
+                long pollTicks = _autocorrect.PollDeferredLookup()
+                    ? _deferredAutocorrectExpiresTicks
+                    : Math.Min(_deferredAutocorrectExpiresTicks, _clock.GetTimestamp() + _deferredAutocorrectPollTicks);
+                deadlineTicks = Math.Min(deadlineTicks, pollTicks);
+            }
+
+            return deadlineTicks;
         }
     }
 
@@ -314,6 +385,14 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
         }
     }
 
+    public void AttachPipelineLatency(PipelineLatencyRecorder recorder)
+    {
+        lock (_gate)
+        {
+            _device.LatencyRecorder = recorder;
+        }
+    }
+
     public bool TryGetDiagnostics(out InputDispatcherDiagnostics diagnostics)
     {
         if (_disposed)
@@ -327,7 +406,10 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
                 ActiveModifiers: 0,
                 LastDispatchTicks: Volatile.Read(ref _lastDispatchTicks),
                 LastTickTicks: Volatile.Read(ref _lastTickTicks),
-                LastErrorMessage: Volatile.Read(ref _lastErrorMessage) ?? string.Empty);
+                LastErrorMessage: Volatile.Read(ref _lastErrorMessage) ?? string.Empty,
+                OutputFlushes: _device.Flushes,
+                OutputWriteCalls: _device.WriteCalls,
+                OutputEvents: _device.EventsWritten);
             return true;
         }
 
@@ -342,7 +424,10 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
                 ActiveModifiers: CountActiveModifiersLocked(),
                 LastDispatchTicks: Volatile.Read(ref _lastDispatchTicks),
                 LastTickTicks: Volatile.Read(ref _lastTickTicks),
-                LastErrorMessage: Volatile.Read(ref _lastErrorMessage) ?? string.Empty);
+                LastErrorMessage: Volatile.Read(ref _lastErrorMessage) ?? string.Empty,
+                OutputFlushes: _device.Flushes,
+                OutputWriteCalls: _device.WriteCalls,
+                OutputEvents: _device.EventsWritten);
             return true;
         }
     }
@@ -717,7 +802,7 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
         }
 
         _tapHeldDown[keyIndex] = true;
-        ScheduleTapRelease(keyCode, Stopwatch.GetTimestamp() + _keyTapMinimumHoldTicks);
+        ScheduleTapRelease(keyCode, _clock.GetTimestamp() + _keyTapMinimumHoldTicks);
     }
 
     private void ScheduleTapRelease(ushort keyCode, long releaseTick)
@@ -816,7 +901,7 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
 
     private void ProcessAutocorrectKeyInput(in DispatchEvent dispatchEvent)
     {
-        if (!_autocorrect.GetStatus().Enabled)
+        if (!_autocorrect.IsEnabled)
         {
             _autocorrect.ForceReset("disabled");
             return;
@@ -842,31 +927,127 @@ public sealed class LinuxUinputDispatcher : IInputDispatcher, IInputDispatcherDi
 
         if (AutocorrectDispatchKeyAnalyzer.IsWordBoundary(dispatchEvent))
         {
-            ApplyAutocorrectForWordBoundary();
+            ApplyAutocorrectForWordBoundary(dispatchEvent);
             return;
         }
 
         _autocorrect.NotifyNonWordKey();
     }
 
-    private void ApplyAutocorrectForWordBoundary()
+    private void ApplyAutocorrectForWordBoundary(in DispatchEvent dispatchEvent)
     {
-        if (!_autocorrect.TryCompleteWord(out AutocorrectReplacement replacement) ||
-            !LinuxKeyCodeMapper.TryMapSemanticCode(DispatchSemanticCode.Backspace, out ushort backspaceCode))
+        // SymSpell lookups run on the session's worker so the boundary key and everything
+        // after it go out immediately. Enter and Tab resolve inline: an application may act
+        // on them at once, so they cannot be erased and retyped later.
+        bool allowDeferred = !AutocorrectDispatchKeyAnalyzer.IsCommittingWordBoundary(dispatchEvent) &&
+                             TryResolveKeyCode(dispatchEvent, out _deferredBoundaryKeyCode);
+        AutocorrectCompletion completion = _autocorrect.CompleteWord(allowDeferred, out AutocorrectReplacement replacement);
+        if (completion == AutocorrectCompletion.Deferred)
+        {
+            _deferredBoundaryShift = IsShiftModifierDown();
+            _deferredAutocorrectExpiresTicks = _clock.GetTimestamp() + _deferredAutocorrectTimeoutTicks;
+            return;
+        }
+
+        if (completion == AutocorrectCompletion.Replaced)
+        {
+            EmitAutocorrectBurst(replacement);
+        }
+    }
+
+    private void ApplyDeferredAutocorrect(long nowTicks)
+    {
+        if (!_autocorrect.HasDeferredLookup)
         {
             return;
         }
 
+        if (nowTicks >= _deferredAutocorrectExpiresTicks)
+        {
+            _autocorrect.CancelDeferredLookup("lookup_expired");
+            return;
+        }
+
+        // Retyped keys would be swallowed by the kernel while the same key is still down, and
+        // a held modifier would change what they produce.
+        if (HasHeldKeysLocked() || !_autocorrect.TryTakeDeferredReplacement(out AutocorrectReplacement replacement))
+        {
+            return;
+        }
+
+        EmitAutocorrectBurst(replacement);
+    }
+
+    private bool HasHeldKeysLocked()
+    {
+        return Array.IndexOf(_tapHeldDown, true) >= 0 ||
+               CountKeysDownLocked() > 0 ||
+               CountActiveModifiersLocked() > 0;
+    }
+
+    private void EmitAutocorrectBurst(in AutocorrectReplacement replacement)
+    {
+        if (!LinuxKeyCodeMapper.TryMapSemanticCode(DispatchSemanticCode.Backspace, out ushort backspaceCode))
+        {
+            return;
+        }
+
+        // The whole correction goes out in one write() instead of one per key report.
+        _device.BeginBatch();
+        try
+        {
+            EmitAutocorrectReplacement(replacement, backspaceCode);
+        }
+        finally
+        {
+            try
+            {
+                _device.EndBatch();
+            }
+            catch (Exception ex)
+            {
+                RecordSendFailure(ex);
+            }
+        }
+    }
+
+    private void EmitAutocorrectReplacement(in AutocorrectReplacement replacement, ushort backspaceCode)
+    {
         for (int index = 0; index < replacement.BackspaceCount; index++)
         {
             TryEmitKey(backspaceCode, isDown: true);
             TryEmitKey(backspaceCode, isDown: false);
         }
 
-        for (int index = 0; index < replacement.ReplacementText.Length; index++)
+        EmitReplacementLetters(replacement.ReplacementText);
+        if (!replacement.RetypeBoundary)
+        {
+            return;
+        }
+
+        if (_deferredBoundaryShift &&
+            LinuxKeyCodeMapper.TryMapSemanticCode(DispatchSemanticCode.Shift, out ushort boundaryShiftCode))
+        {
+            TryEmitKey(boundaryShiftCode, isDown: true);
+            TryEmitKey(_deferredBoundaryKeyCode, isDown: true);
+            TryEmitKey(_deferredBoundaryKeyCode, isDown: false);
+            TryEmitKey(boundaryShiftCode, isDown: false);
+        }
+        else
+        {
+            TryEmitKey(_deferredBoundaryKeyCode, isDown: true);
+            TryEmitKey(_deferredBoundaryKeyCode, isDown: false);
+        }
+
+        EmitReplacementLetters(replacement.TrailingText);
+    }
+
+    private void EmitReplacementLetters(string text)
+    {
+        for (int index = 0; index < text.Length; index++)
         {
             if (!AutocorrectDispatchKeyAnalyzer.TryResolveReplacementLetter(
-                    replacement.ReplacementText[index],
+                    text[index],
                     out DispatchSemanticCode semanticCode,
                     out bool requiresShift) ||
                 !LinuxKeyCodeMapper.TryMapSemanticCode(semanticCode, out ushort keyCode))
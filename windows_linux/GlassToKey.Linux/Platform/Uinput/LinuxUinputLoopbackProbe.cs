@@ -0,0 +1,434 @@
+using System.ComponentModel;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using System.Threading;
+using GlassToKey;
+using GlassToKey.Platform.Linux.Evdev;
+using Microsoft.Win32.SafeHandles;
+
+namespace GlassToKey.Platform.Linux.Uinput;
+
+public readonly record struct LinuxUinputLoopbackOptions(
+    int Samples = 200,
+    int IntervalMicroseconds = 2000,
+    int BurstSize = 64,
+    int Bursts = 8);
+
+public sealed record LinuxUinputLoopbackResult(
+    string EventNode,
+    long ReportsSent,
+    long ReportsDelivered,
+    long ReportsMismatched,
+    long SynDropped,
+    LatencyHistogramSnapshot KeyLatency,
+    LatencyHistogramSnapshot RelativeLatency,
+    LatencyHistogramSnapshot BurstLatency,
+    LatencyHistogramSnapshot KernelToReader,
+    double DispatchReportsPerSecond,
+    double DeliveredReportsPerSecond)
+{
+    public long ReportsLost => Math.Max(0, ReportsSent - ReportsDelivered);
+}
+
+// The host cannot run the loopback: the device never got an evdev node, or the node is not
+// readable by this user. Unlike other failures this says nothing about delivery itself.
+public sealed class LinuxUinputLoopbackUnavailableException : IOException
+{
+    public LinuxUinputLoopbackUnavailableException(string message, Exception? innerException = null)
+        : base(message, innerException)
+    {
+    }
+}
+
+// Measures how long a report takes from LinuxUinputDispatcher until a reader of the virtual
+// device's evdev node has it. A dedicated loopback device is created and its node grabbed
+// exclusively, so the desktop never sees the F24 presses and pointer motion. Paced single
+// reports give the latency distributions; back-to-back bursts give the rate the kernel and
+// one reader sustain, and SYN_DROPPED shows where the evdev client buffer overflows.
+public static class LinuxUinputLoopbackProbe
+{
+    private const string LoopbackDeviceName = "GlassToKey Loopback";
+    private const ushort LoopbackVirtualKey = 0x87;
+    private const int MaxBurstSize = 512;
+    private const int EventNodeWaitMs = 2000;
+    private const int WindowTimeoutMs = 250;
+
+    public static LinuxUinputLoopbackResult Run(LinuxUinputLoopbackOptions options)
+    {
+        // An even count leaves F24 released.
+        int keySamples = (Math.Max(1, options.Samples) + 1) & ~1;
+        int relativeSamples = Math.Max(1, options.Samples);
+        int burstSize = Math.Clamp(options.BurstSize, 1, MaxBurstSize);
+        int bursts = Math.Max(0, options.Bursts);
+        long intervalTicks = Math.Max(0, options.IntervalMicroseconds) * Stopwatch.Frequency / 1_000_000L;
+
+        using LinuxUinputDispatcher dispatcher = CreateDispatcher(out LinuxUinputDevice device);
+        string eventNode = WaitForEventNode(device);
+        using LoopbackReader reader = new(eventNode, burstSize);
+
+        LatencyHistogram keyLatency = new();
+        LatencyHistogram relativeLatency = new();
+        LatencyHistogram burstLatency = new();
+        long delivered = 0;
+        long nextTicks = Stopwatch.GetTimestamp();
+        for (int sample = 0; sample < keySamples; sample++)
+        {
+            reader.BeginWindow(1, keyLatency);
+            reader.MarkSent(0);
+            dispatcher.Dispatch(new DispatchEvent(
+                TimestampTicks: Stopwatch.GetTimestamp(),
+                Kind: (sample & 1) == 0 ? DispatchEventKind.KeyDown : DispatchEventKind.KeyUp,
+                VirtualKey: LoopbackVirtualKey,
+                MouseButton: DispatchMouseButton.None,
+                RepeatToken: 0,
+                Flags: DispatchEventFlags.None,
+                Side: TrackpadSide.Right,
+                DispatchLabel: "F24"));
+            delivered += reader.WaitWindow(WindowTimeoutMs);
+            nextTicks = WaitUntil(nextTicks + intervalTicks);
+        }
+
+        // Relative reports carry their index in the window as REL_X, so a burst can be
+        // matched even when the kernel drops part of it.
+        for (int sample = 0; sample < relativeSamples; sample++)
+        {
+            reader.BeginWindow(1, relativeLatency);
+            reader.MarkSent(0);
+            dispatcher.MovePointerBy(1, 0);
+            delivered += reader.WaitWindow(WindowTimeoutMs);
+            nextTicks = WaitUntil(nextTicks + intervalTicks);
+        }
+
+        long dispatchTicks = 0;
+        long deliveryTicks = 0;
+        long burstDelivered = 0;
+        for (int burst = 0; burst < bursts; burst++)
+        {
+            reader.BeginWindow(burstSize, burstLatency);
+            long startTicks = Stopwatch.GetTimestamp();
+            for (int index = 0; index < burstSize; index++)
+            {
+                reader.MarkSent(index);
+                dispatcher.MovePointerBy(index + 1, 0);
+            }
+
+            dispatchTicks += Stopwatch.GetTimestamp() - startTicks;
+            int burstCount = reader.WaitWindow(WindowTimeoutMs);
+            if (burstCount > 0)
+            {
+                deliveryTicks += reader.LastReadTicks - startTicks;
+            }
+
+            burstDelivered += burstCount;
+            delivered += burstCount;
+            WaitUntil(Stopwatch.GetTimestamp() + intervalTicks);
+        }
+
+        if (reader.Fault != null)
+        {
+            throw new IOException(reader.Fault);
+        }
+
+        long burstSent = (long)bursts * burstSize;
+        return new LinuxUinputLoopbackResult(
+            EventNode: eventNode,
+            ReportsSent: keySamples + relativeSamples + burstSent,
+            ReportsDelivered: delivered,
+            ReportsMismatched: reader.Mismatched,
+            SynDropped: reader.SynDropped,
+            KeyLatency: keyLatency.Snapshot(),
+            RelativeLatency: relativeLatency.Snapshot(),
+            BurstLatency: burstLatency.Snapshot(),
+            KernelToReader: reader.KernelToReader.Snapshot(),
+            DispatchReportsPerSecond: dispatchTicks <= 0 ? 0 : burstSent * (double)Stopwatch.Frequency / dispatchTicks,
+            DeliveredReportsPerSecond: deliveryTicks <= 0 ? 0 : burstDelivered * (double)Stopwatch.Frequency / deliveryTicks);
+    }
+
+    private static LinuxUinputDispatcher CreateDispatcher(out LinuxUinputDevice device)
+    {
+        device = new LinuxUinputDevice(LoopbackDeviceName);
+        try
+        {
+            return new LinuxUinputDispatcher(device, DispatchRepeatProfile.Default);
+        }
+        catch
+        {
+            device.Dispose();
+            throw;
+        }
+    }
+
+    private static string WaitForEventNode(LinuxUinputDevice device)
+    {
+        // udev creates the node (and applies its permissions) shortly after UI_DEV_CREATE.
+        long deadlineTicks = Stopwatch.GetTimestamp() + (EventNodeWaitMs * Stopwatch.Frequency / 1000);
+        while (true)
+        {
+            string? eventNode = device.TryResolveEventNode();
+            if (eventNode != null && File.Exists(eventNode))
+            {
+                return eventNode;
+            }
+
+            if (Stopwatch.GetTimestamp() >= deadlineTicks)
+            {
+                throw new LinuxUinputLoopbackUnavailableException($"The '{LoopbackDeviceName}' uinput device did not get an evdev node within {EventNodeWaitMs} ms.");
+            }
+
+            Thread.Sleep(10);
+        }
+    }
+
+    private static long WaitUntil(long targetTicks)
+    {
+        long nowTicks = Stopwatch.GetTimestamp();
+        while (nowTicks < targetTicks)
+        {
+            long remainingMs = (targetTicks - nowTicks) * 1000 / Stopwatch.Frequency;
+            if (remainingMs >= 2)
+            {
+                Thread.Sleep((int)(remainingMs - 1));
+            }
+            else
+            {
+                Thread.Yield();
+            }
+
+            nowTicks = Stopwatch.GetTimestamp();
+        }
+
+        return nowTicks;
+    }
+
+    // Reads the grabbed loopback node on its own thread, as a desktop consumer would, and
+    // matches each SYN_REPORT-terminated report against the sender's current window.
+    private sealed class LoopbackReader : IDisposable
+    {
+        private const int ErrnoInterrupted = 4;
+        private const int ErrnoTryAgain = 11;
+        private const short PollIn = 0x0001;
+        private const int PollTimeoutMs = 20;
+        private const int BatchEventCapacity = 64;
+        private const ushort SyncDropped = 3;
+
+        private readonly SafeFileHandle _handle;
+        private readonly string _eventNode;
+        private readonly Thread _thread;
+        private readonly byte[] _buffer = new byte[LinuxEvdevReader.InputEventSize * BatchEventCapacity];
+        private readonly long[] _sentTicks;
+        private readonly bool[] _matched;
+        private readonly object _gate = new();
+        private readonly ManualResetEventSlim _windowDone = new(false);
+        private LatencyHistogram? _windowLatency;
+        private int _windowSize;
+        private int _windowDelivered;
+        private int _keyCursor;
+        private long _lastReadTicks;
+        private long _mismatched;
+        private long _synDropped;
+        private bool _hasPayload;
+        private bool _discardUntilReport;
+        private ushort _payloadType;
+        private int _payloadValue;
+        private long _payloadMicroseconds;
+        private volatile bool _stopping;
+        private volatile string? _fault;
+
+        public LoopbackReader(string eventNode, int maxWindowSize)
+        {
+            _eventNode = eventNode;
+            _sentTicks = new long[maxWindowSize];
+            _matched = new bool[maxWindowSize];
+            try
+            {
+                _handle = LinuxEvdevReader.OpenNonBlockingHandle(eventNode);
+            }
+            catch (IOException ex)
+            {
+                throw new LinuxUinputLoopbackUnavailableException(ex.Message, ex);
+            }
+
+            try
+            {
+                LinuxEvdevReader.SetExclusiveGrab(_handle, shouldGrab: true, eventNode);
+            }
+            catch
+            {
+                _handle.Dispose();
+                throw;
+            }
+
+            _thread = new Thread(RunLoop)
+            {
+                IsBackground = true,
+                Name = "GlassToKey.UinputLoopback"
+            };
+            _thread.Start();
+        }
+
+        public LatencyHistogram KernelToReader { get; } = new();
+
+        public string? Fault => _fault;
+
+        public long LastReadTicks => Volatile.Read(ref _lastReadTicks);
+
+        public long Mismatched => Volatile.Read(ref _mismatched);
+
+        public long SynDropped => Volatile.Read(ref _synDropped);
+
+        public void BeginWindow(int size, LatencyHistogram latency)
+        {
+            lock (_gate)
+            {
+                _windowLatency = latency;
+                _windowSize = size;
+                _windowDelivered = 0;
+                _keyCursor = 0;
+                Array.Clear(_matched);
+                _windowDone.Reset();
+            }
+        }
+
+        public void MarkSent(int index)
+        {
+            Volatile.Write(ref _sentTicks[index], Stopwatch.GetTimestamp());
+        }
+
+        // Returns how many reports of the window arrived before the timeout.
+        public int WaitWindow(int timeoutMs)
+        {
+            _windowDone.Wait(timeoutMs);
+            lock (_gate)
+            {
+                int delivered = _windowDelivered;
+                // Stragglers from a timed-out window must not match the next one.
+                _windowSize = 0;
+                return delivered;
+            }
+        }
+
+        public void Dispose()
+        {
+            _stopping = true;
+            _thread.Join();
+            _handle.Dispose();
+            _windowDone.Dispose();
+        }
+
+        private void RunLoop()
+        {
+            while (!_stopping)
+            {
+                PollFd pollFd = new()
+                {
+                    Fd = (int)_handle.DangerousGetHandle(),
+                    Events = PollIn
+                };
+                if (poll(ref pollFd, 1, PollTimeoutMs) <= 0)
+                {
+                    continue;
+                }
+
+                nint bytesRead = read(_handle, _buffer, (nuint)_buffer.Length);
+                long readTicks = Stopwatch.GetTimestamp();
+                long eventClockMicroseconds = LinuxEvdevReader.GetEventClockMicroseconds();
+                if (bytesRead < 0)
+                {
+                    int error = Marshal.GetLastWin32Error();
+                    if (error == ErrnoTryAgain || error == ErrnoInterrupted)
+                    {
+                        continue;
+                    }
+
+                    // Surfaced by Run once the sender finishes; the windows time out meanwhile.
+                    _fault = $"read() failed for '{_eventNode}': {new Win32Exception(error).Message}";
+                    return;
+                }
+
+                int count = (int)(bytesRead / LinuxEvdevReader.InputEventSize);
+                for (int index = 0; index < count; index++)
+                {
+                    LinuxEvdevReader.DecodeEvent(
+                        _buffer.AsSpan(index * LinuxEvdevReader.InputEventSize, LinuxEvdevReader.InputEventSize),
+                        out ushort type,
+                        out ushort code,
+                        out int value,
+                        out long eventMicroseconds);
+                    ApplyEvent(type, code, value, eventMicroseconds, readTicks, eventClockMicroseconds);
+                }
+            }
+        }
+
+        private void ApplyEvent(ushort type, ushort code, int value, long eventMicroseconds, long readTicks, long eventClockMicroseconds)
+        {
+            if (type == LinuxEvdevCodes.EventSync)
+            {
+                if (code == SyncDropped)
+                {
+                    // The kernel discarded queued events; what follows up to the next report
+                    // boundary is a partial report.
+                    Interlocked.Increment(ref _synDropped);
+                    _hasPayload = false;
+                    _discardUntilReport = true;
+                }
+                else if (code == LinuxEvdevCodes.SyncReport)
+                {
+                    if (_hasPayload && !_discardUntilReport)
+                    {
+                        CompleteReport(readTicks, eventClockMicroseconds);
+                    }
+
+                    _hasPayload = false;
+                    _discardUntilReport = false;
+                }
+
+                return;
+            }
+
+            if ((type == LinuxEvdevCodes.EventKey && code == LinuxEvdevCodes.KeyF24) ||
+                (type == LinuxEvdevCodes.EventRelative && code == LinuxEvdevCodes.RelativeX))
+            {
+                _hasPayload = true;
+                _payloadType = type;
+                _payloadValue = value;
+                _payloadMicroseconds = eventMicroseconds;
+            }
+        }
+
+        private void CompleteReport(long readTicks, long eventClockMicroseconds)
+        {
+            KernelToReader.RecordTicks(LinuxEvdevReader.MicrosecondsToTicks(eventClockMicroseconds - _payloadMicroseconds));
+            lock (_gate)
+            {
+                int index = _payloadType == LinuxEvdevCodes.EventRelative ? _payloadValue - 1 : _keyCursor++;
+                if ((uint)index >= (uint)_windowSize || _matched[index])
+                {
+                    Interlocked.Increment(ref _mismatched);
+                    return;
+                }
+
+                _matched[index] = true;
+                _windowLatency?.RecordTicks(readTicks - Volatile.Read(ref _sentTicks[index]));
+                Volatile.Write(ref _lastReadTicks, readTicks);
+                if (++_windowDelivered == _windowSize)
+                {
+                    _windowDone.Set();
+                }
+            }
+        }
+
+        [DllImport("libc", SetLastError = true)]
+        private static extern nint read(SafeFileHandle fd, byte[] buffer, nuint count);
+
+        [DllImport("libc", SetLastError = true)]
+        private static extern int poll(ref PollFd fds, nuint nfds, int timeout);
+
+        [StructLayout(LayoutKind.Sequential)]
+        private struct PollFd
+        {
+            public int Fd;
+            public short Events;
+            public short Revents;
+        }
+    }
+}
@@ -1,4 +1,5 @@
 using System.Diagnostics;
+using System.Globalization;
 using System.Runtime.InteropServices;
 using System.Text;
 using System.Threading;
@@ -70,7 +71,7 @@ internal static class Program
 
         if (string.Equals(args[0], "doctor", StringComparison.OrdinalIgnoreCase))
         {
-            return RunDoctor();
+            return RunDoctor(args);
         }
 
         if (string.Equals(args[0], "init-config", StringComparison.OrdinalIgnoreCase))
@@ -138,6 +139,36 @@ internal static class Program
             return CheckAtpCapFixture(args);
         }
 
+        if (string.Equals(args[0], "check-atpcap-alloc", StringComparison.OrdinalIgnoreCase))
+        {
+            return CheckAtpCapAllocations(args);
+        }
+
+        if (string.Equals(args[0], "bench-frame-queue", StringComparison.OrdinalIgnoreCase))
+        {
+            return BenchmarkFrameQueue(args);
+        }
+
+        if (string.Equals(args[0], "bench-hit-test", StringComparison.OrdinalIgnoreCase))
+        {
+            return BenchmarkHitTest(args);
+        }
+
+        if (string.Equals(args[0], "bench-autocorrect", StringComparison.OrdinalIgnoreCase))
+        {
+            return BenchmarkAutocorrect(args);
+        }
+
+        if (string.Equals(args[0], "stress", StringComparison.OrdinalIgnoreCase))
+        {
+            return RunStress(args);
+        }
+
+        if (string.Equals(args[0], "build-autocorrect-index", StringComparison.OrdinalIgnoreCase))
+        {
+            return BuildAutocorrectIndex(args);
+        }
+
         if (string.Equals(args[0], "uinput-smoke", StringComparison.OrdinalIgnoreCase))
         {
             return SmokeUinput(args);
@@ -148,6 +179,16 @@ internal static class Program
             return WatchRuntimeAsync(args).GetAwaiter().GetResult();
         }
 
+        if (string.Equals(args[0], "stats", StringComparison.OrdinalIgnoreCase))
+        {
+            return PrintRuntimeStats();
+        }
+
+        if (string.Equals(args[0], "watch-preview", StringComparison.OrdinalIgnoreCase))
+        {
+            return WatchPreview(args);
+        }
+
         if (string.Equals(args[0], "start", StringComparison.OrdinalIgnoreCase))
         {
             return StartBackgroundRuntimeAsync(args).GetAwaiter().GetResult();
@@ -228,6 +269,7 @@ internal static class Program
         Console.WriteLine($"  {CliName} print-udev-rules");
         Console.WriteLine($"  {CliName} swap-sides");
         Console.WriteLine($"  {CliName} doctor");
+        Console.WriteLine($"  {CliName} doctor loopback");
         Console.WriteLine();
     }
 
@@ -297,20 +339,111 @@ internal static class Program
         int maxFrames = args.Length >= 4 && int.TryParse(args[3], out int parsedMaxFrames)
             ? parsedMaxFrames
             : 20;
+        if (!TryParseReadMode(GetOptionValue(args, "--read-mode"), out LinuxEvdevReadMode readMode))
+        {
+            Console.Error.WriteLine("--read-mode must be 'polling' or 'readiness'.");
+            return 1;
+        }
 
         LinuxEvdevReader reader = new();
-        IReadOnlyList<LinuxEvdevFrameSnapshot> frames =
-            await reader.ReadFramesAsync(device.DeviceNode, TimeSpan.FromSeconds(seconds), maxFrames).ConfigureAwait(false);
+        if (HasFlag(args, "--compare"))
+        {
+            // Run both modes back to back so the same finger activity is measured each way.
+            Console.WriteLine($"Comparing evdev read modes on {device.DeviceNode}; keep touching the trackpad for {seconds * 2:0.##}s.");
+            ReadFramesLatency polling = await CaptureFrameLatencyAsync(reader, device.DeviceNode, seconds, maxFrames, LinuxEvdevReadMode.Polling).ConfigureAwait(false);
+            ReadFramesLatency readiness = await CaptureFrameLatencyAsync(reader, device.DeviceNode, seconds, maxFrames, LinuxEvdevReadMode.Readiness).ConfigureAwait(false);
+            PrintFrameLatency(polling);
+            PrintFrameLatency(readiness);
+            if (polling.LatenciesMs.Count > 0 && readiness.LatenciesMs.Count > 0)
+            {
+                Console.WriteLine(
+                    $"Difference (polling - readiness): mean={polling.MeanMs - readiness.MeanMs:0.000}ms p50={polling.PercentileMs(0.50) - readiness.PercentileMs(0.50):0.000}ms p99={polling.PercentileMs(0.99) - readiness.PercentileMs(0.99):0.000}ms");
+            }
+
+            return 0;
+        }
 
-        Console.WriteLine($"Frames captured: {frames.Count}");
-        foreach (LinuxEvdevFrameSnapshot snapshot in frames)
+        ReadFramesLatency result = await CaptureFrameLatencyAsync(reader, device.DeviceNode, seconds, maxFrames, readMode).ConfigureAwait(false);
+        Console.WriteLine($"Frames captured: {result.Frames.Count}");
+        foreach (LinuxEvdevFrameSnapshot snapshot in result.Frames)
         {
             PrintFrame(snapshot);
         }
 
+        PrintFrameLatency(result);
         return 0;
     }
 
+    private static async Task<ReadFramesLatency> CaptureFrameLatencyAsync(
+        LinuxEvdevReader reader,
+        string deviceNode,
+        double seconds,
+        int maxFrames,
+        LinuxEvdevReadMode readMode)
+    {
+        List<LinuxEvdevFrameSnapshot> frames = [];
+        List<double> latenciesMs = [];
+        using CancellationTokenSource cts = new(TimeSpan.FromSeconds(seconds));
+        try
+        {
+            await reader.StreamFramesAsync(
+                deviceNode,
+                snapshot =>
+                {
+                    long deliveredTicks = LinuxEvdevReader.GetEventClockTimestamp() - snapshot.Frame.ArrivalQpcTicks;
+                    latenciesMs.Add(deliveredTicks * 1000.0 / Stopwatch.Frequency);
+                    frames.Add(snapshot);
+                    return ValueTask.FromResult(frames.Count < maxFrames);
+                },
+                shouldGrabExclusiveInput: null,
+                readMode,
+                cts.Token).ConfigureAwait(false);
+        }
+        catch (OperationCanceledException) when (cts.IsCancellationRequested)
+        {
+            // Duration elapsed.
+        }
+
+        return new ReadFramesLatency(readMode, frames, latenciesMs);
+    }
+
+    private static void PrintFrameLatency(ReadFramesLatency result)
+    {
+        if (result.LatenciesMs.Count == 0)
+        {
+            Console.WriteLine($"Latency [{result.Mode}]: no frames captured.");
+            return;
+        }
+
+        Console.WriteLine(
+            $"Latency [{result.Mode}] kernel->reader over {result.LatenciesMs.Count} frames: mean={result.MeanMs:0.000}ms p50={result.PercentileMs(0.50):0.000}ms p99={result.PercentileMs(0.99):0.000}ms max={result.PercentileMs(1.0):0.000}ms");
+    }
+
+    private static bool TryParseReadMode(string? value, out LinuxEvdevReadMode readMode)
+    {
+        readMode = LinuxEvdevReadMode.Readiness;
+        if (string.IsNullOrWhiteSpace(value))
+        {
+            return true;
+        }
+
+        return Enum.TryParse(value, ignoreCase: true, out readMode) &&
+               Enum.IsDefined(readMode);
+    }
+
+    private static string? GetOptionValue(string[] args, string option)
+    {
+        for (int index = 1; index < args.Length - 1; index++)
+        {
+            if (string.Equals(args[index], option, StringComparison.OrdinalIgnoreCase))
+            {
+                return args[index + 1];
+            }
+        }
+
+        return null;
+    }
+
     private static async Task<int> ReadEventsAsync(string[] args)
     {
         LinuxTrackpadEnumerator enumerator = new();
@@ -509,9 +642,35 @@ internal static class Program
         return target;
     }
 
-    private static int RunDoctor()
+    private static int RunDoctor(string[] args)
     {
-        LinuxDoctorResult result = LinuxDoctorRunner.Run();
+        LinuxDoctorResult result;
+        if (args.Length >= 2 && string.Equals(args[1], "loopback", StringComparison.OrdinalIgnoreCase))
+        {
+            LinuxUinputLoopbackOptions options = new();
+            string? burstToken = GetOptionValue(args, "--burst");
+            string? burstsToken = GetOptionValue(args, "--bursts");
+            string? intervalToken = GetOptionValue(args, "--interval-us");
+            int samples = options.Samples;
+            int burstSize = options.BurstSize;
+            int bursts = options.Bursts;
+            int intervalMicroseconds = options.IntervalMicroseconds;
+            if ((args.Length >= 3 && !args[2].StartsWith("--", StringComparison.Ordinal) && (!int.TryParse(args[2], out samples) || samples < 1)) ||
+                (burstToken != null && (!int.TryParse(burstToken, out burstSize) || burstSize < 1 || burstSize > 512)) ||
+                (burstsToken != null && (!int.TryParse(burstsToken, out bursts) || bursts < 0)) ||
+                (intervalToken != null && (!int.TryParse(intervalToken, out intervalMicroseconds) || intervalMicroseconds < 0)))
+            {
+                Console.Error.WriteLine($"Usage: {CliName} doctor loopback [samples] [--burst 1-512] [--bursts n] [--interval-us n]");
+                return 1;
+            }
+
+            result = LinuxDoctorRunner.RunUinputLoopback(new LinuxUinputLoopbackOptions(samples, intervalMicroseconds, burstSize, bursts));
+        }
+        else
+        {
+            result = LinuxDoctorRunner.Run();
+        }
+
         Console.Write(result.Report);
         return result.Success ? 0 : 1;
     }
@@ -871,15 +1030,35 @@ internal static class Program
 
         CaptureFrameSink sink = new(writer);
         await runtime.RunAsync(bindings, sink, options, cts.Token).ConfigureAwait(false);
-        Console.WriteLine($"Capture written: {outputPath}");
+        writer.Dispose();
+        Console.WriteLine($"Capture written: {outputPath} (records={writer.RecordsWritten}, dropped={writer.RecordsDropped}, bytes={writer.BytesWritten})");
+        if (writer.WriteFailure != null)
+        {
+            Console.Error.WriteLine($"Capture write failed: {writer.WriteFailure}");
+            return 1;
+        }
+
         return 0;
     }
 
     private static int ReplayAtpCap(string[] args)
     {
+        string? batchDirectory = GetOptionValue(args, "--batch");
+        if (batchDirectory != null)
+        {
+            return ReplayAtpCapBatch(args, batchDirectory);
+        }
+
+        if (HasFlag(args, "--virtual-clock"))
+        {
+            return ReplayAtpCapVirtualClock(args);
+        }
+
         if (args.Length < 2 || string.IsNullOrWhiteSpace(args[1]))
         {
             Console.Error.WriteLine($"Usage: {CliName} replay-atpcap [capture-path] [trace-output]");
+            Console.Error.WriteLine($"       {CliName} replay-atpcap --batch <capture-dir> [--parallel workers] [--report report.json]");
+            Console.Error.WriteLine($"       {CliName} replay-atpcap [capture-path] --virtual-clock [--output uinput-events.bin]");
             return 1;
         }
 
@@ -906,15 +1085,84 @@ internal static class Program
         return 1;
     }
 
+    private static int ReplayAtpCapVirtualClock(string[] args)
+    {
+        if (args.Length < 2 || args[1].StartsWith("--", StringComparison.Ordinal))
+        {
+            Console.Error.WriteLine($"Usage: {CliName} replay-atpcap [capture-path] --virtual-clock [--output uinput-events.bin]");
+            return 1;
+        }
+
+        string? outputPath = GetOptionValue(args, "--output");
+        LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+        LinuxAtpCapVirtualReplayResult result = LinuxAtpCapReplayRunner.ReplayVirtualPipeline(
+            args[1],
+            configuration,
+            outputPath == null ? null : Path.GetFullPath(outputPath));
+        if (!result.Success)
+        {
+            Console.Error.WriteLine(result.Summary);
+            return 1;
+        }
+
+        Console.WriteLine(result.Summary);
+        if (outputPath != null)
+        {
+            Console.WriteLine($"uinput events written: {Path.GetFullPath(outputPath)}");
+        }
+
+        return 0;
+    }
+
+    private static int ReplayAtpCapBatch(string[] args, string batchDirectory)
+    {
+        string? parallelToken = GetOptionValue(args, "--parallel");
+        int parallelism = Environment.ProcessorCount;
+        if (!Directory.Exists(batchDirectory) ||
+            (parallelToken != null && (!int.TryParse(parallelToken, NumberStyles.Integer, CultureInfo.InvariantCulture, out parallelism) || parallelism <= 0)))
+        {
+            Console.Error.WriteLine($"Usage: {CliName} replay-atpcap --batch <capture-dir> [--parallel workers] [--report report.json]");
+            return 1;
+        }
+
+        string? reportPath = GetOptionValue(args, "--report");
+        LinuxAtpCapBatchReplayReport report = LinuxAtpCapBatchReplayRunner.Run(
+            batchDirectory,
+            parallelism,
+            () => new LinuxAppRuntime().LoadReplayConfiguration());
+        Console.WriteLine(LinuxAtpCapBatchReplayRunner.FormatReport(report));
+        if (!string.IsNullOrWhiteSpace(reportPath))
+        {
+            string fullReportPath = Path.GetFullPath(reportPath);
+            LinuxAtpCapBatchReplayRunner.WriteJsonReport(fullReportPath, report);
+            Console.WriteLine($"Batch replay report written: {fullReportPath}");
+        }
+
+        return report.Results.Count > 0 && report.FailedCount == 0 ? 0 : 1;
+    }
+
     private static int SummarizeAtpCap(string[] args)
     {
         if (args.Length < 2 || string.IsNullOrWhiteSpace(args[1]))
         {
-            Console.Error.WriteLine($"Usage: {CliName} summarize-atpcap [capture-path]");
+            Console.Error.WriteLine($"Usage: {CliName} summarize-atpcap [capture-path] [--record index] [--count records]");
             return 1;
         }
 
-        LinuxAtpCapSummaryResult result = LinuxAtpCapReplayRunner.Summarize(args[1]);
+        string? recordToken = GetOptionValue(args, "--record");
+        string? countToken = GetOptionValue(args, "--count");
+        int recordIndex = 0;
+        int recordCount = 1;
+        if ((recordToken != null && (!int.TryParse(recordToken, NumberStyles.Integer, CultureInfo.InvariantCulture, out recordIndex) || recordIndex < 0)) ||
+            (countToken != null && (!int.TryParse(countToken, NumberStyles.Integer, CultureInfo.InvariantCulture, out recordCount) || recordCount <= 0)))
+        {
+            Console.Error.WriteLine($"Usage: {CliName} summarize-atpcap [capture-path] [--record index] [--count records]");
+            return 1;
+        }
+
+        LinuxAtpCapSummaryResult result = recordToken != null
+            ? LinuxAtpCapReplayRunner.DescribeRecords(args[1], recordIndex, recordCount)
+            : LinuxAtpCapReplayRunner.Summarize(args[1]);
         if (result.Success)
         {
             Console.WriteLine(result.Summary);
@@ -983,6 +1231,241 @@ internal static class Program
         return 1;
     }
 
+    private static int CheckAtpCapAllocations(string[] args)
+    {
+        List<string> capturePaths = [];
+        for (int index = 1; index < args.Length; index++)
+        {
+            if (string.Equals(args[index], "--budget-bytes", StringComparison.OrdinalIgnoreCase))
+            {
+                index++;
+                continue;
+            }
+
+            if (!args[index].StartsWith("-", StringComparison.Ordinal))
+            {
+                capturePaths.Add(args[index]);
+            }
+        }
+
+        string? budgetToken = GetOptionValue(args, "--budget-bytes");
+        double budgetBytesPerFrame = 0;
+        if (capturePaths.Count == 0 ||
+            (budgetToken != null && (!double.TryParse(budgetToken, NumberStyles.Float, CultureInfo.InvariantCulture, out budgetBytesPerFrame) || budgetBytesPerFrame < 0)))
+        {
+            Console.Error.WriteLine($"Usage: {CliName} check-atpcap-alloc [capture-path...] [--budget-bytes bytes-per-frame] [--diagnostics]");
+            return 1;
+        }
+
+        bool diagnosticsEnabled = HasFlag(args, "--diagnostics");
+        LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+        bool withinBudget = true;
+        foreach (string capturePath in capturePaths)
+        {
+            LinuxAtpCapAllocationResult result = LinuxAtpCapReplayRunner.MeasureAllocations(capturePath, configuration, diagnosticsEnabled);
+            if (!result.Success)
+            {
+                Console.Error.WriteLine(result.Summary);
+                withinBudget = false;
+                continue;
+            }
+
+            bool passed = result.AllocatedBytesPerFrame <= budgetBytesPerFrame;
+            withinBudget &= passed;
+            Console.WriteLine($"{(passed ? "OK  " : "FAIL")} {result.Summary}");
+        }
+
+        return withinBudget ? 0 : 1;
+    }
+
+    private static int BenchmarkFrameQueue(string[] args)
+    {
+        int frames = args.Length >= 2 && int.TryParse(args[1], out int parsedFrames)
+            ? parsedFrames
+            : 20000;
+        double intervalMs = args.Length >= 3 && double.TryParse(args[2], out double parsedIntervalMs)
+            ? parsedIntervalMs
+            : 1.0;
+        if (frames <= 0 || intervalMs < 0)
+        {
+            Console.Error.WriteLine($"Usage: {CliName} bench-frame-queue [frames] [paced-interval-ms]");
+            return 1;
+        }
+
+        Console.WriteLine($"Frame queue post->process latency: frames={frames} pacedInterval={intervalMs:0.###}ms");
+        foreach (LinuxFrameQueueBenchmarkResult result in LinuxFrameQueueBenchmark.Run(frames, intervalMs))
+        {
+            Console.WriteLine(
+                $"  {result.Name,-20} p50={result.P50Us,8:0.0}us p99={result.P99Us,8:0.0}us p99.9={result.P999Us,8:0.0}us max={result.MaxUs,9:0.0}us rate={result.FramesPerSecond,12:0}/s");
+        }
+
+        return 0;
+    }
+
+    private static int BenchmarkHitTest(string[] args)
+    {
+        int points = args.Length >= 2 && int.TryParse(args[1], out int parsedPoints)
+            ? parsedPoints
+            : 20000;
+        int passes = args.Length >= 3 && int.TryParse(args[2], out int parsedPasses)
+            ? parsedPasses
+            : 20;
+        if (points <= 0 || passes <= 0)
+        {
+            Console.Error.WriteLine($"Usage: {CliName} bench-hit-test [points] [passes]");
+            return 1;
+        }
+
+        Console.WriteLine(
+            $"Binding hit test: points={points} passes={passes} vector256={System.Runtime.Intrinsics.Vector256.IsHardwareAccelerated} vector128={System.Runtime.Intrinsics.Vector128.IsHardwareAccelerated}");
+        bool agreed = true;
+        foreach (LinuxHitTestBenchmarkResult result in LinuxHitTestBenchmark.Run(points, passes))
+        {
+            agreed &= result.Mismatches == 0;
+            Console.WriteLine(
+                $"  {result.Name,-34} keys={result.Keys,3} slots={result.Slots,4} reference={result.ReferenceNsPerHit,6:0.0}ns soa-scalar={result.ScalarNsPerHit,6:0.0}ns soa-simd={result.VectorNsPerHit,6:0.0}ns mismatches={result.Mismatches}");
+        }
+
+        return agreed ? 0 : 1;
+    }
+
+    private static int RunStress(string[] args)
+    {
+        const string usage = "stress [seconds] [--rate hz] [--contacts 1-5] [--pattern mixed|typing|swipe|hold|chord-shift] [--seed n] [--unpaced]";
+        double seconds = args.Length >= 2 && double.TryParse(args[1], NumberStyles.Float, CultureInfo.InvariantCulture, out double parsedSeconds)
+            ? parsedSeconds
+            : 10.0;
+        double rate = 1000.0;
+        int contacts = InputFrame.MaxContacts;
+        int seed = 1;
+        SyntheticTouchPattern pattern = SyntheticTouchPattern.Mixed;
+        string? rateToken = GetOptionValue(args, "--rate");
+        string? contactsToken = GetOptionValue(args, "--contacts");
+        string? patternToken = GetOptionValue(args, "--pattern");
+        string? seedToken = GetOptionValue(args, "--seed");
+        if (seconds <= 0 ||
+            (rateToken != null && (!double.TryParse(rateToken, NumberStyles.Float, CultureInfo.InvariantCulture, out rate) || rate <= 0 || rate > 1000)) ||
+            (contactsToken != null && (!int.TryParse(contactsToken, out contacts) || contacts < 1 || contacts > InputFrame.MaxContacts)) ||
+            (patternToken != null && !Enum.TryParse(patternToken.Replace("-", string.Empty), ignoreCase: true, out pattern)) ||
+            (seedToken != null && !int.TryParse(seedToken, out seed)))
+        {
+            Console.Error.WriteLine($"Usage: {CliName} {usage}");
+            return 1;
+        }
+
+        bool paced = !HasFlag(args, "--unpaced");
+        LinuxStressOptions options = new(seconds, new SyntheticTouchStreamOptions(rate, contacts, pattern, seed), paced);
+        Console.WriteLine(string.Create(
+            CultureInfo.InvariantCulture,
+            $"Stress: {seconds:0.###}s, {(paced ? $"{rate:0.#} Hz per trackpad" : "unpaced")}, contacts<={contacts}, pattern={pattern}, seed={seed}"));
+        LinuxRuntimeConfiguration configuration = new LinuxAppRuntime().LoadReplayConfiguration();
+        LinuxStressResult result = LinuxStressRunner.Run(options, configuration.Keymap, configuration.LayoutPreset, configuration.SharedProfile);
+        Console.WriteLine(string.Create(
+            CultureInfo.InvariantCulture,
+            $"  posted={result.FramesPosted} processed={result.FramesProcessed} queueDrops={result.QueueDrops} dispatchEnqueued={result.DispatchEnqueued} dispatchDrops={result.DispatchDrops}"));
+        Console.WriteLine(string.Create(
+            CultureInfo.InvariantCulture,
+            $"  sustained={result.FramesPerSecond:0} frames/s over {result.ElapsedSeconds:0.00}s, engine capacity ~{result.EstimatedCapacity:0} frames/s at p50 process time"));
+        foreach (PipelineLatencyStage stage in Enum.GetValues<PipelineLatencyStage>())
+        {
+            LatencyHistogramSnapshot latency = result.Latency[stage];
+            if (latency.Count == 0)
+            {
+                continue;
+            }
+
+            Console.WriteLine(string.Create(
+                CultureInfo.InvariantCulture,
+                $"  {stage,-16} count={latency.Count,9} p50={latency.P50Us,9:0.0}us p99={latency.P99Us,9:0.0}us p99.9={latency.P999Us,9:0.0}us max={latency.MaxUs,10:0.0}us"));
+        }
+
+        return result.QueueDrops == 0 && result.DispatchDrops == 0 ? 0 : 2;
+    }
+
+    private static int BenchmarkAutocorrect(string[] args)
+    {
+        int words = args.Length >= 2 && int.TryParse(args[1], out int parsedWords)
+            ? parsedWords
+            : 20000;
+        int maxEditDistance = args.Length >= 3 && int.TryParse(args[2], out int parsedDistance)
+            ? parsedDistance
+            : BundledSymSpellIndex.MaxEditDistance;
+        if (words <= 0 || maxEditDistance < 1 || maxEditDistance > BundledSymSpellIndex.MaxEditDistance)
+        {
+            Console.Error.WriteLine($"Usage: {CliName} bench-autocorrect [words] [max-edit-distance 1-{BundledSymSpellIndex.MaxEditDistance}]");
+            return 1;
+        }
+
+        ulong sourceHash = BundledSymSpellIndex.ComputeSourceHash();
+        if (!BundledSymSpellIndex.TryOpen(sourceHash, out MappedSymSpellIndex? index))
+        {
+            try
+            {
+                BundledSymSpellIndex.Build(BundledSymSpellIndex.CachePath);
+            }
+            catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or InvalidDataException)
+            {
+                Console.Error.WriteLine($"Autocorrect index '{BundledSymSpellIndex.CachePath}': {ex.Message}");
+                return 1;
+            }
+
+            if (!BundledSymSpellIndex.TryOpen(sourceHash, out index))
+            {
+                Console.Error.WriteLine($"Autocorrect index '{BundledSymSpellIndex.CachePath}' could not be mapped.");
+                return 1;
+            }
+        }
+
+        using (index)
+        {
+            SymSpell? symSpell = BundledSymSpellIndex.CreateSymSpell();
+            Console.WriteLine($"Autocorrect top-1: words={words} maxEditDistance={maxEditDistance}");
+            foreach (LinuxAutocorrectBenchmarkResult result in LinuxAutocorrectBenchmark.Run(index!, symSpell, words, maxEditDistance))
+            {
+                Console.WriteLine(
+                    $"  {result.Name,-20} rate={result.WordsPerSecond,10:0}/s alloc={result.BytesPerWord,8:0.0}B/word corrections={result.Corrections}");
+            }
+        }
+
+        return 0;
+    }
+
+    private static int BuildAutocorrectIndex(string[] args)
+    {
+        string outputPath = Path.GetFullPath(args.Length >= 2 ? args[1] : BundledSymSpellIndex.CachePath);
+        BundledSymSpellIndexBuild build;
+        try
+        {
+            build = BundledSymSpellIndex.Build(outputPath);
+        }
+        catch (Exception ex) when (ex is IOException or UnauthorizedAccessException or InvalidDataException)
+        {
+            Console.Error.WriteLine($"Autocorrect index '{outputPath}': {ex.Message}");
+            return 1;
+        }
+
+        long openStart = Stopwatch.GetTimestamp();
+        if (!MappedSymSpellIndex.TryOpen(
+                outputPath,
+                BundledSymSpellIndex.ComputeSourceHash(),
+                BundledSymSpellIndex.MaxEditDistance,
+                BundledSymSpellIndex.PrefixLength,
+                out MappedSymSpellIndex? index))
+        {
+            Console.Error.WriteLine($"Autocorrect index '{outputPath}' was written but could not be mapped back.");
+            return 1;
+        }
+
+        double openMs = (Stopwatch.GetTimestamp() - openStart) * 1000.0 / Stopwatch.Frequency;
+        using (index)
+        {
+            Console.WriteLine(
+                $"Autocorrect index '{outputPath}': words={build.Stats.Words}, deletes={build.Stats.Deletes}, suggestions={build.Stats.Suggestions}, bytes={build.Stats.Bytes}, build_ms={build.BuildMs:F1}, write_ms={build.WriteMs:F1}, map_ms={openMs:F2}");
+        }
+
+        return 0;
+    }
+
     private static int SmokeUinput(string[] args)
     {
         string[] tokens = args.Length >= 2 ? args[1..] : ["A"];
@@ -1169,6 +1652,127 @@ internal static class Program
         return 0;
     }
 
+    private static int PrintRuntimeStats()
+    {
+        LinuxRuntimeStatsStore store = new();
+        LinuxRuntimeStatsSnapshot? stats = store.Load();
+        if (stats == null)
+        {
+            Console.Error.WriteLine($"No runtime stats found at {store.GetStatsPath()}; start the runtime and type for a moment first.");
+            return 1;
+        }
+
+        bool alive;
+        try
+        {
+            using Process process = Process.GetProcessById(stats.ProcessId);
+            alive = !process.HasExited;
+        }
+        catch (ArgumentException)
+        {
+            alive = false;
+        }
+
+        double ageSeconds = (DateTimeOffset.UtcNow - stats.UpdatedUtc).TotalSeconds;
+        Console.WriteLine(string.Create(
+            CultureInfo.InvariantCulture,
+            $"Runtime pid {stats.ProcessId}{(alive ? string.Empty : " (exited)")}, session {stats.RunSeconds:F1}s, updated {ageSeconds:F1}s ago"));
+        Console.WriteLine(string.Create(CultureInfo.InvariantCulture, $"{"stage",-16} {"count",10} {"p50_us",10} {"p99_us",10} {"p99.9_us",10} {"max_us",10}"));
+        foreach (LinuxRuntimeStageLatency stage in stats.Stages)
+        {
+            Console.WriteLine(string.Create(
+                CultureInfo.InvariantCulture,
+                $"{stage.Stage,-16} {stage.Count,10} {stage.P50Us,10:F1} {stage.P99Us,10:F1} {stage.P999Us,10:F1} {stage.MaxUs,10:F1}"));
+        }
+
+        return 0;
+    }
+
+    // Reads the tray runtime's shared-memory preview ring frame by frame. Attaching costs the
+    // runtime nothing; the viewer reattaches when the runtime restarts.
+    private static int WatchPreview(string[] args)
+    {
+        double seconds = args.Length >= 2 && double.TryParse(args[1], out double parsedSeconds)
+            ? parsedSeconds
+            : 10.0;
+        if (seconds <= 0)
+        {
+            Console.Error.WriteLine("Duration must be positive.");
+            return 1;
+        }
+
+        string path = LinuxPreviewChannel.GetPath();
+        using CancellationTokenSource cts = new(TimeSpan.FromSeconds(seconds));
+        using PosixSignalRegistration sigTermRegistration = RegisterShutdownSignal(PosixSignal.SIGTERM, cts);
+        using PosixSignalRegistration sigIntRegistration = RegisterShutdownSignal(PosixSignal.SIGINT, cts);
+        Console.WriteLine($"Watching preview channel for {seconds:0.##}s: {path}");
+
+        PreviewChannelReader? reader = null;
+        long nextSequence = 0;
+        long frames = 0;
+        long missed = 0;
+        try
+        {
+            while (!cts.IsCancellationRequested)
+            {
+                if (reader == null || reader.IsClosed)
+                {
+                    reader?.Dispose();
+                    if (!PreviewChannelReader.TryOpen(path, out reader))
+                    {
+                        cts.Token.WaitHandle.WaitOne(250);
+                        continue;
+                    }
+
+                    Console.WriteLine($"Attached to runtime pid {reader!.WriterProcessId}.");
+                    nextSequence = reader.LatestSequence + 1;
+                }
+
+                long latest = reader.LatestSequence;
+                if (latest < nextSequence)
+                {
+                    cts.Token.WaitHandle.WaitOne(1);
+                    continue;
+                }
+
+                for (; nextSequence <= latest; nextSequence++)
+                {
+                    if (reader.TryRead(nextSequence, out PreviewChannelFrame frame))
+                    {
+                        PrintPreviewFrame(in frame);
+                        frames++;
+                    }
+                    else
+                    {
+                        missed++;
+                    }
+                }
+            }
+        }
+        finally
+        {
+            reader?.Dispose();
+        }
+
+        Console.WriteLine($"Frames: {frames}, missed: {missed}");
+        return 0;
+    }
+
+    private static void PrintPreviewFrame(in PreviewChannelFrame frame)
+    {
+        StringBuilder line = new();
+        line.Append(CultureInfo.InvariantCulture, $"#{frame.Sequence} {frame.TrackpadSide} intent={frame.IntentModeName} layer={frame.ActiveLayer}");
+        line.Append(CultureInfo.InvariantCulture, $" typing={(frame.TypingEnabled ? "on" : "off")} keyboard={(frame.KeyboardModeEnabled ? "on" : "off")}");
+        line.Append(CultureInfo.InvariantCulture, $" button={frame.IsButtonPressed != 0} contacts={frame.ContactCount}");
+        for (int index = 0; index < frame.ContactCount; index++)
+        {
+            PreviewChannelContact contact = frame.GetContact(index);
+            line.Append(CultureInfo.InvariantCulture, $" [{contact.Id}:{contact.X},{contact.Y} p={contact.Pressure}{(contact.TipSwitch ? " tip" : string.Empty)}]");
+        }
+
+        Console.WriteLine(line.ToString());
+    }
+
     private static async Task<int> RunEngineAsync(string[] args)
     {
         bool disableExclusiveGrab = HasFlag(args, "--no-grab");
@@ -1380,6 +1984,27 @@ internal static class Program
         return processId.HasValue ? $" (PID {processId.Value})" : string.Empty;
     }
 
+    private sealed record ReadFramesLatency(
+        LinuxEvdevReadMode Mode,
+        IReadOnlyList<LinuxEvdevFrameSnapshot> Frames,
+        List<double> LatenciesMs)
+    {
+        public double MeanMs => LatenciesMs.Count == 0 ? 0 : LatenciesMs.Average();
+
+        public double PercentileMs(double percentile)
+        {
+            if (LatenciesMs.Count == 0)
+            {
+                return 0;
+            }
+
+            double[] sorted = [.. LatenciesMs];
+            Array.Sort(sorted);
+            int index = Math.Clamp((int)Math.Ceiling(percentile * sorted.Length) - 1, 0, sorted.Length - 1);
+            return sorted[index];
+        }
+    }
+
     private sealed class ConsoleTrackpadFrameTarget : ITrackpadFrameTarget
     {
         public bool Post(in TrackpadFrameEnvelope frame)
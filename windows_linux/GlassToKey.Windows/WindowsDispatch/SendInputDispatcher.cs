@@ -296,8 +296,7 @@ internal sealed class SendInputDispatcher : IInputDispatcher, IAutocorrectContro
 
     private void ProcessAutocorrectKeyInput(in DispatchEvent dispatchEvent)
     {
-        AutocorrectStatusSnapshot status = _autocorrect.GetStatus();
-        if (!status.Enabled)
+        if (!_autocorrect.IsEnabled)
         {
             _autocorrect.ForceReset("disabled");
             return;
@@ -358,6 +357,33 @@ internal sealed class SendInputDispatcher : IInputDispatcher, IAutocorrectContro
             _repeatEntries[i].NextTick = nowTicks + _repeatEntries[i].IntervalTicks;
         }
     }
+
+    public long GetNextDeadlineTicks()
+    {
+        if (_disposed)
+        {
+            return long.MaxValue;
+        }
+
+        long deadlineTicks = long.MaxValue;
+        for (int i = 0; i < _tapReleaseEntries.Length; i++)
+        {
+            if (_tapReleaseEntries[i].Active && _tapReleaseEntries[i].ReleaseTick < deadlineTicks)
+            {
+                deadlineTicks = _tapReleaseEntries[i].ReleaseTick;
+            }
+        }
+
+        for (int i = 0; i < _repeatEntries.Length; i++)
+        {
+            if (_repeatEntries[i].Active && _repeatEntries[i].NextTick < deadlineTicks)
+            {
+                deadlineTicks = _repeatEntries[i].NextTick;
+            }
+        }
+
+        return deadlineTicks;
+    }
 
     public void Dispose()
     {
@@ -1325,6 +1351,11 @@ internal sealed class NullInputDispatcher : IInputDispatcher
     {
     }
 
+    public long GetNextDeadlineTicks()
+    {
+        return long.MaxValue;
+    }
+
     public void Dispose()
     {
     }